@@ -2,6 +2,7 @@ import boto3
 import json
 import os
 import uuid
+from session_publish import session_publish_args
 
 sns_obj = boto3.client('sns')
 
@@ -24,7 +25,7 @@ def lambda_handler(event, context):
             Message=json.dumps(output),
             MessageStructure='string',
             MessageDeduplicationId=str(uuid.uuid4()),
-            MessageGroupId='3'
+            **session_publish_args(data.get('session_id'), '3')
         )
 
         dictionary = {
@@ -2,6 +2,7 @@ import boto3
 import json
 import os
 import uuid
+from session_publish import session_publish_args
 
 sns_obj = boto3.client('sns')
 
@@ -10,12 +11,21 @@ def lambda_handler(event, context):
 
     data = json.loads(event['body'])
     
-    sign_rate = data['sign_rate']
-    
-    output = {
-            "Action": "CHANGE_SIGN_RATE",
-            "Data": str(sign_rate)
-        }
+    # Pipeline knobs (e.g. {"WordTransitionDelay": 0.8}) are validated and applied as a whole by the renderer, from
+    # each session's next sentence on; the sign rate has its own action
+    if 'settings' in data:
+        output = {
+                "Action": "CHANGE_SETTINGS",
+                "Data": "",
+                "kwargs": {name: str(value) for name, value in data['settings'].items()}
+            }
+    else:
+        sign_rate = data['sign_rate']
+
+        output = {
+                "Action": "CHANGE_SIGN_RATE",
+                "Data": str(sign_rate)
+            }
         
     try:
         topic = os.environ['snsTopicArn']
@@ -24,7 +34,7 @@ def lambda_handler(event, context):
             Message=json.dumps(output),
             MessageStructure='string',
             MessageDeduplicationId=str(uuid.uuid4()),
-            MessageGroupId='5'
+            **session_publish_args(data.get('session_id'), '5')
         )
 
         dictionary = {
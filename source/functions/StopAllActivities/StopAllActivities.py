@@ -2,11 +2,14 @@ import boto3
 import json
 import os
 import uuid
+from session_publish import session_publish_args
 
 sns_obj = boto3.client('sns')
 
 def lambda_handler(event, context):
     print(event)
+
+    data = json.loads(event.get('body') or '{}')
     
     output = {
             "Action": "STOP_ALL_ANIMATIONS"
@@ -19,7 +22,7 @@ def lambda_handler(event, context):
             Message=json.dumps(output),
             MessageStructure='string',
             MessageDeduplicationId=str(uuid.uuid4()),
-            MessageGroupId='4'
+            **session_publish_args(data.get('session_id'), '4')
         )
 
         dictionary = {
@@ -3,8 +3,10 @@ import math
 import time
 
 from text2Image_helper import write_file_to_s3, check_image_moderation
+from session_publish import session_publish_args
 
 sns_obj = boto3.client('sns')
+
 aws_region = boto3.Session().region_name
 bedrock_client = boto3.client(
         service_name='bedrock-runtime', 
@@ -60,7 +62,7 @@ def lambda_handler(event, context):
             Message=json.dumps(message),
             MessageStructure='string',
             MessageDeduplicationId=next_epoch,
-            MessageGroupId='2'
+            **session_publish_args(bodyis.get('session_id'), '2')
         )
 
         dictionary = {
@@ -4,6 +4,7 @@ import json
 import uuid
 from TextToImage_helper import write_file_to_s3, check_image_moderation
 from botocore.exceptions import ClientError
+from session_publish import session_publish_args
 
 TEXT_TO_IMAGE_TOPIC_ARN = os.environ['snsTextToImageTopicArn']
 MODEL_ID = "stability.stable-diffusion-xl-v1"
@@ -39,7 +40,7 @@ def create_presigned_get(bucket_name, object_name):
     return response
 
 
-def generate_image(image_input_details):
+def generate_image(image_input_details, session_id=None):
     try:
         bedrock_response = run_bedrock_fm(image_input_details)
         result_url = create_presigned_get(bedrock_response["bucketname"], bedrock_response["imagename"])
@@ -56,7 +57,7 @@ def generate_image(image_input_details):
             Message=json.dumps({'default': json.dumps(message)}),
             MessageStructure='json',
             MessageDeduplicationId=str(uuid.uuid4()),
-            MessageGroupId='1'
+            **session_publish_args(session_id, '1')
         )
         print(sns_response)
 
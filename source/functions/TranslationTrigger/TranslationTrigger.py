@@ -4,6 +4,7 @@ import os
 import re
 import uuid
 from TextToImage_generator import generate_image
+from session_publish import session_publish_args
 
 GENERAL_TOXICITY_THRESHOLD = 0.3
 
@@ -198,6 +199,7 @@ def lambda_handler(event, context):
     if is_int(data['iterations']):
         iterations = int(data['iterations'])
     message = data['message']
+    session_id = data.get('session_id')
 
     if message is None:
         return {
@@ -227,7 +229,7 @@ def lambda_handler(event, context):
             Message=json.dumps(output),
             MessageStructure='string',
             MessageDeduplicationId=str(uuid.uuid4()),
-            MessageGroupId='1'
+            **session_publish_args(session_id, '1')
         )
 
         dictionary = {
@@ -248,7 +250,7 @@ def lambda_handler(event, context):
                 "bedrockParameters": BEDROCK_IMAGE_PARAMETERS
             }
             print(image_input_details)
-            image_response = generate_image(image_input_details)
+            image_response = generate_image(image_input_details, session_id)
             print(image_response)
 
         return {
@@ -0,0 +1,12 @@
+# Shared by the Lambda functions that publish renderer actions (deployed as the session-common layer)
+
+
+def session_publish_args(session_id, message_group_id):
+    # Multi-instance renderers only consume actions addressed to their session (SessionId message attribute);
+    # without a session the action goes to whichever renderer receives it (single instance)
+    if not session_id:
+        return {'MessageGroupId': message_group_id}
+    return {
+        'MessageGroupId': f'{session_id}-{message_group_id}',
+        'MessageAttributes': {'SessionId': {'DataType': 'String', 'StringValue': session_id}}
+    }
@@ -26,6 +26,8 @@ export interface ActivityLambdaProps{
     readonly handler: string;
     readonly code: lambda.Code;
 
+    readonly sessionLayer: lambda.ILayerVersion;
+
     readonly snsTopic : sns.ITopic;
   }
 
@@ -67,6 +69,7 @@ export class ActivityLambda extends Construct {
             role: activity_role,
             handler: props.handler,
             tracing: lambda.Tracing.ACTIVE,
+            layers: [props.sessionLayer],
             memorySize: 512,
             timeout: Duration.minutes(5),
             code: props.code,
@@ -13,6 +13,10 @@ import { NagSuppressions } from 'cdk-nag';
 export interface AslSnsSqsProps{
     readonly sqsQueueName: string,
     readonly snsTopicName: string,
+    /**
+     * Receives of a message before it's moved to the dead-letter queue (default: 1).
+     */
+    readonly maxReceiveCount?: number,
   }
 
 export class AslSnsSqs extends Construct {
@@ -35,7 +39,7 @@ export class AslSnsSqs extends Construct {
             visibilityTimeout: Duration.seconds(60),
             fifo: true,
             deadLetterQueue: {
-                maxReceiveCount: 1,
+                maxReceiveCount: props.maxReceiveCount ?? 1,
                 queue: deadLetterQueue
             },
             enforceSSL: true
@@ -26,6 +26,8 @@ export interface TextToImageLambdaProps{
 
     readonly layer: lambda.ILayerVersion;
 
+    readonly sessionLayer: lambda.ILayerVersion;
+
     readonly snsTopic : sns.ITopic;
 
     readonly outputBucket:  s3.IBucket;
@@ -69,7 +71,7 @@ export class TextToImageLambda extends Construct {
             role: texttoimage_lambda_role,
             handler: 'text_to_image.lambda_handler',
             tracing: lambda.Tracing.ACTIVE,
-            layers: [props.layer],
+            layers: [props.layer, props.sessionLayer],
             memorySize: 512,
             timeout: Duration.minutes(5),
             code: lambda.Code.fromAsset(path.join(__dirname, '../../functions/TextToImage')),
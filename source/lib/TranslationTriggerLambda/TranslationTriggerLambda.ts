@@ -25,6 +25,8 @@ export interface TranslationTriggerLambdaProps{
 
     readonly layer: lambda.ILayerVersion;
 
+    readonly sessionLayer: lambda.ILayerVersion;
+
     readonly snsTopic : sns.ITopic;
 
     readonly snsTextToImageTopicArn : sns.ITopic;
@@ -89,7 +91,7 @@ export class TranslationTriggerLambda extends Construct {
             functionName: 'LambdaTranslation',
             handler: 'TranslationTrigger.lambda_handler',
             tracing: lambda.Tracing.ACTIVE,
-            layers: [props.layer],
+            layers: [props.layer, props.sessionLayer],
             memorySize: 512,
             timeout: Duration.minutes(5),
             code: lambda.Code.fromAsset(path.join(__dirname, '../../functions/TranslationTrigger')),
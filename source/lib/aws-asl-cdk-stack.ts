@@ -21,12 +21,22 @@ export class AwsAslCdkStack extends cdk.Stack {
     const lambdaArchitecture = lambda.Architecture.ARM_64;
     const lambdaRuntime = lambda.Runtime.PYTHON_3_12;
 
+    // Renderer sessions sharing the action queues (multi-instance mode, see SessionIds in ASLMetaHuman.ini; deploy
+    // with -c sessionsPerQueue=<count>). Handing a message back to the queue counts as a receive, so the redrive policy
+    // allows each session the receive that delivers a message plus its hand-backs before the message is dead-lettered:
+    // one by a losing hedged receive (SQSHedgeAfterMs), and with shared queues the messages addressed to other sessions
+    // (possibly a few times, as a session may poll again before the owner does).
+    const sessionsPerQueue = Number(this.node.tryGetContext("sessionsPerQueue") ?? 1);
+    const receivesPerSession = sessionsPerQueue > 1 ? 5 : 2;
+    const maxReceiveCount = sessionsPerQueue * receivesPerSession;
+
     const fanOutTranslationActivity = new AslSnsSqs(
       this,
       "translationActivity",
       {
         snsTopicName: "TranslationActivityTopic",
         sqsQueueName: "TranslationActivityQueue",
+        maxReceiveCount: maxReceiveCount,
       }
     );
 
@@ -34,6 +44,7 @@ export class AwsAslCdkStack extends cdk.Stack {
     const fanOutOtherActivities = new AslSnsSqs(this, "otherActivities", {
       snsTopicName: "OtherActivitiesTopic",
       sqsQueueName: "OtherActivitiesQueue",
+      maxReceiveCount: maxReceiveCount,
     });
 
     // bucket for storing server access logging
@@ -65,6 +76,15 @@ export class AwsAslCdkStack extends cdk.Stack {
       description: "string",
     });
 
+    // Code shared by the functions that publish renderer actions (session addressing)
+    const sessionCommonLayer = new lambda.LayerVersion(this, "lambdasessioncommonlayer", {
+      code: lambda.Code.fromAsset(path.join(__dirname, "../layers/session-common")),
+      compatibleRuntimes: [lambdaRuntime],
+      compatibleArchitectures: [lambdaArchitecture],
+      removalPolicy: cdk.RemovalPolicy.DESTROY,
+      description: "Session addressing helpers for renderer action producers",
+    });
+
     // LAMBDA FUNCTION USED FOR ASL TRANSLATION
     const translateLambdafn = new TranslationTriggerLambda(
       this,
@@ -73,6 +93,7 @@ export class AwsAslCdkStack extends cdk.Stack {
         architecture: lambdaArchitecture,
         runtime: lambdaRuntime,
         layer: lambdaDepsLayer.layer,
+        sessionLayer: sessionCommonLayer,
         snsTopic: fanOutTranslationActivity.snsTopic,
         snsTextToImageTopicArn: fanOutOtherActivities.snsTopic,
         outputBucket: generatedImagesBucket,
@@ -90,6 +111,7 @@ export class AwsAslCdkStack extends cdk.Stack {
       ),
       architecture: lambdaArchitecture,
       runtime: lambdaRuntime,
+      sessionLayer: sessionCommonLayer,
       snsTopic: fanOutOtherActivities.snsTopic,
     });
 
@@ -102,6 +124,7 @@ export class AwsAslCdkStack extends cdk.Stack {
       ),
       architecture: lambdaArchitecture,
       runtime: lambdaRuntime,
+      sessionLayer: sessionCommonLayer,
       snsTopic: fanOutOtherActivities.snsTopic,
     });
 
@@ -114,6 +137,7 @@ export class AwsAslCdkStack extends cdk.Stack {
       ),
       architecture: lambdaArchitecture,
       runtime: lambdaRuntime,
+      sessionLayer: sessionCommonLayer,
       snsTopic: fanOutOtherActivities.snsTopic,
     });
 
@@ -85,11 +85,14 @@ public class ASLMetaHuman : ModuleRules
             "ControlRig",
             "CoreUObject",
             "Engine",
+            "HTTP",
+            "ImageWrapper",
             "Slate",
             "SlateCore",
             "Json",
             "JsonUtilities",
             "ModelingOperators",
+            "Sockets",
             "UMG",
         });
 
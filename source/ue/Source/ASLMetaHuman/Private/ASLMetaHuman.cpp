@@ -18,7 +18,7 @@
 
 // High-level interface to ASLMetaHuman project
 // - Contains startup/shutdown entry points, UE callback handlers
-// - Starts AWS SDK initialization
+// - Starts AWS SDK initialization (in the background, while the engine finishes loading)
 //
 // Reminders:
 // - Ensure that your system has the following environment variables set prior to command line invocation:
@@ -31,7 +31,9 @@
 //
 
 #include "ASLMetaHuman.h"
+#include "Config/InternalSettings.h"
 #include "Core/ASLMetaHumanDemo.h"
+#include "Core/StartupGraph.h"
 
 #include <Engine/World.h>
 #include <Misc/CoreDelegates.h>
@@ -44,10 +46,18 @@ DEFINE_LOG_CATEGORY(LogASLMetaHuman);
 
 using ASLMetaHuman::AwsMemoryManagerWrapper;
 using ASLMetaHuman::FASLMetaHumanModule;
+using ASLMetaHuman::Config::FInternalSettings;
 using ASLMetaHuman::Core::ASLMetaHumanDemo;
+using ASLMetaHuman::Core::AwsSdkStartupPhase;
+using ASLMetaHuman::Core::ConfigStartupPhase;
+using ASLMetaHuman::Core::FStartupGraph;
 
 namespace {
 const FString & BreakpointHitMessage {"Breakpoint Hit!"};
+// Upper bound for a pending AWS SDK initialization to finish before shutting the SDK down
+//
+constexpr float AwsSdkInitWaitTimeSeconds {10.0f};
+constexpr auto & WarningAwsSdkInitPending = TEXT("AWS SDK initialization still running: SDK shutdown skipped");
 }
 
 //*******************************************************************
@@ -70,16 +80,22 @@ FASLMetaHumanModule::~FASLMetaHumanModule() {
     AwsSDKOptionsInternalPtr = nullptr;
 }
 
-// Main entry point - calls high-level routines
+// Main entry point - calls high-level routines. The AWS SDK initializes on a worker thread: the demo's action sources
+// wait for it (see ASLMetaHumanDemo::Init), the rest of the startup doesn't
 //
 void FASLMetaHumanModule::StartupModule() {
 #if WANT_BREAKPOINT_AT_STARTUP
     FMessageDialog::Open(EAppMsgType::Ok, EAppReturnType::Yes, FText::FromString(BreakpointHitMessage));
 #endif
-    if (! InitExternalConfig())
+    if (! FStartupGraph::Run(ConfigStartupPhase, [this]() {
+            return InitExternalConfig();
+        }))
         return;
     RegisterUECallbackHandlers();
-    InitAwsSDK();
+    FStartupGraph::Launch(AwsSdkStartupPhase, {}, ENamedThreads::AnyThread, [this]() {
+        InitAwsSDK();
+        return true;
+    });
 }
 
 // Main shutdown point (from UE)
@@ -107,6 +123,10 @@ void FASLMetaHumanModule::InitAwsSDK() {
 }
 
 void FASLMetaHumanModule::ShutdownAwsSDK() {
+    if (! FStartupGraph::Wait(AwsSdkStartupPhase, AwsSdkInitWaitTimeSeconds)) {
+        UE_LOG(LogTemp, Warning, WarningAwsSdkInitPending);
+        return;
+    }
     if (! AwsSDKInitialized) {
         return;
     }
@@ -128,15 +148,22 @@ void FASLMetaHumanModule::DeregisterUECallbackHandlers() const {
     FCoreDelegates::OnEnginePreExit.RemoveAll(this);
 }
 
-// Spawns detached demo singleton (intended to be long-running, hosts the main demo)
+// Spawns detached demo singleton (intended to be long-running, hosts the main demo); from then on, configuration file
+// changes apply without a restart
 //
 void FASLMetaHumanModule::OnEngineLoopInitComplete() {
     DemoInstancePtr = ASLMetaHumanDemo::GetInstance();
+    if (ConfigStore.IsValid()) {
+        ConfigStore->StartWatching(FInternalSettings::GetSettingsReloadIntervalSeconds());
+    }
 }
 
 // Clean up the demo singleton, start AWS SDK shutdown
 //
 void FASLMetaHumanModule::OnEnginePreExit() {
+    if (ConfigStore.IsValid()) {
+        ConfigStore->StopWatching();
+    }
     if (nullptr != DemoInstancePtr) {
         DemoInstancePtr->Shutdown();
         ShutdownAwsSDK();
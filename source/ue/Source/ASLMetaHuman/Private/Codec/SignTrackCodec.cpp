@@ -0,0 +1,733 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Encodes and decodes ASL sign pose tracks (see SignTrackCodec.h)
+//
+// Encoded clip layout (little endian, every section 4-byte aligned):
+// - Header: magic, version, bone count, frame count, frame rate, keys per block, group count, total size
+// - Bone flags (one byte per bone): per track kind (translation, rotation, scale) whether it's static (stored) or
+//   animated; neither means identity
+// - Static values, in bone order: translation (3 floats), rotation (4), scale (3) of each static stored track
+// - Group table: kind, key stride, track count, padded track count, key count, component count and the offsets of the
+//   group's bone indices, dequantization parameters and block offsets
+// - Per group: bone indices, parameters (minimum and step per component and track), block offsets, then the blocks.
+//   A block starts with the byte width of each component's deltas, then per component: the absolute key of every
+//   track followed by one row of deltas per further key. Track counts are padded to 16 (zeros)
+//
+
+#include "SignTrackCodec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+using ASLMetaHuman::Codec::FRawSignTracks;
+using ASLMetaHuman::Codec::FSignTrackCodecSettings;
+using ASLMetaHuman::Codec::FSignTrackDecoder;
+
+namespace {
+constexpr uint32_t ClipMagic {0x544C5341};    // "ASLT"
+constexpr uint32_t ClipVersion {1};
+constexpr uint32_t RawMagic {0x524C5341};     // "ASLR"
+constexpr uint32_t RawVersion {1};
+constexpr uint32_t HeaderWords {8};
+constexpr uint32_t GroupWords {9};
+constexpr uint32_t KindCount {3};
+constexpr uint32_t FloatsPerRegister {8};
+constexpr uint32_t TracksPerRegister {16};
+constexpr uint32_t MaxComponents {4};
+constexpr float QuantizationLevels {65535.0f};
+// Smallest three: the three stored quaternion components are within +-1/sqrt(2)
+//
+constexpr float SmallestThreeRange {0.70710678f};
+constexpr float MinQuatLengthSquared {1.e-8f};
+
+// Channels and component counts per track kind (translation, rotation, scale)
+//
+constexpr uint32_t KindFirstChannel[KindCount] = {ASLMetaHuman::Codec::TRANSLATION_X, ASLMetaHuman::Codec::ROTATION_X,
+        ASLMetaHuman::Codec::SCALE_X};
+constexpr uint32_t KindChannelCount[KindCount] = {3, 4, 3};
+constexpr float KindIdentity[KindCount][4] = {
+        {0.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 0.0f}};
+constexpr uint32_t RotationKind {1};
+
+constexpr uint8_t StaticFlag(const uint32_t Kind) {
+    return static_cast<uint8_t>(1u << Kind);
+}
+
+constexpr uint8_t AnimatedFlag(const uint32_t Kind) {
+    return static_cast<uint8_t>(1u << (KindCount + Kind));
+}
+
+constexpr uint32_t AlignUp(const uint32_t Value, const uint32_t Alignment) {
+    return (Value + Alignment - 1) / Alignment * Alignment;
+}
+
+// Appends plain values to the encoded buffer
+//
+class FWriter {
+public:
+    template <class Type>
+    void Write(const Type & Value) {
+        const auto Bytes = reinterpret_cast<const uint8_t *>(&Value);
+        Buffer.insert(Buffer.end(), Bytes, Bytes + sizeof(Type));
+    }
+
+    template <class Type>
+    void WriteAt(const size_t Offset, const Type & Value) {
+        std::memcpy(Buffer.data() + Offset, &Value, sizeof(Type));
+    }
+
+    void Align() {
+        Buffer.resize(AlignUp(static_cast<uint32_t>(Buffer.size()), 4), 0);
+    }
+
+    uint32_t Offset() const {
+        return static_cast<uint32_t>(Buffer.size());
+    }
+
+    std::vector<uint8_t> Buffer;
+};
+
+// One animated track before grouping: the bone, its kind, its key stride and the values of its keys
+//
+struct FEncodedTrack {
+    uint32_t Bone {0};
+    uint32_t Kind {0};
+    uint32_t Stride {1};
+    std::vector<float> Keys;    // KeyCount x component count of the kind (3 or 4)
+};
+
+uint32_t GetKeyCount(const uint32_t FrameCount, const uint32_t Stride) {
+    return 1 < FrameCount ? (FrameCount - 2) / Stride + 2 : 1;
+}
+
+uint32_t GetKeyFrame(const uint32_t Key, const uint32_t Stride, const uint32_t FrameCount) {
+    return std::min(Key * Stride, FrameCount - 1);
+}
+
+// Key pair and interpolation weight around a (fractional) frame position - shared by the encoder's error checks and
+// the decoder
+//
+void GetKeyInterval(const float FramePosition,
+        const uint32_t Stride,
+        const uint32_t KeyCount,
+        const uint32_t FrameCount,
+        uint32_t & Key0,
+        uint32_t & Key1,
+        float & Alpha) {
+    Key0 = std::min(static_cast<uint32_t>(FramePosition) / Stride, KeyCount - 1);
+    Key1 = std::min(Key0 + 1, KeyCount - 1);
+    const uint32_t Frame0 = GetKeyFrame(Key0, Stride, FrameCount);
+    const uint32_t Frame1 = GetKeyFrame(Key1, Stride, FrameCount);
+    Alpha = 0.0f;
+    if (Frame1 > Frame0) {
+        Alpha = (FramePosition - static_cast<float>(Frame0)) / static_cast<float>(Frame1 - Frame0);
+        Alpha = std::clamp(Alpha, 0.0f, 1.0f);
+    }
+}
+
+void ReadTrackValue(const FRawSignTracks & Tracks, const uint32_t Frame, const uint32_t Bone, const uint32_t Kind,
+        float * Value) {
+    for (uint32_t c = 0; c < KindChannelCount[Kind]; c++) {
+        Value[c] = Tracks.Get(Frame, KindFirstChannel[Kind] + c, Bone);
+    }
+    if (RotationKind == Kind) {
+        const float LengthSquared =
+                Value[0] * Value[0] + Value[1] * Value[1] + Value[2] * Value[2] + Value[3] * Value[3];
+        const float Length = std::sqrt(std::max(LengthSquared, MinQuatLengthSquared));
+        for (uint32_t c = 0; c < 4; c++) {
+            Value[c] /= Length;
+        }
+    }
+}
+
+// Largest component difference between two values of a kind (rotations: regardless of the quaternion's sign)
+//
+float GetValueError(const uint32_t Kind, const float * A, const float * B) {
+    float Error = 0.0f;
+    float Sign = 1.0f;
+    if (RotationKind == Kind) {
+        Sign = 0.0f > A[0] * B[0] + A[1] * B[1] + A[2] * B[2] + A[3] * B[3] ? -1.0f : 1.0f;
+    }
+    for (uint32_t c = 0; c < KindChannelCount[Kind]; c++) {
+        Error = std::max(Error, std::abs(A[c] - Sign * B[c]));
+    }
+    return Error;
+}
+
+// Linear interpolation (rotations: nlerp in the shorter direction)
+//
+void InterpolateValue(const uint32_t Kind, const float * A, const float * B, const float Alpha, float * Out) {
+    const uint32_t Count = KindChannelCount[Kind];
+    float Sign = 1.0f;
+    if (RotationKind == Kind) {
+        Sign = 0.0f > A[0] * B[0] + A[1] * B[1] + A[2] * B[2] + A[3] * B[3] ? -1.0f : 1.0f;
+    }
+    float LengthSquared = 0.0f;
+    for (uint32_t c = 0; c < Count; c++) {
+        Out[c] = A[c] + Alpha * (Sign * B[c] - A[c]);
+        LengthSquared += Out[c] * Out[c];
+    }
+    if (RotationKind == Kind) {
+        const float Length = std::sqrt(std::max(LengthSquared, MinQuatLengthSquared));
+        for (uint32_t c = 0; c < Count; c++) {
+            Out[c] /= Length;
+        }
+    }
+}
+
+// Largest key stride (power of two, up to MaxKeyStride) at which interpolating the kept keys reproduces every frame
+// within Tolerance
+//
+uint32_t FindKeyStride(const FRawSignTracks & Tracks, const uint32_t Bone, const uint32_t Kind, const float Tolerance,
+        const uint32_t MaxKeyStride) {
+    float Value[4];
+    float Key0Value[4];
+    float Key1Value[4];
+    float Interpolated[4];
+    for (uint32_t Stride = std::max(1u, MaxKeyStride); Stride > 1; Stride /= 2) {
+        const uint32_t KeyCount = GetKeyCount(Tracks.FrameCount, Stride);
+        bool WithinTolerance = true;
+        for (uint32_t Frame = 0; WithinTolerance && (Frame < Tracks.FrameCount); Frame++) {
+            uint32_t Key0;
+            uint32_t Key1;
+            float Alpha;
+            GetKeyInterval(static_cast<float>(Frame), Stride, KeyCount, Tracks.FrameCount, Key0, Key1, Alpha);
+            ReadTrackValue(Tracks, GetKeyFrame(Key0, Stride, Tracks.FrameCount), Bone, Kind, Key0Value);
+            ReadTrackValue(Tracks, GetKeyFrame(Key1, Stride, Tracks.FrameCount), Bone, Kind, Key1Value);
+            ReadTrackValue(Tracks, Frame, Bone, Kind, Value);
+            InterpolateValue(Kind, Key0Value, Key1Value, Alpha, Interpolated);
+            WithinTolerance = GetValueError(Kind, Interpolated, Value) <= Tolerance;
+        }
+        if (WithinTolerance) {
+            return Stride;
+        }
+    }
+    return 1;
+}
+
+// Quantizes one key of a track into its components (rotations: largest component index, then the other three)
+//
+void QuantizeKey(const uint32_t Kind, const float * Value, const float * Min, const float * Step, uint16_t * Out) {
+    const auto Quantize = [](const float Normalized) {
+        return static_cast<uint16_t>(std::lround(std::clamp(Normalized, 0.0f, 1.0f) * QuantizationLevels));
+    };
+    if (RotationKind != Kind) {
+        for (uint32_t c = 0; c < 3; c++) {
+            Out[c] = 0.0f < Step[c] ? Quantize((Value[c] - Min[c]) / (Step[c] * QuantizationLevels)) : 0;
+        }
+        return;
+    }
+    uint32_t Largest = 0;
+    for (uint32_t c = 1; c < 4; c++) {
+        if (std::abs(Value[c]) > std::abs(Value[Largest])) {
+            Largest = c;
+        }
+    }
+    const float Sign = 0.0f > Value[Largest] ? -1.0f : 1.0f;
+    Out[0] = static_cast<uint16_t>(Largest);
+    for (uint32_t c = 0, Stored = 1; c < 4; c++) {
+        if (c != Largest) {
+            Out[Stored++] = Quantize((Sign * Value[c] + SmallestThreeRange) / (2.0f * SmallestThreeRange));
+        }
+    }
+}
+}
+
+std::vector<uint8_t> ASLMetaHuman::Codec::SerializeRawSignTracks(const FRawSignTracks & Tracks) {
+    FWriter Writer;
+    Writer.Write(RawMagic);
+    Writer.Write(RawVersion);
+    Writer.Write(Tracks.BoneCount);
+    Writer.Write(Tracks.FrameCount);
+    Writer.Write(Tracks.FrameRate);
+    const auto Bytes = reinterpret_cast<const uint8_t *>(Tracks.Values.data());
+    Writer.Buffer.insert(Writer.Buffer.end(), Bytes, Bytes + Tracks.Values.size() * sizeof(float));
+    return std::move(Writer.Buffer);
+}
+
+bool ASLMetaHuman::Codec::DeserializeRawSignTracks(const uint8_t * Data, const size_t Size, FRawSignTracks & Tracks) {
+    uint32_t Header[5];
+    if ((nullptr == Data) || (Size < sizeof(Header))) {
+        return false;
+    }
+    std::memcpy(Header, Data, sizeof(Header));
+    if ((RawMagic != Header[0]) || (RawVersion != Header[1])) {
+        return false;
+    }
+    Tracks.BoneCount = Header[2];
+    Tracks.FrameCount = Header[3];
+    std::memcpy(&Tracks.FrameRate, &Header[4], sizeof(float));
+    const size_t ValueCount = static_cast<size_t>(Tracks.FrameCount) * CHANNEL_COUNT * Tracks.BoneCount;
+    if ((Size - sizeof(Header)) / sizeof(float) != ValueCount) {
+        return false;
+    }
+    Tracks.Values.resize(ValueCount);
+    std::memcpy(Tracks.Values.data(), Data + sizeof(Header), ValueCount * sizeof(float));
+    return true;
+}
+
+std::vector<uint8_t> ASLMetaHuman::Codec::EncodeSignTracks(const FRawSignTracks & Tracks,
+        const FSignTrackCodecSettings & Settings) {
+    const size_t ValueCount = static_cast<size_t>(Tracks.FrameCount) * CHANNEL_COUNT * Tracks.BoneCount;
+    if ((0 == Tracks.BoneCount) || (0 == Tracks.FrameCount) || (0.0f >= Tracks.FrameRate)
+            || (Tracks.Values.size() != ValueCount) || (Tracks.BoneCount > UINT16_MAX)) {
+        return {};
+    }
+    const uint32_t BlockKeys = std::max(2u, Settings.BlockKeys);
+    const float Tolerances[KindCount] = {Settings.TranslationTolerance, Settings.RotationTolerance,
+            Settings.ScaleTolerance};
+
+    // Static track elimination
+    //
+    std::vector<uint8_t> BoneFlags(Tracks.BoneCount, 0);
+    std::vector<float> StaticValues;
+    std::vector<FEncodedTrack> AnimatedTracks;
+    float First[4];
+    float Value[4];
+    for (uint32_t Bone = 0; Bone < Tracks.BoneCount; Bone++) {
+        for (uint32_t Kind = 0; Kind < KindCount; Kind++) {
+            ReadTrackValue(Tracks, 0, Bone, Kind, First);
+            bool Static = true;
+            for (uint32_t Frame = 1; Static && (Frame < Tracks.FrameCount); Frame++) {
+                ReadTrackValue(Tracks, Frame, Bone, Kind, Value);
+                Static = GetValueError(Kind, First, Value) <= Tolerances[Kind];
+            }
+            if (Static) {
+                if (GetValueError(Kind, First, KindIdentity[Kind]) > Tolerances[Kind]) {
+                    BoneFlags[Bone] |= StaticFlag(Kind);
+                    StaticValues.insert(StaticValues.end(), First, First + KindChannelCount[Kind]);
+                }
+                continue;
+            }
+            BoneFlags[Bone] |= AnimatedFlag(Kind);
+            FEncodedTrack Track;
+            Track.Bone = Bone;
+            Track.Kind = Kind;
+            Track.Stride = FindKeyStride(Tracks, Bone, Kind, Tolerances[Kind], Settings.MaxKeyStride);
+            const uint32_t KeyCount = GetKeyCount(Tracks.FrameCount, Track.Stride);
+            Track.Keys.resize(static_cast<size_t>(KeyCount) * KindChannelCount[Kind]);
+            for (uint32_t Key = 0; Key < KeyCount; Key++) {
+                ReadTrackValue(Tracks, GetKeyFrame(Key, Track.Stride, Tracks.FrameCount), Bone, Kind,
+                        &Track.Keys[static_cast<size_t>(Key) * KindChannelCount[Kind]]);
+            }
+            AnimatedTracks.push_back(std::move(Track));
+        }
+    }
+    // Groups: tracks of the same kind and key stride (in bone order within a group)
+    //
+    std::stable_sort(AnimatedTracks.begin(), AnimatedTracks.end(),
+            [](const FEncodedTrack & A, const FEncodedTrack & B) {
+                return (A.Kind != B.Kind) ? A.Kind < B.Kind : A.Stride < B.Stride;
+            });
+    std::vector<std::pair<size_t, size_t>> GroupRanges;
+    for (size_t Begin = 0; Begin < AnimatedTracks.size();) {
+        size_t End = Begin + 1;
+        while ((End < AnimatedTracks.size()) && (AnimatedTracks[End].Kind == AnimatedTracks[Begin].Kind)
+                && (AnimatedTracks[End].Stride == AnimatedTracks[Begin].Stride)) {
+            End++;
+        }
+        GroupRanges.emplace_back(Begin, End);
+        Begin = End;
+    }
+
+    FWriter Writer;
+    Writer.Write(ClipMagic);
+    Writer.Write(ClipVersion);
+    Writer.Write(Tracks.BoneCount);
+    Writer.Write(Tracks.FrameCount);
+    Writer.Write(Tracks.FrameRate);
+    Writer.Write(BlockKeys);
+    Writer.Write(static_cast<uint32_t>(GroupRanges.size()));
+    Writer.Write(0u);    // Total size (patched at the end)
+    Writer.Buffer.insert(Writer.Buffer.end(), BoneFlags.begin(), BoneFlags.end());
+    Writer.Align();
+    for (const float StaticValue: StaticValues) {
+        Writer.Write(StaticValue);
+    }
+    const uint32_t GroupTableOffset = Writer.Offset();
+    Writer.Buffer.resize(Writer.Buffer.size() + GroupRanges.size() * GroupWords * sizeof(uint32_t), 0);
+
+    for (size_t GroupIndex = 0; GroupIndex < GroupRanges.size(); GroupIndex++) {
+        const auto [Begin, End] = GroupRanges[GroupIndex];
+        const uint32_t Kind = AnimatedTracks[Begin].Kind;
+        const uint32_t Stride = AnimatedTracks[Begin].Stride;
+        const uint32_t TrackCount = static_cast<uint32_t>(End - Begin);
+        const uint32_t PaddedTrackCount = AlignUp(TrackCount, TracksPerRegister);
+        const uint32_t KeyCount = GetKeyCount(Tracks.FrameCount, Stride);
+        const uint32_t ComponentCount = RotationKind == Kind ? 4 : 3;
+        const uint32_t BlockCount = (KeyCount + BlockKeys - 1) / BlockKeys;
+
+        // Bone indices
+        //
+        const uint32_t BonesOffset = Writer.Offset();
+        for (uint32_t t = 0; t < PaddedTrackCount; t++) {
+            Writer.Write(static_cast<uint16_t>(t < TrackCount ? AnimatedTracks[Begin + t].Bone : 0));
+        }
+        Writer.Align();
+        // Dequantization parameters: translation/scale tracks only (rotations use the fixed smallest three range)
+        //
+        std::vector<float> Min(static_cast<size_t>(3) * PaddedTrackCount, 0.0f);
+        std::vector<float> Step(static_cast<size_t>(3) * PaddedTrackCount, 0.0f);
+        uint32_t ParamsOffset = 0;
+        if (RotationKind != Kind) {
+            for (uint32_t t = 0; t < TrackCount; t++) {
+                const auto & Keys = AnimatedTracks[Begin + t].Keys;
+                for (uint32_t c = 0; c < 3; c++) {
+                    float Low = Keys[c];
+                    float High = Keys[c];
+                    for (uint32_t Key = 1; Key < KeyCount; Key++) {
+                        Low = std::min(Low, Keys[Key * 3 + c]);
+                        High = std::max(High, Keys[Key * 3 + c]);
+                    }
+                    Min[c * PaddedTrackCount + t] = Low;
+                    Step[c * PaddedTrackCount + t] = (High - Low) / QuantizationLevels;
+                }
+            }
+            ParamsOffset = Writer.Offset();
+            for (const float Param: Min) {
+                Writer.Write(Param);
+            }
+            for (const float Param: Step) {
+                Writer.Write(Param);
+            }
+        }
+        // Quantized keys: [Key][Component][Track]
+        //
+        std::vector<uint16_t> Quantized(static_cast<size_t>(KeyCount) * ComponentCount * PaddedTrackCount, 0);
+        for (uint32_t t = 0; t < TrackCount; t++) {
+            const auto & Track = AnimatedTracks[Begin + t];
+            const float TrackMin[3] = {Min[t], Min[PaddedTrackCount + t], Min[2 * PaddedTrackCount + t]};
+            const float TrackStep[3] = {Step[t], Step[PaddedTrackCount + t], Step[2 * PaddedTrackCount + t]};
+            for (uint32_t Key = 0; Key < KeyCount; Key++) {
+                uint16_t Components[MaxComponents];
+                QuantizeKey(Kind, &Track.Keys[static_cast<size_t>(Key) * KindChannelCount[Kind]], TrackMin, TrackStep,
+                        Components);
+                for (uint32_t c = 0; c < ComponentCount; c++) {
+                    Quantized[(static_cast<size_t>(Key) * ComponentCount + c) * PaddedTrackCount + t] = Components[c];
+                }
+            }
+        }
+        // Delta-coded blocks
+        //
+        const uint32_t BlockOffsetsOffset = Writer.Offset();
+        Writer.Buffer.resize(Writer.Buffer.size() + BlockCount * sizeof(uint32_t), 0);
+        for (uint32_t Block = 0; Block < BlockCount; Block++) {
+            Writer.WriteAt(BlockOffsetsOffset + Block * sizeof(uint32_t), Writer.Offset());
+            const uint32_t FirstKey = Block * BlockKeys;
+            const uint32_t BlockKeyCount = std::min(BlockKeys, KeyCount - FirstKey);
+            const auto GetQuantized = [&](const uint32_t Key, const uint32_t c, const uint32_t t) {
+                return Quantized[(static_cast<size_t>(Key) * ComponentCount + c) * PaddedTrackCount + t];
+            };
+            const auto GetDelta = [&](const uint32_t Key, const uint32_t c, const uint32_t t) {
+                const uint16_t Difference = GetQuantized(Key, c, t) - GetQuantized(Key - 1, c, t);
+                return static_cast<int16_t>(Difference);
+            };
+            uint8_t Widths[MaxComponents] = {1, 1, 1, 1};
+            for (uint32_t c = 0; c < ComponentCount; c++) {
+                for (uint32_t Key = FirstKey + 1; (1 == Widths[c]) && (Key < FirstKey + BlockKeyCount); Key++) {
+                    for (uint32_t t = 0; t < TrackCount; t++) {
+                        const int16_t Delta = GetDelta(Key, c, t);
+                        if ((INT8_MIN > Delta) || (INT8_MAX < Delta)) {
+                            Widths[c] = 2;
+                            break;
+                        }
+                    }
+                }
+            }
+            Writer.Write(Widths);
+            for (uint32_t c = 0; c < ComponentCount; c++) {
+                for (uint32_t t = 0; t < PaddedTrackCount; t++) {
+                    Writer.Write(GetQuantized(FirstKey, c, t));
+                }
+                for (uint32_t Key = FirstKey + 1; Key < FirstKey + BlockKeyCount; Key++) {
+                    for (uint32_t t = 0; t < PaddedTrackCount; t++) {
+                        const int16_t Delta = GetDelta(Key, c, t);
+                        if (1 == Widths[c]) {
+                            Writer.Write(static_cast<int8_t>(Delta));
+                        } else {
+                            Writer.Write(Delta);
+                        }
+                    }
+                }
+            }
+            Writer.Align();
+        }
+        const uint32_t GroupEntry[GroupWords] = {Kind, Stride, TrackCount, PaddedTrackCount, KeyCount, ComponentCount,
+                BonesOffset, ParamsOffset, BlockOffsetsOffset};
+        Writer.WriteAt(GroupTableOffset + GroupIndex * sizeof(GroupEntry), GroupEntry);
+    }
+    Writer.WriteAt((HeaderWords - 1) * sizeof(uint32_t), Writer.Offset());
+    return std::move(Writer.Buffer);
+}
+
+bool FSignTrackDecoder::Open(const uint8_t * InData, const size_t InSize) {
+    uint32_t Header[HeaderWords];
+    if ((nullptr == InData) || (InSize < sizeof(Header)) || (0 != reinterpret_cast<uintptr_t>(InData) % 4)) {
+        return false;
+    }
+    std::memcpy(Header, InData, sizeof(Header));
+    if ((ClipMagic != Header[0]) || (ClipVersion != Header[1]) || (InSize < Header[7]) || (0 == Header[2])
+            || (0 == Header[3]) || (2 > Header[5])) {
+        return false;
+    }
+    Data = InData;
+    Size = InSize;
+    BoneCount = Header[2];
+    PaddedBoneCount = AlignUp(BoneCount, FloatsPerRegister);
+    FrameCount = Header[3];
+    std::memcpy(&FrameRate, &Header[4], sizeof(float));
+    BlockKeys = Header[5];
+    const uint32_t GroupCount = Header[6];
+
+    // Base pose: identities, overwritten by the static tracks
+    //
+    const uint8_t * BoneFlags = Data + sizeof(Header);
+    uint32_t Offset = AlignUp(static_cast<uint32_t>(sizeof(Header)) + BoneCount, 4);
+    BasePose.assign(static_cast<size_t>(CHANNEL_COUNT) * PaddedBoneCount, 0.0f);
+    for (uint32_t Bone = 0; Bone < PaddedBoneCount; Bone++) {
+        for (uint32_t Kind = 0; Kind < KindCount; Kind++) {
+            const bool Stored = (Bone < BoneCount) && (0 != (BoneFlags[Bone] & StaticFlag(Kind)));
+            if (Stored && (Offset + KindChannelCount[Kind] * sizeof(float) > Size)) {
+                return false;
+            }
+            for (uint32_t c = 0; c < KindChannelCount[Kind]; c++) {
+                float Value = KindIdentity[Kind][c];
+                if (Stored) {
+                    std::memcpy(&Value, Data + Offset, sizeof(float));
+                    Offset += sizeof(float);
+                }
+                BasePose[(KindFirstChannel[Kind] + c) * PaddedBoneCount + Bone] = Value;
+            }
+        }
+    }
+    Groups.clear();
+    if (Offset + GroupCount * GroupWords * sizeof(uint32_t) > Size) {
+        return false;
+    }
+    for (uint32_t GroupIndex = 0; GroupIndex < GroupCount; GroupIndex++) {
+        uint32_t Entry[GroupWords];
+        std::memcpy(Entry, Data + Offset + GroupIndex * sizeof(Entry), sizeof(Entry));
+        FGroup Group;
+        Group.Kind = static_cast<ETrackKind>(Entry[0]);
+        Group.Stride = Entry[1];
+        Group.TrackCount = Entry[2];
+        Group.PaddedTrackCount = Entry[3];
+        Group.KeyCount = Entry[4];
+        Group.ComponentCount = Entry[5];
+        if ((KindCount <= Entry[0]) || (0 == Group.Stride) || (0 == Group.KeyCount)
+                || (MaxComponents < Group.ComponentCount) || (0 != Group.PaddedTrackCount % TracksPerRegister)
+                || (Size <= Entry[6]) || (Size <= Entry[8])) {
+            return false;
+        }
+        Group.Bones = reinterpret_cast<const uint16_t *>(Data + Entry[6]);
+        Group.Params = 0 == Entry[7] ? nullptr : reinterpret_cast<const float *>(Data + Entry[7]);
+        Group.BlockOffsets = reinterpret_cast<const uint32_t *>(Data + Entry[8]);
+        Groups.push_back(Group);
+    }
+    return true;
+}
+
+// Replays the block of Key: its absolute key plus the deltas up to Key, for every component and track at once
+//
+void FSignTrackDecoder::DecodeKey(const FGroup & Group, const uint32_t Key, uint16_t * Out) const {
+    const uint32_t Block = Key / BlockKeys;
+    const uint32_t Row = Key % BlockKeys;
+    const uint32_t BlockKeyCount = std::min(BlockKeys, Group.KeyCount - Block * BlockKeys);
+    const uint32_t Tracks = Group.PaddedTrackCount;
+    const uint8_t * Widths = Data + Group.BlockOffsets[Block];
+    const uint8_t * Component = Widths + MaxComponents;
+    for (uint32_t c = 0; c < Group.ComponentCount; c++) {
+        const uint8_t * Deltas = Component + Tracks * sizeof(uint16_t);
+        uint16_t * Values = Out + c * Tracks;
+#if defined(__AVX2__)
+        for (uint32_t t = 0; t < Tracks; t += TracksPerRegister) {
+            __m256i Sum = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(Component + t * sizeof(uint16_t)));
+            for (uint32_t r = 0; r < Row; r++) {
+                const uint8_t * Row8 = Deltas + r * Tracks + t;
+                const uint8_t * Row16 = Deltas + (r * Tracks + t) * 2;
+                const __m256i Delta = 1 == Widths[c]
+                        ? _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Row8)))
+                        : _mm256_loadu_si256(reinterpret_cast<const __m256i *>(Row16));
+                Sum = _mm256_add_epi16(Sum, Delta);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(Values + t), Sum);
+        }
+#else
+        std::memcpy(Values, Component, Tracks * sizeof(uint16_t));
+        for (uint32_t r = 0; r < Row; r++) {
+            for (uint32_t t = 0; t < Tracks; t++) {
+                int16_t Delta;
+                if (1 == Widths[c]) {
+                    Delta = static_cast<int8_t>(Deltas[r * Tracks + t]);
+                } else {
+                    std::memcpy(&Delta, Deltas + (r * Tracks + t) * 2, sizeof(Delta));
+                }
+                Values[t] = static_cast<uint16_t>(Values[t] + Delta);
+            }
+        }
+#endif
+        Component = Deltas + static_cast<size_t>(BlockKeyCount - 1) * Tracks * Widths[c];
+    }
+}
+
+// Decodes the two keys around FramePosition, dequantizes and interpolates them and scatters the tracks into the pose
+//
+void FSignTrackDecoder::DecodeGroup(const FGroup & Group, const float FramePosition, float * Out) const {
+    thread_local std::vector<uint16_t> KeyValues;
+    thread_local std::vector<float> Interpolated;
+    const uint32_t Tracks = Group.PaddedTrackCount;
+    KeyValues.resize(static_cast<size_t>(2) * MaxComponents * Tracks);
+    Interpolated.resize(static_cast<size_t>(MaxComponents) * Tracks);
+    uint32_t Key0;
+    uint32_t Key1;
+    float Alpha;
+    GetKeyInterval(FramePosition, Group.Stride, Group.KeyCount, FrameCount, Key0, Key1, Alpha);
+    uint16_t * Values0 = KeyValues.data();
+    uint16_t * Values1 = Values0 + MaxComponents * Tracks;
+    DecodeKey(Group, Key0, Values0);
+    DecodeKey(Group, Key1, Values1);
+    const uint32_t Kind = static_cast<uint32_t>(Group.Kind);
+    float * Result = Interpolated.data();
+    if (ETrackKind::ROTATION != Group.Kind) {
+        const float * Min = Group.Params;
+        const float * Step = Group.Params + 3 * Tracks;
+        for (uint32_t i = 0; i < 3 * Tracks; i += FloatsPerRegister) {
+#if defined(__AVX2__)
+            const __m256 Q0 = _mm256_cvtepi32_ps(
+                    _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Values0 + i))));
+            const __m256 Q1 = _mm256_cvtepi32_ps(
+                    _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Values1 + i))));
+            const __m256 MinV = _mm256_loadu_ps(Min + i);
+            const __m256 StepV = _mm256_loadu_ps(Step + i);
+            const __m256 V0 = _mm256_add_ps(MinV, _mm256_mul_ps(Q0, StepV));
+            const __m256 V1 = _mm256_add_ps(MinV, _mm256_mul_ps(Q1, StepV));
+            const __m256 Delta = _mm256_sub_ps(V1, V0);
+            _mm256_storeu_ps(Result + i, _mm256_add_ps(V0, _mm256_mul_ps(_mm256_set1_ps(Alpha), Delta)));
+#else
+            for (uint32_t j = i; j < i + FloatsPerRegister; j++) {
+                const float V0 = Min[j] + static_cast<float>(Values0[j]) * Step[j];
+                const float V1 = Min[j] + static_cast<float>(Values1[j]) * Step[j];
+                Result[j] = V0 + Alpha * (V1 - V0);
+            }
+#endif
+        }
+    } else {
+        const float Scale = 2.0f * SmallestThreeRange / QuantizationLevels;
+        for (uint32_t t = 0; t < Tracks; t += FloatsPerRegister) {
+#if defined(__AVX2__)
+            const auto LoadComponent = [t, Tracks](const uint16_t * Values, const uint32_t c) {
+                const uint16_t * Component = Values + c * Tracks + t;
+                return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Component)));
+            };
+            // Smallest three: rebuild the dropped component, then put it back at its index
+            //
+            const auto Rebuild = [&LoadComponent, Scale](const uint16_t * Values, __m256 * Quat) {
+                const __m256 ScaleV = _mm256_set1_ps(Scale);
+                const __m256 Offset = _mm256_set1_ps(-SmallestThreeRange);
+                const auto Dequantize = [&](const uint32_t c) {
+                    return _mm256_add_ps(Offset, _mm256_mul_ps(_mm256_cvtepi32_ps(LoadComponent(Values, c)), ScaleV));
+                };
+                const __m256i Index = LoadComponent(Values, 0);
+                const __m256 A = Dequantize(1);
+                const __m256 B = Dequantize(2);
+                const __m256 C = Dequantize(3);
+                const __m256 SumSquares =
+                        _mm256_add_ps(_mm256_mul_ps(A, A), _mm256_add_ps(_mm256_mul_ps(B, B), _mm256_mul_ps(C, C)));
+                const __m256 Remainder = _mm256_sub_ps(_mm256_set1_ps(1.0f), SumSquares);
+                const __m256 Dropped = _mm256_sqrt_ps(_mm256_max_ps(_mm256_setzero_ps(), Remainder));
+                const __m256 Is0 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(Index, _mm256_set1_epi32(0)));
+                const __m256 Is1 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(Index, _mm256_set1_epi32(1)));
+                const __m256 Is2 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(Index, _mm256_set1_epi32(2)));
+                const __m256 Is3 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(Index, _mm256_set1_epi32(3)));
+                const __m256 Below2 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(2), Index));
+                Quat[0] = _mm256_blendv_ps(A, Dropped, Is0);
+                Quat[1] = _mm256_blendv_ps(_mm256_blendv_ps(B, A, Is0), Dropped, Is1);
+                Quat[2] = _mm256_blendv_ps(_mm256_blendv_ps(C, B, Below2), Dropped, Is2);
+                Quat[3] = _mm256_blendv_ps(C, Dropped, Is3);
+            };
+            __m256 Q0[4];
+            __m256 Q1[4];
+            Rebuild(Values0, Q0);
+            Rebuild(Values1, Q1);
+            // Shorter direction: flip the second key where the keys are in opposite hemispheres
+            //
+            const __m256 Dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Q0[0], Q1[0]), _mm256_mul_ps(Q0[1], Q1[1])),
+                    _mm256_add_ps(_mm256_mul_ps(Q0[2], Q1[2]), _mm256_mul_ps(Q0[3], Q1[3])));
+            const __m256 FlipSign =
+                    _mm256_and_ps(_mm256_cmp_ps(Dot, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+            const __m256 AlphaV = _mm256_set1_ps(Alpha);
+            __m256 Quat[4];
+            __m256 LengthSquared = _mm256_setzero_ps();
+            for (uint32_t c = 0; c < 4; c++) {
+                const __m256 Delta = _mm256_sub_ps(_mm256_xor_ps(Q1[c], FlipSign), Q0[c]);
+                Quat[c] = _mm256_add_ps(Q0[c], _mm256_mul_ps(AlphaV, Delta));
+                LengthSquared = _mm256_add_ps(LengthSquared, _mm256_mul_ps(Quat[c], Quat[c]));
+            }
+            LengthSquared = _mm256_max_ps(LengthSquared, _mm256_set1_ps(MinQuatLengthSquared));
+            const __m256 InverseLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(LengthSquared));
+            for (uint32_t c = 0; c < 4; c++) {
+                _mm256_storeu_ps(Result + c * Tracks + t, _mm256_mul_ps(Quat[c], InverseLength));
+            }
+#else
+            for (uint32_t j = t; j < t + FloatsPerRegister; j++) {
+                float Quat[2][4];
+                const uint16_t * Keys[2] = {Values0, Values1};
+                for (uint32_t k = 0; k < 2; k++) {
+                    const uint32_t Index = Keys[k][j];
+                    float Stored[3];
+                    for (uint32_t c = 0; c < 3; c++) {
+                        Stored[c] = static_cast<float>(Keys[k][(c + 1) * Tracks + j]) * Scale - SmallestThreeRange;
+                    }
+                    const float SumSquares = Stored[0] * Stored[0] + Stored[1] * Stored[1] + Stored[2] * Stored[2];
+                    const float Dropped = std::sqrt(std::max(0.0f, 1.0f - SumSquares));
+                    for (uint32_t c = 0, s = 0; c < 4; c++) {
+                        Quat[k][c] = c == Index ? Dropped : Stored[s++];
+                    }
+                }
+                float Value[4];
+                InterpolateValue(RotationKind, Quat[0], Quat[1], Alpha, Value);
+                for (uint32_t c = 0; c < 4; c++) {
+                    Result[c * Tracks + j] = Value[c];
+                }
+            }
+#endif
+        }
+    }
+    const uint32_t FirstChannel = KindFirstChannel[Kind];
+    for (uint32_t c = 0; c < KindChannelCount[Kind]; c++) {
+        float * Channel = Out + (FirstChannel + c) * PaddedBoneCount;
+        const float * Source = Result + c * Tracks;
+        for (uint32_t t = 0; t < Group.TrackCount; t++) {
+            Channel[Group.Bones[t]] = Source[t];
+        }
+    }
+}
+
+void FSignTrackDecoder::Decode(const float Time, float * Out) const {
+    std::memcpy(Out, BasePose.data(), BasePose.size() * sizeof(float));
+    const float FramePosition = std::clamp(Time * FrameRate, 0.0f, static_cast<float>(FrameCount - 1));
+    for (const auto & Group: Groups) {
+        DecodeGroup(Group, FramePosition, Out);
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Engine-independent codec for ASL sign pose tracks (standard C++ only, so that it also builds into the headless
+// benchmark in Tools/SignCodecBenchmark). Signing mostly moves the hand and finger bones while the rest of the skeleton
+// is near-static, so a clip is encoded as:
+// - Static tracks: a translation, rotation or scale track that doesn't move (within tolerance) is stored once - or not
+//   at all if it's the identity
+// - Keyframe reduction: each animated track keeps every 2nd, 4th or 8th key when linear interpolation reproduces the
+//   dropped ones within tolerance. Tracks with the same kind and key stride form a group
+// - Quantization: rotations as "smallest three" (the largest quaternion component is dropped and rebuilt from the
+//   other three, which are stored in 16 bits each); translations and scales in 16 bits within each track's range
+// - Delta coding: per group, blocks of BlockKeys keys hold one absolute key and the differences to the previous key,
+//   in 8 bits when the whole block allows it (else 16)
+// Decoding is random access by time (at most one block is replayed per group) and processes 16 (deltas) or 8 (floats)
+// tracks per AVX2 instruction when available.
+//
+// Pose layout (raw tracks and decoded poses): CHANNEL_COUNT arrays - translation XYZ, rotation XYZW, scale XYZ - with
+// the bones contiguous (as FSignPoseTracks)
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ASLMetaHuman::Codec {
+
+enum ESignTrackChannel : uint32_t {
+    TRANSLATION_X,
+    TRANSLATION_Y,
+    TRANSLATION_Z,
+    ROTATION_X,
+    ROTATION_Y,
+    ROTATION_Z,
+    ROTATION_W,
+    SCALE_X,
+    SCALE_Y,
+    SCALE_Z,
+    CHANNEL_COUNT
+};
+
+// Uncompressed key frames of one sign: Values holds FrameCount poses of CHANNEL_COUNT x BoneCount floats
+//
+struct FRawSignTracks {
+    uint32_t BoneCount {0};
+    uint32_t FrameCount {0};
+    float FrameRate {0.0f};
+    std::vector<float> Values;
+
+    float Get(const uint32_t Frame, const uint32_t Channel, const uint32_t Bone) const {
+        return Values[(static_cast<size_t>(Frame) * CHANNEL_COUNT + Channel) * BoneCount + Bone];
+    }
+};
+
+// Raw track files (as exported by the SignTracks commandlet): a small header followed by the values
+//
+std::vector<uint8_t> SerializeRawSignTracks(const FRawSignTracks & Tracks);
+bool DeserializeRawSignTracks(const uint8_t * Data, const size_t Size, FRawSignTracks & Tracks);
+
+struct FSignTrackCodecSettings {
+    // Largest error allowed by static track elimination and keyframe reduction: centimeters for translations,
+    // quaternion components for rotations, scale factor for scales
+    //
+    float TranslationTolerance {0.01f};
+    float RotationTolerance {0.0005f};
+    float ScaleTolerance {0.001f};
+    // Largest key stride tried by keyframe reduction (1, 2, 4 or 8)
+    //
+    uint32_t MaxKeyStride {8};
+    // Keys per delta-coded block (random access replays at most this many keys)
+    //
+    uint32_t BlockKeys {16};
+};
+
+// Returns the encoded clip (one contiguous buffer, readable in place by FSignTrackDecoder); empty if Tracks is invalid
+//
+std::vector<uint8_t> EncodeSignTracks(const FRawSignTracks & Tracks, const FSignTrackCodecSettings & Settings = {});
+
+// Reads an encoded clip in place (e.g. from a memory-mapped file): the buffer must outlive the decoder and stay
+// 4-byte aligned. Decode() is thread-safe
+//
+class FSignTrackDecoder {
+public:
+    bool Open(const uint8_t * InData, const size_t InSize);
+
+    uint32_t GetBoneCount() const {
+        return BoneCount;
+    }
+
+    // Bone count rounded up to a full AVX2 register (8 floats); the stride between the channels of a decoded pose
+    //
+    uint32_t GetPaddedBoneCount() const {
+        return PaddedBoneCount;
+    }
+
+    uint32_t GetFrameCount() const {
+        return FrameCount;
+    }
+
+    float GetFrameRate() const {
+        return FrameRate;
+    }
+
+    float GetPlayLength() const {
+        return 1 < FrameCount ? static_cast<float>(FrameCount - 1) / FrameRate : 0.0f;
+    }
+
+    // Decodes all bones at Time (seconds, clamped to the clip) into Out: CHANNEL_COUNT x GetPaddedBoneCount() floats
+    //
+    void Decode(const float Time, float * Out) const;
+
+private:
+    enum class ETrackKind : uint32_t { TRANSLATION, ROTATION, SCALE };
+
+    struct FGroup {
+        ETrackKind Kind {ETrackKind::TRANSLATION};
+        uint32_t Stride {1};
+        uint32_t TrackCount {0};
+        uint32_t PaddedTrackCount {0};
+        uint32_t KeyCount {0};
+        uint32_t ComponentCount {0};
+        const uint16_t * Bones {nullptr};
+        const float * Params {nullptr};
+        const uint32_t * BlockOffsets {nullptr};
+    };
+
+    void DecodeKey(const FGroup & Group, const uint32_t Key, uint16_t * Out) const;
+    void DecodeGroup(const FGroup & Group, const float FramePosition, float * Out) const;
+
+    const uint8_t * Data {nullptr};
+    size_t Size {0};
+    uint32_t BoneCount {0};
+    uint32_t PaddedBoneCount {0};
+    uint32_t FrameCount {0};
+    float FrameRate {0.0f};
+    uint32_t BlockKeys {0};
+    std::vector<FGroup> Groups;
+
+    // Static tracks and identities: the pose that decoding starts from
+    //
+    std::vector<float> BasePose;
+};
+}
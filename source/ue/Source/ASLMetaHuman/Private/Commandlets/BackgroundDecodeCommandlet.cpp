@@ -0,0 +1,208 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Loads a background image through the worker-thread decode path and reports its timings
+//
+
+#include "BackgroundDecodeCommandlet.h"
+#include "Config/InternalSettings.h"
+#include "Core/BackgroundImageLoader.h"
+#include "Core/StartupGraph.h"
+
+#include <Async/Async.h>
+#include <Containers/Ticker.h>
+#include <HttpManager.h>
+#include <HttpModule.h>
+
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::AwsSdkStartupPhase;
+using ASLMetaHuman::Core::FBackgroundImageIngest;
+using ASLMetaHuman::Core::FBackgroundImageLoader;
+using ASLMetaHuman::Core::FBackgroundTextureCache;
+using ASLMetaHuman::Core::FCrtS3Downloader;
+using ASLMetaHuman::Core::FStartupGraph;
+
+namespace {
+constexpr auto & ImageParameter = TEXT("Image=");
+constexpr auto & S3Switch = TEXT("S3");
+constexpr auto & CompareSwitch = TEXT("Compare");
+constexpr auto & RunsParameter = TEXT("Runs=");
+constexpr auto & SizeParameter = TEXT("Size=");
+constexpr auto & FormatParameter = TEXT("Format=");
+constexpr float TickSeconds = 0.01f;
+constexpr float AwsSdkWaitSeconds = 30.0f;
+constexpr int32 DefaultRuns = 1;
+constexpr int64 BytesPerMB {1024 * 1024};
+constexpr auto & ErrorUsage = TEXT("Usage: -run=BackgroundDecode -Image=<files or http(s) URLs, comma-separated> [-S3|-Compare] [-Runs=<cold loads per URL>] [-Size=<width>x<height>] [-Format=BC7|BC1|BGRA8]");
+constexpr auto & ErrorNoDownloader = TEXT("The CRT S3 client couldn't be created (AWS SDK not initialized?)");
+constexpr auto & ErrorReadFailedFormatted = TEXT("Failed to read %s");
+constexpr auto & ErrorLoadFailedFormatted = TEXT("Failed to load the background image %s");
+constexpr auto & InfoDecodedFormatted =
+        TEXT("Decoded %s from %.1f KB in %.1f ms (worker: %s), uploaded in %.2f ms (game thread)");
+constexpr auto & InfoTimeToTextureFormatted = TEXT("%s load %d: %.1f ms to texture (%s)");
+constexpr auto & InfoTimeToTextureCachedFormatted = TEXT("%s cached load: %.1f ms to texture (%s)");
+constexpr auto & InfoTimeToTextureSummaryFormatted =
+        TEXT("%s: median %.1f ms, min %.1f ms, max %.1f ms to texture over %d cold loads (%s)");
+
+const TCHAR * GetTransportName(const TSharedPtr<FCrtS3Downloader> & Downloader) {
+    return nullptr == Downloader ? TEXT("HTTP") : TEXT("S3 ranged GETs");
+}
+
+// Ticks HTTP, the core ticker (download timeouts) and the game thread's task queue until the load is done
+//
+UTexture2D * LoadUrl(const FString & Url,
+        const TSharedRef<FBackgroundTextureCache> & Cache,
+        const TSharedPtr<FCrtS3Downloader> & Downloader,
+        const FBackgroundImageIngest::FOptions & IngestOptions) {
+    UTexture2D * Texture = nullptr;
+    bool Done = false;
+    FBackgroundImageLoader::Load(Url, Cache, Downloader, IngestOptions, [&Texture, &Done](UTexture2D * LoadedTexture) {
+        Texture = LoadedTexture;
+        Done = true;
+    });
+    while (! Done) {
+        FHttpModule::Get().GetHttpManager().Tick(TickSeconds);
+        FTSTicker::GetCoreTicker().Tick(TickSeconds);
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FPlatformProcess::Sleep(TickSeconds);
+    }
+    if (nullptr == Texture) {
+        UE_LOG(LogTemp, Error, ErrorLoadFailedFormatted, *FBackgroundTextureCache::ToUrlKey(Url));
+    }
+    return Texture;
+}
+
+bool DecodeFile(const FString & Image, const FBackgroundImageIngest::FOptions & IngestOptions) {
+    TArray<uint8> ImageBytes;
+    if (! FFileHelper::LoadFileToArray(ImageBytes, *Image)) {
+        UE_LOG(LogTemp, Error, ErrorReadFailedFormatted, *Image);
+        return false;
+    }
+    auto & ImageWrapperModule = FBackgroundImageLoader::GetImageWrapperModule();
+    const double DecodeStartSeconds = FPlatformTime::Seconds();
+    FBackgroundImageIngest::FStats IngestStats;
+    UTexture2D * Texture = Async(EAsyncExecution::ThreadPool, [&]() {
+        return FBackgroundImageLoader::Decode(ImageWrapperModule, ImageBytes, IngestOptions, nullptr, IngestStats);
+    }).Get();
+    const double DecodeMs = (FPlatformTime::Seconds() - DecodeStartSeconds) * 1000.0;
+    if (nullptr == Texture) {
+        UE_LOG(LogTemp, Error, ErrorLoadFailedFormatted, *Image);
+        return false;
+    }
+    const double UploadStartSeconds = FPlatformTime::Seconds();
+    FBackgroundImageLoader::Upload(*Texture);
+    const double UploadMs = (FPlatformTime::Seconds() - UploadStartSeconds) * 1000.0;
+    UE_LOG(LogTemp, Display, InfoDecodedFormatted, *Image, ImageBytes.Num() / 1024.0, DecodeMs,
+            *IngestStats.ToString(), UploadMs);
+    Texture->RemoveFromRoot();
+    return true;
+}
+}
+
+UBackgroundDecodeCommandlet::UBackgroundDecodeCommandlet() {
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UBackgroundDecodeCommandlet::Main(const FString & Params) {
+    FString ImageList;
+    if (! FParse::Value(*Params, ImageParameter, ImageList, false)) {
+        UE_LOG(LogTemp, Error, ErrorUsage);
+        return 1;
+    }
+    TArray<FString> Images;
+    ImageList.ParseIntoArray(Images, TEXT(","));
+    // -Compare loads every URL over HTTP, then over S3 ranged GETs
+    //
+    const bool Compare = FParse::Param(*Params, CompareSwitch);
+    TArray<TSharedPtr<FCrtS3Downloader>> Downloaders;
+    if (Compare) {
+        Downloaders.Add(nullptr);
+    }
+    if (Compare || FParse::Param(*Params, S3Switch)) {
+        FInternalSettings::Update([](FInternalSettings::FSnapshot & Settings) {
+            Settings.BackgroundS3DownloadEnabled = true;
+        });
+        TSharedPtr<FCrtS3Downloader> Downloader;
+        if (FStartupGraph::Wait(AwsSdkStartupPhase, AwsSdkWaitSeconds)) {
+            Downloader = FBackgroundImageLoader::CreateDownloader();
+        }
+        if (nullptr == Downloader) {
+            UE_LOG(LogTemp, Error, ErrorNoDownloader);
+            return 1;
+        }
+        Downloaders.Add(Downloader);
+    } else {
+        Downloaders.Add(nullptr);
+    }
+    int32 Runs = DefaultRuns;
+    FParse::Value(*Params, RunsParameter, Runs);
+    Runs = FMath::Max(Runs, 1);
+    // Headless, there's no plane to size the images for: -Size stands in for its on-screen size
+    //
+    FString Format;
+    if (FParse::Value(*Params, FormatParameter, Format)) {
+        FInternalSettings::Update([&Format](FInternalSettings::FSnapshot & Settings) {
+            Settings.BackgroundIngestFormat = Format;
+        });
+    }
+    FBackgroundImageIngest::FOptions IngestOptions = FBackgroundImageIngest::GetOptions(nullptr);
+    FString Size;
+    FString Width;
+    FString Height;
+    if (FParse::Value(*Params, SizeParameter, Size) && Size.Split(TEXT("x"), &Width, &Height)) {
+        IngestOptions.TargetSize = FIntPoint(FCString::Atoi(*Width), FCString::Atoi(*Height));
+    }
+    // The loader logs its own timings. Each cold load starts from an empty cache (and texture pool), so it includes the
+    // download, decode and texture creation; a last load of the URL is served by the cache
+    //
+    const auto Cache = MakeShared<FBackgroundTextureCache>(
+            static_cast<int64>(FInternalSettings::GetBackgroundCacheBudgetMB()) * BytesPerMB,
+            FInternalSettings::GetBackgroundTexturePoolSize());
+    bool Loaded = true;
+    for (const auto & Image: Images) {
+        if (! (Image.StartsWith(TEXT("http://")) || Image.StartsWith(TEXT("https://")))) {
+            Loaded = DecodeFile(Image, IngestOptions) && Loaded;
+            continue;
+        }
+        const FString & UrlKey = FBackgroundTextureCache::ToUrlKey(Image);
+        for (const auto & Downloader: Downloaders) {
+            TArray<double> ColdMs;
+            for (int32 i = 0; i < Runs; i++) {
+                Cache->Clear();
+                const double StartSeconds = FPlatformTime::Seconds();
+                Loaded = (nullptr != LoadUrl(Image, Cache, Downloader, IngestOptions)) && Loaded;
+                ColdMs.Add((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+                UE_LOG(LogTemp, Display, InfoTimeToTextureFormatted, *UrlKey, i + 1, ColdMs.Last(),
+                        GetTransportName(Downloader));
+            }
+            const double StartSeconds = FPlatformTime::Seconds();
+            Loaded = (nullptr != LoadUrl(Image, Cache, Downloader, IngestOptions)) && Loaded;
+            UE_LOG(LogTemp, Display, InfoTimeToTextureCachedFormatted, *UrlKey,
+                    (FPlatformTime::Seconds() - StartSeconds) * 1000.0, GetTransportName(Downloader));
+            ColdMs.Sort();
+            UE_LOG(LogTemp, Display, InfoTimeToTextureSummaryFormatted, *UrlKey, ColdMs[ColdMs.Num() / 2], ColdMs[0],
+                    ColdMs.Last(), ColdMs.Num(), GetTransportName(Downloader));
+        }
+    }
+    Cache->LogStats();
+    Cache->Clear();
+    return Loaded ? 0 : 1;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Loads background images through the worker-thread decode path (see FBackgroundImageLoader) and reports their
+// timings; runs headless:
+//      UnrealEditor-Cmd.exe ASLMetaHuman.uproject -run=BackgroundDecode -Image=<files or http(s) URLs> [-S3|-Compare]
+//              [-Runs=<cold loads>] -nullrhi
+// Images are separated by commas. A URL goes through the whole path (download, worker decode, game-thread upload)
+// -Runs times from an empty cache, then once more served by the background texture cache (see its stats); the median,
+// min and max time to texture of the cold loads are reported. A file skips the download and the cache. -S3 downloads
+// with the CRT S3 client (parallel ranged GETs, see BackgroundS3PartSizeKB) instead of HTTP, -Compare with both: e.g.
+// compare the time to texture of 1-8 MB images presigned by a local S3-compatible stand-in (MinIO: mc share download).
+// The images are ingested (see FBackgroundImageIngest) as the settings say, resized to -Size=<width>x<height> (the
+// plane's on-screen size, unknown headless) and encoded as -Format=BC7|BC1|BGRA8 if given: the log reports the resize
+// and encode times and the compression ratio.
+//
+
+#include <Commandlets/Commandlet.h>
+#include "BackgroundDecodeCommandlet.generated.h"
+
+UCLASS()
+class UBackgroundDecodeCommandlet: public UCommandlet {
+    GENERATED_BODY()
+public:
+    UBackgroundDecodeCommandlet();
+    virtual int32 Main(const FString & Params) override;
+};
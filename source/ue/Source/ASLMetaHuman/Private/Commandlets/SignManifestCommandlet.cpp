@@ -0,0 +1,153 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Builds the sign manifest from the asset registry (loading a sequence only when its length isn't in the registry)
+//
+
+#include "SignManifestCommandlet.h"
+#include "Config/InternalSettings.h"
+#include "Core/ASLMetaHumanSignDictionary.h"
+#include "Core/SignManifest.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Animation/AnimSequence.h>
+
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::ASLMetaHumanSignDictionary;
+using ASLMetaHuman::Core::FSignManifest;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+const auto DefaultAnimationPath {TEXT("/Game/ASL_Animations")};
+const FName SequenceLengthTagName {"SequenceLength"};
+constexpr auto & AnimationPathParameter = TEXT("AnimationPath=");
+constexpr auto & OutputParameter = TEXT("Output=");
+constexpr auto & MeasureSwitch = TEXT("Measure");
+constexpr auto & SyntheticSignsParameter = TEXT("SyntheticSigns=");
+constexpr auto & SyntheticManifestFileName = TEXT("SignManifest.synthetic.bin");
+constexpr auto & ErrorNoSignsFormatted = TEXT("No animation sequences found in %s");
+constexpr auto & ErrorNoOutput = TEXT("No output path: pass -Output=<file> or set SignManifestPath");
+constexpr auto & ErrorWriteFailedFormatted = TEXT("Failed to write the sign manifest to %s");
+constexpr auto & InfoManifestWrittenFormatted = TEXT("Wrote %d signs (%d loaded for their length) to %s, dictionary hash %016llx");
+constexpr auto & InfoTimeToReadyFormatted = TEXT("Time to ready of %d signs: %.1f ms from the sign manifest, %.1f ms from the asset registry (%d signs)");
+
+// Initializes a sign dictionary (which logs its own time to ready) from ManifestPath, or from the asset registry if
+// it's empty. Returns the elapsed time in milliseconds
+//
+double MeasureInit(const FString & AnimationPath, const FString & ManifestPath) {
+    FInternalSettings::Update([&ManifestPath](FInternalSettings::FSnapshot & Settings) {
+        Settings.SignManifestPath = ManifestPath;
+    });
+    const double StartSeconds = FPlatformTime::Seconds();
+    ASLMetaHumanSignDictionary Dictionary;
+    Dictionary.Init(AnimationPath);
+    return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+}
+
+// Grows the vocabulary to NumSigns by copying its signs under new names (pointing at the same sequences), so that the
+// manifest path can be measured at the size of a full dictionary without authoring its animations
+//
+void AddSyntheticSigns(TArray<FSignManifest::FEntry> & Entries, const int32 NumSigns) {
+    const int32 NumRealSigns = Entries.Num();
+    for (int32 i = NumRealSigns; i < NumSigns; i++) {
+        FSignManifest::FEntry Entry = Entries[i % NumRealSigns];
+        Entry.SignName += FString::Printf(TEXT("~%d"), i / NumRealSigns);
+        Entries.Add(MoveTemp(Entry));
+    }
+}
+}
+
+USignManifestCommandlet::USignManifestCommandlet() {
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 USignManifestCommandlet::Main(const FString & Params) {
+    FString AnimationPath {DefaultAnimationPath};
+    FParse::Value(*Params, AnimationPathParameter, AnimationPath);
+    FString OutputPath = FInternalSettings::GetSignManifestPath();
+    FParse::Value(*Params, OutputParameter, OutputPath);
+    if (OutputPath.IsEmpty()) {
+        UE_LOG(LogTemp, Error, ErrorNoOutput);
+        return 1;
+    }
+    if (FPaths::IsRelative(OutputPath)) {
+        OutputPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), OutputPath);
+    }
+    TArray<FAssetData> AssetDataList;
+    if (! UnrealAPI::GetAssetData<UAnimSequence>(AnimationPath, AssetDataList)) {
+        UE_LOG(LogTemp, Error, ErrorNoSignsFormatted, *AnimationPath);
+        return 1;
+    }
+    TArray<FSignManifest::FEntry> Entries;
+    Entries.Reserve(AssetDataList.Num());
+    int32 LoadedCount = 0;
+    for (const auto & AssetData: AssetDataList) {
+        FSignManifest::FEntry Entry;
+        Entry.SignName = ASLMetaHumanSignDictionary::ToSignName(AssetData.AssetName.ToString());
+        Entry.ObjectPath = AssetData.GetSoftObjectPath().ToString();
+        Entry.WordCount = ASLMetaHumanSignDictionary::CountWords(Entry.SignName);
+        if (! AssetData.GetTagValue(SequenceLengthTagName, Entry.PlayLength)) {
+            const auto Sequence = Cast<UAnimSequence>(AssetData.GetAsset());
+            Entry.PlayLength = nullptr == Sequence ? 0.0f : Sequence->GetPlayLength();
+            LoadedCount++;
+        }
+        Entries.Add(MoveTemp(Entry));
+    }
+    const int32 NumSigns = Entries.Num();
+    int32 NumSyntheticSigns = 0;
+    FParse::Value(*Params, SyntheticSignsParameter, NumSyntheticSigns);
+    TArray<FSignManifest::FEntry> SyntheticEntries;
+    if (NumSyntheticSigns > NumSigns) {
+        SyntheticEntries = Entries;
+        AddSyntheticSigns(SyntheticEntries, NumSyntheticSigns);
+    }
+    const uint64 DictionaryHash = FSignManifest::Write(OutputPath, MoveTemp(Entries));
+    if (0 == DictionaryHash) {
+        UE_LOG(LogTemp, Error, ErrorWriteFailedFormatted, *OutputPath);
+        return 1;
+    }
+    UE_LOG(LogTemp, Display, InfoManifestWrittenFormatted, NumSigns, LoadedCount, *OutputPath, DictionaryHash);
+    if (! FParse::Param(*Params, MeasureSwitch)) {
+        return 0;
+    }
+    // Time to ready before (asset registry) and after (manifest). Note: the asset registry is already scanned at this
+    // point (as in a running game once it's done), so the former is its indexing cost only. A synthetic vocabulary
+    // (-SyntheticSigns) is written next to the project's intermediate files and only used from the manifest
+    //
+    FString MeasuredManifestPath = OutputPath;
+    int32 MeasuredSigns = NumSigns;
+    if (! SyntheticEntries.IsEmpty()) {
+        MeasuredManifestPath = FPaths::Combine(FPaths::ProjectIntermediateDir(), SyntheticManifestFileName);
+        MeasuredSigns = SyntheticEntries.Num();
+        if (0 == FSignManifest::Write(MeasuredManifestPath, MoveTemp(SyntheticEntries))) {
+            UE_LOG(LogTemp, Error, ErrorWriteFailedFormatted, *MeasuredManifestPath);
+            return 1;
+        }
+    }
+    const FString SavedManifestPath = FInternalSettings::GetSignManifestPath();
+    const double ManifestMs = MeasureInit(AnimationPath, MeasuredManifestPath);
+    const double AssetRegistryMs = MeasureInit(AnimationPath, TEXT(""));
+    FInternalSettings::Update([&SavedManifestPath](FInternalSettings::FSnapshot & Settings) {
+        Settings.SignManifestPath = SavedManifestPath;
+    });
+    UE_LOG(LogTemp, Display, InfoTimeToReadyFormatted, MeasuredSigns, ManifestMs, AssetRegistryMs, NumSigns);
+    return 0;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Writes the prebuilt ASL sign manifest (see Core/SignManifest.h) from the animation sequences of the project. Run it
+// before cooking whenever signs are added, renamed or re-timed:
+//      UnrealEditor-Cmd.exe ASLMetaHuman.uproject -run=SignManifest [-AnimationPath=/Game/ASL_Animations] [-Output=<file>]
+// The output defaults to SignManifestPath (ASLMetaHuman.ini). -Measure then logs the time to ready of the sign
+// dictionary from the manifest and from the asset registry; -SyntheticSigns=<count> (e.g. 10000) measures the manifest
+// with the vocabulary grown to that many signs by renamed copies.
+//
+
+#include <Commandlets/Commandlet.h>
+#include "SignManifestCommandlet.generated.h"
+
+UCLASS()
+class USignManifestCommandlet: public UCommandlet {
+    GENERATED_BODY()
+public:
+    USignManifestCommandlet();
+    virtual int32 Main(const FString & Params) override;
+};
@@ -0,0 +1,135 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Encodes the sign animation sequences into a sign pack
+//
+
+#include "SignPackCommandlet.h"
+#include "Config/InternalSettings.h"
+#include "Core/ASLMetaHumanSignDictionary.h"
+#include "Core/SignPack.h"
+#include "Core/SignPackSync.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Animation/AnimSequence.h>
+
+using ASLMetaHuman::Codec::FRawSignTracks;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::ASLMetaHumanSignDictionary;
+using ASLMetaHuman::Core::FSignPack;
+using ASLMetaHuman::Core::FSignPackManifest;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+const auto DefaultAnimationPath {TEXT("/Game/ASL_Animations")};
+const auto DefaultOutputPath {TEXT("Content/SignPacks/SignPack.bin")};
+constexpr auto & AnimationPathParameter = TEXT("AnimationPath=");
+constexpr auto & OutputParameter = TEXT("Output=");
+constexpr auto & PublishParameter = TEXT("Publish=");
+constexpr auto & ErrorNoSignsFormatted = TEXT("No animation sequences found in %s");
+constexpr auto & ErrorWriteFailedFormatted = TEXT("Failed to write the sign pack to %s");
+constexpr auto & ErrorPublishFailedFormatted = TEXT("Failed to publish the sign pack to %s");
+constexpr auto & WarningNoTracksFormatted = TEXT("Skipped %s: no skeleton or keys");
+constexpr auto & WarningOtherSkeletonFormatted = TEXT("Skipped %s: skeleton %s differs from the pack's skeleton %s");
+constexpr auto & InfoPackWrittenFormatted = TEXT("Wrote %d signs (%d skipped) to %s: %.1f MB of tracks encoded to %.1f MB, dictionary hash %016llx");
+}
+
+USignPackCommandlet::USignPackCommandlet() {
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 USignPackCommandlet::Main(const FString & Params) {
+    FString AnimationPath {DefaultAnimationPath};
+    FParse::Value(*Params, AnimationPathParameter, AnimationPath);
+    FString OutputPath = FInternalSettings::GetSignPackPath();
+    if (OutputPath.IsEmpty()) {
+        OutputPath = DefaultOutputPath;
+    }
+    FParse::Value(*Params, OutputParameter, OutputPath);
+    if (FPaths::IsRelative(OutputPath)) {
+        OutputPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), OutputPath);
+    }
+    TArray<FAssetData> AssetDataList;
+    if (! UnrealAPI::GetAssetData<UAnimSequence>(AnimationPath, AssetDataList)) {
+        UE_LOG(LogTemp, Error, ErrorNoSignsFormatted, *AnimationPath);
+        return 1;
+    }
+    // Tracks are indexed by skeleton bone: the pack holds the bones of the first skeleton found
+    //
+    const USkeleton * PackSkeleton = nullptr;
+    TArray<FName> BoneNames;
+    TArray<FSignPack::FEntry> Entries;
+    Entries.Reserve(AssetDataList.Num());
+    int32 SkippedCount = 0;
+    int64 RawBytes = 0;
+    int64 EncodedBytes = 0;
+    for (const auto & AssetData: AssetDataList) {
+        const auto Sequence = Cast<UAnimSequence>(AssetData.GetAsset());
+        const USkeleton * Skeleton = nullptr == Sequence ? nullptr : Sequence->GetSkeleton();
+        if ((nullptr != Skeleton) && (nullptr != PackSkeleton) && (Skeleton != PackSkeleton)) {
+            UE_LOG(LogTemp, Warning, WarningOtherSkeletonFormatted, *AssetData.AssetName.ToString(),
+                    *Skeleton->GetName(), *PackSkeleton->GetName());
+            SkippedCount++;
+            continue;
+        }
+        FRawSignTracks Tracks;
+        if ((nullptr == Skeleton) || (! FSignPack::ExtractTracks(*Sequence, Tracks))) {
+            UE_LOG(LogTemp, Warning, WarningNoTracksFormatted, *AssetData.AssetName.ToString());
+            SkippedCount++;
+            continue;
+        }
+        if (nullptr == PackSkeleton) {
+            PackSkeleton = Skeleton;
+            const FReferenceSkeleton & ReferenceSkeleton = Skeleton->GetReferenceSkeleton();
+            for (int32 i = 0; i < ReferenceSkeleton.GetNum(); i++) {
+                BoneNames.Add(ReferenceSkeleton.GetBoneName(i));
+            }
+        }
+        FSignPack::FEntry Entry;
+        Entry.SignName = ASLMetaHumanSignDictionary::ToSignName(AssetData.AssetName.ToString());
+        Entry.WordCount = ASLMetaHumanSignDictionary::CountWords(Entry.SignName);
+        Entry.PlayLength = Sequence->GetPlayLength();
+        Entry.Clip = ASLMetaHuman::Codec::EncodeSignTracks(Tracks);
+        RawBytes += Tracks.Values.size() * sizeof(float);
+        EncodedBytes += Entry.Clip.size();
+        Entries.Add(MoveTemp(Entry));
+    }
+    const int32 NumSigns = Entries.Num();
+    const uint64 DictionaryHash = FSignPack::Write(OutputPath, BoneNames, MoveTemp(Entries));
+    if (0 == DictionaryHash) {
+        UE_LOG(LogTemp, Error, ErrorWriteFailedFormatted, *OutputPath);
+        return 1;
+    }
+    UE_LOG(LogTemp, Display, InfoPackWrittenFormatted, NumSigns, SkippedCount, *OutputPath,
+            RawBytes / (1024.0 * 1024.0), EncodedBytes / (1024.0 * 1024.0), DictionaryHash);
+    FString PublishDir;
+    if (FParse::Value(*Params, PublishParameter, PublishDir)) {
+        if (FPaths::IsRelative(PublishDir)) {
+            PublishDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), PublishDir);
+        }
+        FSignPackManifest Manifest;
+        if (! FSignPackManifest::Publish(OutputPath, PublishDir, Manifest)) {
+            UE_LOG(LogTemp, Error, ErrorPublishFailedFormatted, *PublishDir);
+            return 1;
+        }
+    }
+    return 0;
+}
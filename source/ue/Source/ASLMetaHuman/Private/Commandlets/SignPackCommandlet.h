@@ -0,0 +1,37 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Writes a sign pack (see Core/SignPack.h) from the animation sequences of the project: each sign's tracks are encoded
+// with the sign track codec. Signs of the pack then play without their animation sequences:
+//      UnrealEditor-Cmd.exe ASLMetaHuman.uproject -run=SignPack [-AnimationPath=/Game/ASL_Animations] [-Output=<file>]
+// The output defaults to SignPackPath (ASLMetaHuman.ini), else Content/SignPacks/SignPack.bin. -Publish=<dir> also
+// splits the pack into content-addressed chunks for the sign pack sync (see Core/SignPackSync.h): upload <dir> under
+// SignPackSyncPrefix, e.g. aws s3 sync <dir> s3://<SignPackSyncBucket>/signpacks/ [--endpoint-url <stand-in>].
+//
+
+#include <Commandlets/Commandlet.h>
+#include "SignPackCommandlet.generated.h"
+
+UCLASS()
+class USignPackCommandlet: public UCommandlet {
+    GENERATED_BODY()
+public:
+    USignPackCommandlet();
+    virtual int32 Main(const FString & Params) override;
+};
@@ -0,0 +1,92 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Exports the raw pose tracks of the sign animation sequences for the sign track codec benchmark
+//
+
+#include "SignTracksCommandlet.h"
+#include "Codec/SignTrackCodec.h"
+#include "Core/ASLMetaHumanSignDictionary.h"
+#include "Core/SignPack.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Animation/AnimSequence.h>
+
+using ASLMetaHuman::Codec::FRawSignTracks;
+using ASLMetaHuman::Core::ASLMetaHumanSignDictionary;
+using ASLMetaHuman::Core::FSignPack;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+const auto DefaultAnimationPath {TEXT("/Game/ASL_Animations")};
+const auto DefaultOutputDirectory {TEXT("SignTracks")};
+const auto SignTracksExtension {TEXT(".signtracks")};
+constexpr auto & AnimationPathParameter = TEXT("AnimationPath=");
+constexpr auto & OutputParameter = TEXT("Output=");
+constexpr auto & ErrorNoSignsFormatted = TEXT("No animation sequences found in %s");
+constexpr auto & ErrorWriteFailedFormatted = TEXT("Failed to write the sign tracks to %s");
+constexpr auto & WarningNoTracksFormatted = TEXT("Skipped %s: no skeleton or keys");
+constexpr auto & InfoTracksWrittenFormatted = TEXT("Wrote the tracks of %d signs (%d skipped, %.1f MB) to %s");
+}
+
+USignTracksCommandlet::USignTracksCommandlet() {
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 USignTracksCommandlet::Main(const FString & Params) {
+    FString AnimationPath {DefaultAnimationPath};
+    FParse::Value(*Params, AnimationPathParameter, AnimationPath);
+    FString OutputDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), DefaultOutputDirectory);
+    FParse::Value(*Params, OutputParameter, OutputDirectory);
+    if (FPaths::IsRelative(OutputDirectory)) {
+        OutputDirectory = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), OutputDirectory);
+    }
+    TArray<FAssetData> AssetDataList;
+    if (! UnrealAPI::GetAssetData<UAnimSequence>(AnimationPath, AssetDataList)) {
+        UE_LOG(LogTemp, Error, ErrorNoSignsFormatted, *AnimationPath);
+        return 1;
+    }
+    int32 WrittenCount = 0;
+    int32 SkippedCount = 0;
+    int64 WrittenBytes = 0;
+    for (const auto & AssetData: AssetDataList) {
+        const auto Sequence = Cast<UAnimSequence>(AssetData.GetAsset());
+        FRawSignTracks Tracks;
+        if ((nullptr == Sequence) || (! FSignPack::ExtractTracks(*Sequence, Tracks))) {
+            UE_LOG(LogTemp, Warning, WarningNoTracksFormatted, *AssetData.AssetName.ToString());
+            SkippedCount++;
+            continue;
+        }
+        const std::vector<uint8_t> Serialized = ASLMetaHuman::Codec::SerializeRawSignTracks(Tracks);
+        const FString SignName = ASLMetaHumanSignDictionary::ToSignName(AssetData.AssetName.ToString());
+        const FString OutputPath = FPaths::Combine(OutputDirectory, SignName + SignTracksExtension);
+        const TArrayView<const uint8> SerializedView(Serialized.data(), static_cast<int32>(Serialized.size()));
+        if (! FFileHelper::SaveArrayToFile(SerializedView, *OutputPath)) {
+            UE_LOG(LogTemp, Error, ErrorWriteFailedFormatted, *OutputPath);
+            return 1;
+        }
+        WrittenCount++;
+        WrittenBytes += Serialized.size();
+    }
+    UE_LOG(LogTemp, Display, InfoTracksWrittenFormatted, WrittenCount, SkippedCount, WrittenBytes / (1024.0 * 1024.0),
+            *OutputDirectory);
+    return 0;
+}
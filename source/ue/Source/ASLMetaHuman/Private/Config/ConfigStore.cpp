@@ -25,10 +25,12 @@
 #include "Config/UISettings.h"
 #include "Config/UserSettings.h"
 
+#include <HAL/FileManager.h>
 #include <Misc/Paths.h>
 
 using ASLMetaHuman::Config::FGlobalState;
 using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Config::FSettingsPublication;
 using ASLMetaHuman::Config::FUISettings;
 using ASLMetaHuman::Config::FUserSettings;
 
@@ -39,16 +41,35 @@ TWeakObjectPtr<UConfigStore> UConfigStore::Instance {nullptr};
 // Fields and section names to parse in the configuration file (filename is in CONFIG_FILENAME)
 //
 namespace {
+const TCHAR * ACTION_FILE_PATH_FIELD = TEXT("ActionFilePath");
+const TCHAR * ACTION_RECORD_PATH_FIELD = TEXT("ActionRecordPath");
+const TCHAR * ACTION_REPLAY_EXIT_WHEN_DONE_FIELD = TEXT("bActionReplayExitWhenDone");
+const TCHAR * ACTION_REPLAY_PATH_FIELD = TEXT("ActionReplayPath");
+const TCHAR * ACTION_REPLAY_SPEED_FIELD = TEXT("ActionReplaySpeed");
+const TCHAR * ACTION_SOCKET_PORT_FIELD = TEXT("ActionSocketPort");
+const TCHAR * ACTION_SOURCE_FIELD = TEXT("ActionSource");
+const TCHAR * ANIMATION_LOAD_TIMEOUT_SECONDS_FIELD = TEXT("AnimationLoadTimeoutSeconds");
+const TCHAR * ANIMATION_RESIDENCY_BUDGET_MB_FIELD = TEXT("AnimationResidencyBudgetMB");
 const TCHAR * ANIMATION_SPINLOCK_SECONDS_FIELD = TEXT("AnimationSpinlockSeconds");
 const TCHAR * ASL_TEXT_POSITION_FIELD = TEXT("ASLTextPosition");
 const TCHAR * AVATAR_NAME_FIELD = TEXT("AvatarName");
 const TCHAR * AVATAR_LOCATION_FIELD = TEXT("AvatarLocation");
 const TCHAR * AVATAR_ROTATION_FIELD = TEXT("AvatarRotation");
+const TCHAR * BACKGROUND_CACHE_BUDGET_MB_FIELD = TEXT("BackgroundCacheBudgetMB");
+const TCHAR * BACKGROUND_DOWNLOAD_TIMEOUT_SECONDS_FIELD = TEXT("BackgroundDownloadTimeoutSeconds");
 const TCHAR * BACKGROUND_IMAGE_PLANE_LOCATION_OFFSET_FIELD = TEXT("BackgroundImagePlaneLocationOffset");
 const TCHAR * BACKGROUND_IMAGE_PLANE_ROTATION_OFFSET_FIELD = TEXT("BackgroundImagePlaneRotationOffset");
 const TCHAR * BACKGROUND_IMAGE_PLANE_SCALE_FIELD = TEXT("BackgroundImagePlaneScale");
+const TCHAR * BACKGROUND_INGEST_FORMAT_FIELD = TEXT("BackgroundIngestFormat");
+const TCHAR * BACKGROUND_INGEST_MIPS_ENABLED_FIELD = TEXT("bBackgroundIngestMipsEnabled");
+const TCHAR * BACKGROUND_INGEST_RESIZE_ENABLED_FIELD = TEXT("bBackgroundIngestResizeEnabled");
 const TCHAR * BACKGROUND_LIGHTING_COLOR_FIELD = TEXT("BackgroundLightingColor");
 const TCHAR * BACKGROUND_LIGHTING_INTENSITY_FIELD = TEXT("BackgroundLightingIntensity");
+const TCHAR * BACKGROUND_S3_DOWNLOAD_ENABLED_FIELD = TEXT("bBackgroundS3DownloadEnabled");
+const TCHAR * BACKGROUND_S3_MAX_CONNECTIONS_FIELD = TEXT("BackgroundS3MaxConnections");
+const TCHAR * BACKGROUND_S3_PART_SIZE_KB_FIELD = TEXT("BackgroundS3PartSizeKB");
+const TCHAR * BACKGROUND_TEXTURE_POOL_SIZE_FIELD = TEXT("BackgroundTexturePoolSize");
+const TCHAR * BACKGROUND_WORKER_DECODE_ENABLED_FIELD = TEXT("bBackgroundWorkerDecodeEnabled");
 const TCHAR * CAMERA_FOV_FIELD = TEXT("CameraFOV");
 const TCHAR * CAMERA_LOCATION_OFFSET_FIELD = TEXT("CameraLocationOffset");
 const TCHAR * CAMERA_ROTATION_OFFSET_FIELD = TEXT("CameraRotationOffset");
@@ -58,10 +79,12 @@ const TCHAR * CONFIG_FILENAME = TEXT("ASLMetaHuman.ini");
 const TCHAR * CONFIG_FILE_INTERNAL_SECTION_NAME = TEXT("/Script/ASLMetaHuman.Internal");
 const TCHAR * CONFIG_FILE_UI_SECTION_NAME = TEXT("/Script/ASLMetaHuman.UI");
 const TCHAR * CONFIG_FILE_USER_SECTION_NAME = TEXT("/Script/ASLMetaHuman.User");
+const TCHAR * ENFORCE_SINGLE_INSTANCE_FIELD = TEXT("bEnforceSingleInstance");
 const TCHAR * FIXED_TEXT_TO_SIGN_FIELD = TEXT("FixedTextToSign");
 const TCHAR * FLIP_HANDS_FIELD = TEXT("bFlipHands");
 const TCHAR * FONT_PATH_FIELD = TEXT("FontPath");
 const TCHAR * FONT_SIZE_FIELD = TEXT("FontSize");
+const TCHAR * GLYPH_ATLAS_ENABLED_FIELD = TEXT("bGlyphAtlasEnabled");
 const TCHAR * HIDE_ATMOSPHERE_FIELD = TEXT("bHideAtmosphere");
 const TCHAR * HIDE_BACKGROUND_PLANE_FIELD = TEXT("bHideBackgroundPlane");
 const TCHAR * HIDE_MESSAGE_SYNCHRONIZATION_MULTIPLIER_FIELD = TEXT("HideMessageSynchronizationMultiplier");
@@ -69,20 +92,73 @@ const TCHAR * HIDE_SKYLIGHT_FIELD = TEXT("bHideSkyLight");
 const TCHAR * HIDE_SPOTLIGHT_FIELD = TEXT("bHideSpotLight");
 const TCHAR * IGNORE_SQS_FIELD = TEXT("bIgnoreSQS");
 const TCHAR * LETTER_POSITION_FIELD = TEXT("LetterPosition");
+const TCHAR * MQTT_ACK_TOPIC_FIELD = TEXT("MqttAckTopic");
+const TCHAR * MQTT_CA_FILE_PATH_FIELD = TEXT("MqttCaFilePath");
+const TCHAR * MQTT_CERTIFICATE_PATH_FIELD = TEXT("MqttCertificatePath");
+const TCHAR * MQTT_CLIENT_ID_FIELD = TEXT("MqttClientId");
+const TCHAR * MQTT_ENDPOINT_FIELD = TEXT("MqttEndpoint");
+const TCHAR * MQTT_IMMEDIATE_TOPIC_FIELD = TEXT("MqttImmediateTopic");
+const TCHAR * MQTT_PORT_FIELD = TEXT("MqttPort");
+const TCHAR * MQTT_PRIVATE_KEY_PATH_FIELD = TEXT("MqttPrivateKeyPath");
+const TCHAR * MQTT_RECONNECT_MAX_SECONDS_FIELD = TEXT("MqttReconnectMaxSeconds");
+const TCHAR * MQTT_RECONNECT_MIN_SECONDS_FIELD = TEXT("MqttReconnectMinSeconds");
+const TCHAR * MQTT_TRANSLATION_TOPIC_FIELD = TEXT("MqttTranslationTopic");
+const TCHAR * MQTT_USE_TLS_FIELD = TEXT("bMqttUseTls");
 const TCHAR * ONLY_SIGN_FIXED_TEXT_FIELD = TEXT("bOnlySignFixedText");
+const TCHAR * PINNED_SIGN_TOKENS_FIELD = TEXT("PinnedSignTokens");
 const TCHAR * PLAY_START_OFFSET_FIELD = TEXT("PlayStartOffset");
 const TCHAR * PLAY_END_OFFSET_FIELD = TEXT("PlayEndOffset");
 const TCHAR * PLAY_RATE_FIELD = TEXT("PlayRate");
+const TCHAR * POSE_CACHE_ENABLED_FIELD = TEXT("bPoseCacheEnabled");
+const TCHAR * POSE_CACHE_HOT_PLAYS_FIELD = TEXT("PoseCacheHotPlays");
+const TCHAR * POSE_CACHE_HOT_SIGNS_FIELD = TEXT("PoseCacheHotSigns");
 const TCHAR * PURGE_QUEUES_ON_STARTUP = TEXT("bPurgeQueuesOnStartup");
+const TCHAR * RENDER_SESSION_COUNT_FIELD = TEXT("RenderSessionCount");
 const TCHAR * SENTENCE_POSITION_FIELD = TEXT("SentencePosition");
+const TCHAR * SESSION_AVATAR_NAMES_FIELD = TEXT("SessionAvatarNames");
+const TCHAR * SESSION_AVATAR_SPACING_FIELD = TEXT("SessionAvatarSpacing");
+const TCHAR * SESSION_HEARTBEAT_SECONDS_FIELD = TEXT("SessionHeartbeatSeconds");
+const TCHAR * SESSION_IDS_FIELD = TEXT("SessionIds");
+const TCHAR * SESSION_LEASE_SECONDS_FIELD = TEXT("SessionLeaseSeconds");
+const TCHAR * SESSION_REGISTRY_BUCKET_FIELD = TEXT("SessionRegistryBucket");
+const TCHAR * SESSION_REGISTRY_ENDPOINT_OVERRIDE_FIELD = TEXT("SessionRegistryEndpointOverride");
+const TCHAR * SESSION_REGISTRY_REGION_FIELD = TEXT("SessionRegistryRegion");
+const TCHAR * SETTINGS_RELOAD_INTERVAL_SECONDS_FIELD = TEXT("SettingsReloadIntervalSeconds");
 const TCHAR * SIGN_FONT_SIZE_FIELD = TEXT("SignFontSize");
+const TCHAR * SIGN_MANIFEST_PATH_FIELD = TEXT("SignManifestPath");
+const TCHAR * SIGN_PACK_PATH_FIELD = TEXT("SignPackPath");
+const TCHAR * SIGN_PACK_SYNC_BUCKET_FIELD = TEXT("SignPackSyncBucket");
+const TCHAR * SIGN_PACK_SYNC_ENDPOINT_OVERRIDE_FIELD = TEXT("SignPackSyncEndpointOverride");
+const TCHAR * SIGN_PACK_SYNC_INTERVAL_SECONDS_FIELD = TEXT("SignPackSyncIntervalSeconds");
+const TCHAR * SIGN_PACK_SYNC_PREFIX_FIELD = TEXT("SignPackSyncPrefix");
+const TCHAR * SIGN_PACK_SYNC_REGION_FIELD = TEXT("SignPackSyncRegion");
+const TCHAR * SIGN_PACK_SYNC_TIMEOUT_SECONDS_FIELD = TEXT("SignPackSyncTimeoutSeconds");
 const TCHAR * SQS_ACTION_QUEUE_NAME_FIELD = TEXT("SQSActionQueueName");
+const TCHAR * SQS_CIRCUIT_FAILURE_THRESHOLD_FIELD = TEXT("SQSCircuitFailureThreshold");
+const TCHAR * SQS_CIRCUIT_MAX_OPEN_SECONDS_FIELD = TEXT("SQSCircuitMaxOpenSeconds");
+const TCHAR * SQS_CIRCUIT_OPEN_SECONDS_FIELD = TEXT("SQSCircuitOpenSeconds");
+const TCHAR * SQS_CONNECT_TIMEOUT_MS_FIELD = TEXT("SQSConnectTimeoutMs");
+const TCHAR * SQS_ENDPOINT_OVERRIDE_FIELD = TEXT("SQSEndpointOverride");
+const TCHAR * SQS_HEDGE_AFTER_MS_FIELD = TEXT("SQSHedgeAfterMs");
+const TCHAR * SQS_KEEP_ALIVE_INTERVAL_MS_FIELD = TEXT("SQSKeepAliveIntervalMs");
+const TCHAR * SQS_MAX_ATTEMPTS_FIELD = TEXT("SQSMaxAttempts");
+const TCHAR * SQS_REQUEST_TIMEOUT_MS_FIELD = TEXT("SQSRequestTimeoutMs");
+const TCHAR * SQS_RETRY_BASE_DELAY_MS_FIELD = TEXT("SQSRetryBaseDelayMs");
+const TCHAR * SQS_RETRY_MAX_DELAY_MS_FIELD = TEXT("SQSRetryMaxDelayMs");
 const TCHAR * SQS_TRANSLATION_QUEUE_NAME_FIELD = TEXT("SQSTranslationQueueName");
 const TCHAR * SQS_SPINLOCK_SECONDS_FIELD = TEXT("SQSSpinlockSeconds");
 const TCHAR * TOKEN_POSITION_FIELD = TEXT("TokenPosition");
 const TCHAR * USE_ENTIRE_BACKGROUND_FOR_IMAGES_FIELD = TEXT("UseEntireBackgroundForImages");
 const TCHAR * WORD_TRANSITION_DELAY_FIELD = TEXT("WordTransitionDelay");
 const FString & MissingConfigErrorMessage {"Error: configuration file is missing."};
+constexpr auto & InfoConfigReloadedFormatted = TEXT("Configuration reloaded from %s");
+constexpr auto & WarningConfigReloadFailedFormatted = TEXT("Configuration reload from %s failed: previous settings kept");
+
+// Path of CONFIG_FILENAME as GConfig caches it
+//
+FString GetConfigIniPath() {
+    return FConfigCacheIni::NormalizeConfigIniPath(FPaths::ProjectConfigDir() + TEXT("/") + CONFIG_FILENAME);
+}
 }
 
 // Enforces one instance of the configuration store
@@ -99,46 +175,124 @@ void UConfigStore::GetConfigFilePath(FString & Path) {
     Path = FPaths::SourceConfigDir().Append(CONFIG_FILENAME);
 }
 
-// Apply already read configuration properties - need to keep these in sync; structs are an alternative.
+// Applies already read configuration properties: builds one snapshot per settings class and publishes them together
+// (see FSettingsPublication), so that readers see either the previous or the new configuration as a whole
 //
 void UConfigStore::ApplyConfig() const {
-    FInternalSettings::SetAnimationSpinlockSeconds(AnimationSpinlockSeconds);
-    FUISettings::SetASLTextPosition(ASLTextPosition);
-    FUserSettings::SetAvatarName(AvatarName);
-    FUserSettings::SetAvatarLocation(AvatarLocation);
-    FUserSettings::SetAvatarRotation(AvatarRotation);
-    FUISettings::SetBackgroundImagePlaneLocationOffset(BackgroundImagePlaneLocationOffset);
-    FUISettings::SetBackgroundImagePlaneRotationOffset(BackgroundImagePlaneRotationOffset);
-    FUISettings::SetBackgroundImagePlaneScale(BackgroundImagePlaneScale);
-    FUserSettings::SetBackgroundLightingColor(BackgroundLightingColor);
-    FUserSettings::SetBackgroundLightingIntensity(BackgroundLightingIntensity);
-    FUserSettings::SetCameraFOV(CameraFOV);
-    FUserSettings::SetCameraLocationOffset(CameraLocationOffset);
-    FUserSettings::SetCameraRotationOffset(CameraRotationOffset);
-    FInternalSettings::SetFixedTextToSign(FixedTextToSign);
-    FUserSettings::SetFlipHands(bFlipHands);
-    FUISettings::SetFontPath(FontPath);
-    FUISettings::SetFontSize(FontSize);
-    FUserSettings::SetHideAtmosphere(bHideAtmosphere);
-    FUserSettings::SetHideBackgroundPlane(bHideBackgroundPlane);
-    FUserSettings::SetHideSkyLight(bHideSkyLight);
-    FUserSettings::SetHideSpotLight(bHideSpotLight);
-    FInternalSettings::SetHideMessageSynchronizationMultiplier(HideMessageSynchronizationMultiplier);
-    FInternalSettings::SetIgnoreSQS(bIgnoreSQS);
-    FUISettings::SetLetterPosition(LetterPosition);
-    FInternalSettings::SetOnlySignFixedText(bOnlySignFixedText);
-    FUserSettings::SetPlayStartOffset(PlayStartOffset);
-    FUserSettings::SetPlayEndOffset(PlayEndOffset);
-    FUserSettings::SetPlayRate(PlayRate);
-    FInternalSettings::SetPurgeQueuesOnStartup(bPurgeQueuesOnStartup);
-    FUISettings::SetSentencePosition(SentencePosition);
-    FUISettings::SetSignFontSize(SignFontSize);
-    FInternalSettings::SetSQSActionQueueName(SQSActionQueueName);
-    FInternalSettings::SetSQSTranslationQueueName(SQSTranslationQueueName);
-    FInternalSettings::SetSQSSpinlockSeconds(SQSSpinlockSeconds);
-    FUISettings::SetTokenPosition(TokenPosition);
-    FUISettings::SetUseEntireBackgroundForImages(UseEntireBackgroundForImages);
-    FUserSettings::SetWordTransitionDelay(WordTransitionDelay);
+    FInternalSettings::FSnapshot Internal;
+    Internal.ActionFilePath = ActionFilePath;
+    Internal.ActionRecordPath = ActionRecordPath;
+    Internal.ActionReplayExitWhenDone = bActionReplayExitWhenDone;
+    Internal.ActionReplayPath = ActionReplayPath;
+    Internal.ActionReplaySpeed = ActionReplaySpeed;
+    Internal.ActionSocketPort = ActionSocketPort;
+    Internal.ActionSource = ActionSource;
+    Internal.AnimationLoadTimeoutSeconds = AnimationLoadTimeoutSeconds;
+    Internal.AnimationResidencyBudgetMB = AnimationResidencyBudgetMB;
+    Internal.AnimationSpinlockSeconds = AnimationSpinlockSeconds;
+    Internal.BackgroundCacheBudgetMB = BackgroundCacheBudgetMB;
+    Internal.BackgroundDownloadTimeoutSeconds = BackgroundDownloadTimeoutSeconds;
+    Internal.BackgroundIngestFormat = BackgroundIngestFormat;
+    Internal.BackgroundIngestMipsEnabled = bBackgroundIngestMipsEnabled;
+    Internal.BackgroundIngestResizeEnabled = bBackgroundIngestResizeEnabled;
+    Internal.BackgroundS3DownloadEnabled = bBackgroundS3DownloadEnabled;
+    Internal.BackgroundS3MaxConnections = BackgroundS3MaxConnections;
+    Internal.BackgroundS3PartSizeKB = BackgroundS3PartSizeKB;
+    Internal.BackgroundTexturePoolSize = BackgroundTexturePoolSize;
+    Internal.BackgroundWorkerDecodeEnabled = bBackgroundWorkerDecodeEnabled;
+    Internal.EnforceSingleInstance = bEnforceSingleInstance;
+    Internal.FixedTextToSign = FixedTextToSign;
+    Internal.HideMessageSynchronizationMultiplier = HideMessageSynchronizationMultiplier;
+    Internal.IgnoreSQS = bIgnoreSQS;
+    Internal.MqttAckTopic = MqttAckTopic;
+    Internal.MqttCaFilePath = MqttCaFilePath;
+    Internal.MqttCertificatePath = MqttCertificatePath;
+    Internal.MqttClientId = MqttClientId;
+    Internal.MqttEndpoint = MqttEndpoint;
+    Internal.MqttImmediateTopic = MqttImmediateTopic;
+    Internal.MqttPort = MqttPort;
+    Internal.MqttPrivateKeyPath = MqttPrivateKeyPath;
+    Internal.MqttReconnectMaxSeconds = MqttReconnectMaxSeconds;
+    Internal.MqttReconnectMinSeconds = MqttReconnectMinSeconds;
+    Internal.MqttTranslationTopic = MqttTranslationTopic;
+    Internal.MqttUseTls = bMqttUseTls;
+    Internal.OnlySignFixedText = bOnlySignFixedText;
+    Internal.PinnedSignTokens = PinnedSignTokens;
+    Internal.PoseCacheEnabled = bPoseCacheEnabled;
+    Internal.PoseCacheHotPlays = PoseCacheHotPlays;
+    Internal.PoseCacheHotSigns = PoseCacheHotSigns;
+    Internal.PurgeQueuesOnStartup = bPurgeQueuesOnStartup;
+    Internal.RenderSessionCount = RenderSessionCount;
+    Internal.SessionHeartbeatSeconds = SessionHeartbeatSeconds;
+    Internal.SessionIds = SessionIds;
+    Internal.SessionLeaseSeconds = SessionLeaseSeconds;
+    Internal.SessionRegistryBucket = SessionRegistryBucket;
+    Internal.SessionRegistryEndpointOverride = SessionRegistryEndpointOverride;
+    Internal.SessionRegistryRegion = SessionRegistryRegion;
+    Internal.SettingsReloadIntervalSeconds = SettingsReloadIntervalSeconds;
+    Internal.SignManifestPath = SignManifestPath;
+    Internal.SignPackPath = SignPackPath;
+    Internal.SignPackSyncBucket = SignPackSyncBucket;
+    Internal.SignPackSyncEndpointOverride = SignPackSyncEndpointOverride;
+    Internal.SignPackSyncIntervalSeconds = SignPackSyncIntervalSeconds;
+    Internal.SignPackSyncPrefix = SignPackSyncPrefix;
+    Internal.SignPackSyncRegion = SignPackSyncRegion;
+    Internal.SignPackSyncTimeoutSeconds = SignPackSyncTimeoutSeconds;
+    Internal.SQSActionQueueName = SQSActionQueueName;
+    Internal.SQSCircuitFailureThreshold = SQSCircuitFailureThreshold;
+    Internal.SQSCircuitMaxOpenSeconds = SQSCircuitMaxOpenSeconds;
+    Internal.SQSCircuitOpenSeconds = SQSCircuitOpenSeconds;
+    Internal.SQSConnectTimeoutMs = SQSConnectTimeoutMs;
+    Internal.SQSEndpointOverride = SQSEndpointOverride;
+    Internal.SQSHedgeAfterMs = SQSHedgeAfterMs;
+    Internal.SQSKeepAliveIntervalMs = SQSKeepAliveIntervalMs;
+    Internal.SQSMaxAttempts = SQSMaxAttempts;
+    Internal.SQSRequestTimeoutMs = SQSRequestTimeoutMs;
+    Internal.SQSRetryBaseDelayMs = SQSRetryBaseDelayMs;
+    Internal.SQSRetryMaxDelayMs = SQSRetryMaxDelayMs;
+    Internal.SQSTranslationQueueName = SQSTranslationQueueName;
+    Internal.SQSSpinlockSeconds = SQSSpinlockSeconds;
+
+    FUISettings::FSnapshot UI;
+    UI.ASLTextPosition = ASLTextPosition;
+    UI.BackgroundImagePlaneLocationOffset = BackgroundImagePlaneLocationOffset;
+    UI.BackgroundImagePlaneRotationOffset = BackgroundImagePlaneRotationOffset;
+    UI.BackgroundImagePlaneScale = BackgroundImagePlaneScale;
+    UI.FontPath = FontPath;
+    UI.FontSize = FontSize;
+    UI.GlyphAtlasEnabled = bGlyphAtlasEnabled;
+    UI.LetterPosition = LetterPosition;
+    UI.SentencePosition = SentencePosition;
+    UI.SignFontSize = SignFontSize;
+    UI.TokenPosition = TokenPosition;
+    UI.UseEntireBackgroundForImages = UseEntireBackgroundForImages;
+
+    FUserSettings::FSnapshot User;
+    User.AvatarName = AvatarName;
+    User.AvatarLocation = AvatarLocation;
+    User.AvatarRotation = AvatarRotation;
+    User.BackgroundLightingColor = BackgroundLightingColor;
+    User.BackgroundLightingIntensity = BackgroundLightingIntensity;
+    User.CameraFOV = CameraFOV;
+    User.CameraLocationOffset = CameraLocationOffset;
+    User.CameraRotationOffset = CameraRotationOffset;
+    User.FlipHands = bFlipHands;
+    User.HideAtmosphere = bHideAtmosphere;
+    User.HideBackgroundPlane = bHideBackgroundPlane;
+    User.HideSkyLight = bHideSkyLight;
+    User.HideSpotLight = bHideSpotLight;
+    User.PlayStartOffset = PlayStartOffset;
+    User.PlayEndOffset = PlayEndOffset;
+    User.PlayRate = PlayRate;
+    User.SessionAvatarNames = SessionAvatarNames;
+    User.SessionAvatarSpacing = SessionAvatarSpacing;
+    User.WordTransitionDelaySeconds = WordTransitionDelay;
+
+    FSettingsPublication::Publish([&Internal, &UI, &User]() {
+        FInternalSettings::Publish(MoveTemp(Internal));
+        FUISettings::Publish(MoveTemp(UI));
+        FUserSettings::Publish(MoveTemp(User));
+    });
 }
 
 // Populates settings found in CONFIG_FILENAME (.ini file) into UProperty objects (via GConfig interface).
@@ -156,12 +310,14 @@ bool UConfigStore::InitConfig() {
     if (nullptr == GConfig) {
         return false;
     }
-    const FString & ConfigFilePath =
-            FConfigCacheIni::NormalizeConfigIniPath(FPaths::ProjectConfigDir() + TEXT("/") + CONFIG_FILENAME);
+    const FString & ConfigFilePath = GetConfigIniPath();
     if (! FPaths::FileExists(ConfigFilePath)) {
         FMessageDialog::Open(EAppMsgType::Ok, EAppReturnType::Yes, FText::FromString(MissingConfigErrorMessage));
         return false;
     }
+    // GConfig keeps the file it read: drop it so that a reload sees the current content
+    //
+    GConfig->UnloadFile(ConfigFilePath);
     // Populate individual configuration sections; consider refactoring into separate configuration stores
     //
     InitUserConfig(ConfigFilePath);
@@ -180,6 +336,47 @@ bool UConfigStore::ReloadConfig() {
     return false;
 }
 
+// Reloads the configuration whenever the configuration file changes (polls its modification time every IntervalSeconds
+// on the game thread; a no-op if IntervalSeconds <= 0). Readers pick up the new settings with their next snapshot.
+//
+// Note: keeps the store alive until StopWatching()
+//
+void UConfigStore::StartWatching(const float IntervalSeconds) {
+    if ((IntervalSeconds <= 0.0f) || WatchTickerHandle.IsValid()) {
+        return;
+    }
+    AddToRoot();
+    WatchedTimeStamp = IFileManager::Get().GetTimeStamp(*GetConfigIniPath());
+    WatchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UConfigStore::OnWatchTick), IntervalSeconds);
+}
+
+void UConfigStore::StopWatching() {
+    if (! WatchTickerHandle.IsValid()) {
+        return;
+    }
+    FTSTicker::GetCoreTicker().RemoveTicker(WatchTickerHandle);
+    WatchTickerHandle.Reset();
+    RemoveFromRoot();
+}
+
+bool UConfigStore::OnWatchTick(float) {
+    const FString & ConfigFilePath = GetConfigIniPath();
+    const FDateTime & TimeStamp = IFileManager::Get().GetTimeStamp(*ConfigFilePath);
+    // Missing (e.g. while an editor replaces it) or unchanged
+    //
+    if ((FDateTime::MinValue() == TimeStamp) || (WatchedTimeStamp == TimeStamp)) {
+        return true;
+    }
+    WatchedTimeStamp = TimeStamp;
+    if (ReloadConfig()) {
+        UE_LOG(LogTemp, Display, InfoConfigReloadedFormatted, *ConfigFilePath);
+    } else {
+        UE_LOG(LogTemp, Warning, WarningConfigReloadFailedFormatted, *ConfigFilePath);
+    }
+    return true;
+}
+
 // Populates end user-related configuration fields from the supplied configuration file
 //
 void UConfigStore::InitUserConfig(const FString & ConfigFilePath) {
@@ -200,6 +397,8 @@ void UConfigStore::InitUserConfig(const FString & ConfigFilePath) {
     GConfig->GetFloat(SectionName, PLAY_START_OFFSET_FIELD, PlayStartOffset, ConfigFilePath);
     GConfig->GetFloat(SectionName, PLAY_END_OFFSET_FIELD, PlayEndOffset, ConfigFilePath);
     GConfig->GetFloat(SectionName, PLAY_RATE_FIELD, PlayRate, ConfigFilePath);
+    GConfig->GetString(SectionName, SESSION_AVATAR_NAMES_FIELD, SessionAvatarNames, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SESSION_AVATAR_SPACING_FIELD, SessionAvatarSpacing, ConfigFilePath);
     GConfig->GetFloat(SectionName, WORD_TRANSITION_DELAY_FIELD, WordTransitionDelay, ConfigFilePath);
 }
 
@@ -207,14 +406,82 @@ void UConfigStore::InitUserConfig(const FString & ConfigFilePath) {
 //
 void UConfigStore::InitInternalConfig(const FString & ConfigFilePath) {
     const TCHAR * SectionName = CONFIG_FILE_INTERNAL_SECTION_NAME;
+    GConfig->GetString(SectionName, ACTION_FILE_PATH_FIELD, ActionFilePath, ConfigFilePath);
+    GConfig->GetString(SectionName, ACTION_RECORD_PATH_FIELD, ActionRecordPath, ConfigFilePath);
+    GConfig->GetBool(SectionName, ACTION_REPLAY_EXIT_WHEN_DONE_FIELD, bActionReplayExitWhenDone, ConfigFilePath);
+    GConfig->GetString(SectionName, ACTION_REPLAY_PATH_FIELD, ActionReplayPath, ConfigFilePath);
+    GConfig->GetFloat(SectionName, ACTION_REPLAY_SPEED_FIELD, ActionReplaySpeed, ConfigFilePath);
+    GConfig->GetInt(SectionName, ACTION_SOCKET_PORT_FIELD, ActionSocketPort, ConfigFilePath);
+    GConfig->GetString(SectionName, ACTION_SOURCE_FIELD, ActionSource, ConfigFilePath);
+    GConfig->GetFloat(SectionName, ANIMATION_LOAD_TIMEOUT_SECONDS_FIELD, AnimationLoadTimeoutSeconds, ConfigFilePath);
+    GConfig->GetInt(SectionName, ANIMATION_RESIDENCY_BUDGET_MB_FIELD, AnimationResidencyBudgetMB, ConfigFilePath);
     GConfig->GetFloat(SectionName, ANIMATION_SPINLOCK_SECONDS_FIELD, AnimationSpinlockSeconds, ConfigFilePath);
+    GConfig->GetInt(SectionName, BACKGROUND_CACHE_BUDGET_MB_FIELD, BackgroundCacheBudgetMB, ConfigFilePath);
+    GConfig->GetFloat(SectionName, BACKGROUND_DOWNLOAD_TIMEOUT_SECONDS_FIELD, BackgroundDownloadTimeoutSeconds,
+            ConfigFilePath);
+    GConfig->GetString(SectionName, BACKGROUND_INGEST_FORMAT_FIELD, BackgroundIngestFormat, ConfigFilePath);
+    GConfig->GetBool(SectionName, BACKGROUND_INGEST_MIPS_ENABLED_FIELD, bBackgroundIngestMipsEnabled, ConfigFilePath);
+    GConfig->GetBool(SectionName, BACKGROUND_INGEST_RESIZE_ENABLED_FIELD, bBackgroundIngestResizeEnabled,
+            ConfigFilePath);
+    GConfig->GetBool(SectionName, BACKGROUND_S3_DOWNLOAD_ENABLED_FIELD, bBackgroundS3DownloadEnabled, ConfigFilePath);
+    GConfig->GetInt(SectionName, BACKGROUND_S3_MAX_CONNECTIONS_FIELD, BackgroundS3MaxConnections, ConfigFilePath);
+    GConfig->GetInt(SectionName, BACKGROUND_S3_PART_SIZE_KB_FIELD, BackgroundS3PartSizeKB, ConfigFilePath);
+    GConfig->GetInt(SectionName, BACKGROUND_TEXTURE_POOL_SIZE_FIELD, BackgroundTexturePoolSize, ConfigFilePath);
+    GConfig->GetBool(SectionName, BACKGROUND_WORKER_DECODE_ENABLED_FIELD, bBackgroundWorkerDecodeEnabled,
+            ConfigFilePath);
+    GConfig->GetBool(SectionName, ENFORCE_SINGLE_INSTANCE_FIELD, bEnforceSingleInstance, ConfigFilePath);
     GConfig->GetString(SectionName, FIXED_TEXT_TO_SIGN_FIELD, FixedTextToSign, ConfigFilePath);
     GConfig->GetFloat(SectionName, HIDE_MESSAGE_SYNCHRONIZATION_MULTIPLIER_FIELD, HideMessageSynchronizationMultiplier,
             ConfigFilePath);
     GConfig->GetBool(SectionName, IGNORE_SQS_FIELD, bIgnoreSQS, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_ACK_TOPIC_FIELD, MqttAckTopic, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_CA_FILE_PATH_FIELD, MqttCaFilePath, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_CERTIFICATE_PATH_FIELD, MqttCertificatePath, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_CLIENT_ID_FIELD, MqttClientId, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_ENDPOINT_FIELD, MqttEndpoint, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_IMMEDIATE_TOPIC_FIELD, MqttImmediateTopic, ConfigFilePath);
+    GConfig->GetInt(SectionName, MQTT_PORT_FIELD, MqttPort, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_PRIVATE_KEY_PATH_FIELD, MqttPrivateKeyPath, ConfigFilePath);
+    GConfig->GetInt(SectionName, MQTT_RECONNECT_MAX_SECONDS_FIELD, MqttReconnectMaxSeconds, ConfigFilePath);
+    GConfig->GetInt(SectionName, MQTT_RECONNECT_MIN_SECONDS_FIELD, MqttReconnectMinSeconds, ConfigFilePath);
+    GConfig->GetString(SectionName, MQTT_TRANSLATION_TOPIC_FIELD, MqttTranslationTopic, ConfigFilePath);
+    GConfig->GetBool(SectionName, MQTT_USE_TLS_FIELD, bMqttUseTls, ConfigFilePath);
     GConfig->GetBool(SectionName, ONLY_SIGN_FIXED_TEXT_FIELD, bOnlySignFixedText, ConfigFilePath);
+    GConfig->GetString(SectionName, PINNED_SIGN_TOKENS_FIELD, PinnedSignTokens, ConfigFilePath);
+    GConfig->GetBool(SectionName, POSE_CACHE_ENABLED_FIELD, bPoseCacheEnabled, ConfigFilePath);
+    GConfig->GetInt(SectionName, POSE_CACHE_HOT_PLAYS_FIELD, PoseCacheHotPlays, ConfigFilePath);
+    GConfig->GetInt(SectionName, POSE_CACHE_HOT_SIGNS_FIELD, PoseCacheHotSigns, ConfigFilePath);
     GConfig->GetBool(SectionName, PURGE_QUEUES_ON_STARTUP, bPurgeQueuesOnStartup, ConfigFilePath);
+    GConfig->GetInt(SectionName, RENDER_SESSION_COUNT_FIELD, RenderSessionCount, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SESSION_HEARTBEAT_SECONDS_FIELD, SessionHeartbeatSeconds, ConfigFilePath);
+    GConfig->GetString(SectionName, SESSION_IDS_FIELD, SessionIds, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SESSION_LEASE_SECONDS_FIELD, SessionLeaseSeconds, ConfigFilePath);
+    GConfig->GetString(SectionName, SESSION_REGISTRY_BUCKET_FIELD, SessionRegistryBucket, ConfigFilePath);
+    GConfig->GetString(SectionName, SESSION_REGISTRY_ENDPOINT_OVERRIDE_FIELD, SessionRegistryEndpointOverride,
+            ConfigFilePath);
+    GConfig->GetString(SectionName, SESSION_REGISTRY_REGION_FIELD, SessionRegistryRegion, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SETTINGS_RELOAD_INTERVAL_SECONDS_FIELD, SettingsReloadIntervalSeconds,
+            ConfigFilePath);
+    GConfig->GetString(SectionName, SIGN_MANIFEST_PATH_FIELD, SignManifestPath, ConfigFilePath);
+    GConfig->GetString(SectionName, SIGN_PACK_PATH_FIELD, SignPackPath, ConfigFilePath);
+    GConfig->GetString(SectionName, SIGN_PACK_SYNC_BUCKET_FIELD, SignPackSyncBucket, ConfigFilePath);
+    GConfig->GetString(SectionName, SIGN_PACK_SYNC_ENDPOINT_OVERRIDE_FIELD, SignPackSyncEndpointOverride, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SIGN_PACK_SYNC_INTERVAL_SECONDS_FIELD, SignPackSyncIntervalSeconds, ConfigFilePath);
+    GConfig->GetString(SectionName, SIGN_PACK_SYNC_PREFIX_FIELD, SignPackSyncPrefix, ConfigFilePath);
+    GConfig->GetString(SectionName, SIGN_PACK_SYNC_REGION_FIELD, SignPackSyncRegion, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SIGN_PACK_SYNC_TIMEOUT_SECONDS_FIELD, SignPackSyncTimeoutSeconds, ConfigFilePath);
     GConfig->GetString(SectionName, SQS_ACTION_QUEUE_NAME_FIELD, SQSActionQueueName, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_CIRCUIT_FAILURE_THRESHOLD_FIELD, SQSCircuitFailureThreshold, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SQS_CIRCUIT_MAX_OPEN_SECONDS_FIELD, SQSCircuitMaxOpenSeconds, ConfigFilePath);
+    GConfig->GetFloat(SectionName, SQS_CIRCUIT_OPEN_SECONDS_FIELD, SQSCircuitOpenSeconds, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_CONNECT_TIMEOUT_MS_FIELD, SQSConnectTimeoutMs, ConfigFilePath);
+    GConfig->GetString(SectionName, SQS_ENDPOINT_OVERRIDE_FIELD, SQSEndpointOverride, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_HEDGE_AFTER_MS_FIELD, SQSHedgeAfterMs, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_KEEP_ALIVE_INTERVAL_MS_FIELD, SQSKeepAliveIntervalMs, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_MAX_ATTEMPTS_FIELD, SQSMaxAttempts, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_REQUEST_TIMEOUT_MS_FIELD, SQSRequestTimeoutMs, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_RETRY_BASE_DELAY_MS_FIELD, SQSRetryBaseDelayMs, ConfigFilePath);
+    GConfig->GetInt(SectionName, SQS_RETRY_MAX_DELAY_MS_FIELD, SQSRetryMaxDelayMs, ConfigFilePath);
     GConfig->GetString(SectionName, SQS_TRANSLATION_QUEUE_NAME_FIELD, SQSTranslationQueueName, ConfigFilePath);
     GConfig->GetFloat(SectionName, SQS_SPINLOCK_SECONDS_FIELD, SQSSpinlockSeconds, ConfigFilePath);
 }
@@ -229,6 +496,7 @@ void UConfigStore::InitUIConfig(const FString & ConfigFilePath) {
     GConfig->GetVector(SectionName, BACKGROUND_IMAGE_PLANE_SCALE_FIELD, BackgroundImagePlaneScale, ConfigFilePath);
     GConfig->GetString(SectionName, FONT_PATH_FIELD, FontPath, ConfigFilePath);
     GConfig->GetInt(SectionName, FONT_SIZE_FIELD, FontSize, ConfigFilePath);
+    GConfig->GetBool(SectionName, GLYPH_ATLAS_ENABLED_FIELD, bGlyphAtlasEnabled, ConfigFilePath);
     GConfig->GetVector2D(SectionName, LETTER_POSITION_FIELD, LetterPosition, ConfigFilePath);
     GConfig->GetVector2D(SectionName, SENTENCE_POSITION_FIELD, SentencePosition, ConfigFilePath);
     GConfig->GetInt(SectionName, SIGN_FONT_SIZE_FIELD, SignFontSize, ConfigFilePath);
@@ -17,6 +17,8 @@
  */
 #pragma once
 
+#include <Containers/Ticker.h>
+
 #include "ConfigStore.generated.h"
 
 UCLASS(Config = CONFIG_FILENAME)
@@ -27,6 +29,8 @@ public:
     UConfigStore(UConfigStore & Other) = delete;
     static void GetInstance(TWeakObjectPtr<UConfigStore> & ConfigStore);
     bool ReloadConfig();
+    void StartWatching(const float IntervalSeconds);
+    void StopWatching();
 
 private:
     UConfigStore() = default;
@@ -38,18 +42,38 @@ private:
     void InitInternalConfig(const FString & ConfigFilePath);
     void InitUIConfig(const FString & ConfigFilePath);
     void InitUserConfig(const FString & ConfigFilePath);
+    bool OnWatchTick(float DeltaTime);
 
     // Keep one instance
     //
     static TWeakObjectPtr<UConfigStore> Instance;
 
+    // Configuration file watch (see StartWatching()): last seen modification time of the file
+    //
+    FTSTicker::FDelegateHandle WatchTickerHandle;
+    FDateTime WatchedTimeStamp;
+
     // Below are configuration items that map to ASLMetaHumans.ini. Ensure that the naming of properties
     // (including casing) matches entries in that file. Reminder: need lowercase "b"-prefix for bool vars
     // to be recognized.
     //
     UPROPERTY(Config, GlobalConfig)
+    bool bActionReplayExitWhenDone;
+    UPROPERTY(Config, GlobalConfig)
+    bool bBackgroundIngestMipsEnabled;
+    UPROPERTY(Config, GlobalConfig)
+    bool bBackgroundIngestResizeEnabled;
+    UPROPERTY(Config, GlobalConfig)
+    bool bBackgroundS3DownloadEnabled;
+    UPROPERTY(Config, GlobalConfig)
+    bool bBackgroundWorkerDecodeEnabled;
+    UPROPERTY(Config, GlobalConfig)
+    bool bEnforceSingleInstance;
+    UPROPERTY(Config, GlobalConfig)
     bool bFlipHands;
     UPROPERTY(Config, GlobalConfig)
+    bool bGlyphAtlasEnabled;
+    UPROPERTY(Config, GlobalConfig)
     bool bHideAtmosphere;
     UPROPERTY(Config, GlobalConfig)
     bool bHideBackgroundPlane;
@@ -60,10 +84,30 @@ private:
     UPROPERTY(Config, GlobalConfig)
     bool bIgnoreSQS;
     UPROPERTY(Config, GlobalConfig)
+    bool bMqttUseTls;
+    UPROPERTY(Config, GlobalConfig)
     bool bOnlySignFixedText;
     UPROPERTY(Config, GlobalConfig)
+    bool bPoseCacheEnabled;
+    UPROPERTY(Config, GlobalConfig)
     bool bPurgeQueuesOnStartup;
     UPROPERTY(Config, GlobalConfig)
+    FString ActionFilePath;
+    UPROPERTY(Config, GlobalConfig)
+    FString ActionRecordPath;
+    UPROPERTY(Config, GlobalConfig)
+    FString ActionReplayPath;
+    UPROPERTY(Config, GlobalConfig)
+    float ActionReplaySpeed;
+    UPROPERTY(Config, GlobalConfig)
+    int ActionSocketPort;
+    UPROPERTY(Config, GlobalConfig)
+    FString ActionSource;
+    UPROPERTY(Config, GlobalConfig)
+    float AnimationLoadTimeoutSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    int AnimationResidencyBudgetMB;
+    UPROPERTY(Config, GlobalConfig)
     float AnimationSpinlockSeconds;
     UPROPERTY(Config, GlobalConfig)
     FVector2D ASLTextPosition;
@@ -74,16 +118,28 @@ private:
     UPROPERTY(Config, GlobalConfig)
     FVector AvatarRotation;
     UPROPERTY(Config, GlobalConfig)
+    int BackgroundCacheBudgetMB;
+    UPROPERTY(Config, GlobalConfig)
+    float BackgroundDownloadTimeoutSeconds;
+    UPROPERTY(Config, GlobalConfig)
     FVector BackgroundImagePlaneScale;
     UPROPERTY(Config, GlobalConfig)
     FVector BackgroundImagePlaneLocationOffset;
     UPROPERTY(Config, GlobalConfig)
     FVector BackgroundImagePlaneRotationOffset;
     UPROPERTY(Config, GlobalConfig)
+    FString BackgroundIngestFormat;
+    UPROPERTY(Config, GlobalConfig)
     FColor BackgroundLightingColor;
     UPROPERTY(Config, GlobalConfig)
     float BackgroundLightingIntensity;
     UPROPERTY(Config, GlobalConfig)
+    int BackgroundS3MaxConnections;
+    UPROPERTY(Config, GlobalConfig)
+    int BackgroundS3PartSizeKB;
+    UPROPERTY(Config, GlobalConfig)
+    int BackgroundTexturePoolSize;
+    UPROPERTY(Config, GlobalConfig)
     float CameraFOV;
     UPROPERTY(Config, GlobalConfig)
     FVector CameraLocationOffset;
@@ -100,18 +156,104 @@ private:
     UPROPERTY(Config, GlobalConfig)
     FVector2D LetterPosition;
     UPROPERTY(Config, GlobalConfig)
+    FString MqttAckTopic;
+    UPROPERTY(Config, GlobalConfig)
+    FString MqttCaFilePath;
+    UPROPERTY(Config, GlobalConfig)
+    FString MqttCertificatePath;
+    UPROPERTY(Config, GlobalConfig)
+    FString MqttClientId;
+    UPROPERTY(Config, GlobalConfig)
+    FString MqttEndpoint;
+    UPROPERTY(Config, GlobalConfig)
+    FString MqttImmediateTopic;
+    UPROPERTY(Config, GlobalConfig)
+    int MqttPort;
+    UPROPERTY(Config, GlobalConfig)
+    FString MqttPrivateKeyPath;
+    UPROPERTY(Config, GlobalConfig)
+    int MqttReconnectMaxSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    int MqttReconnectMinSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    FString MqttTranslationTopic;
+    UPROPERTY(Config, GlobalConfig)
+    FString PinnedSignTokens;
+    UPROPERTY(Config, GlobalConfig)
     float PlayStartOffset;
     UPROPERTY(Config, GlobalConfig)
     float PlayEndOffset;
     UPROPERTY(Config, GlobalConfig)
     float PlayRate;
     UPROPERTY(Config, GlobalConfig)
+    int PoseCacheHotPlays;
+    UPROPERTY(Config, GlobalConfig)
+    int PoseCacheHotSigns;
+    UPROPERTY(Config, GlobalConfig)
+    int RenderSessionCount;
+    UPROPERTY(Config, GlobalConfig)
     FVector2D SentencePosition;
     UPROPERTY(Config, GlobalConfig)
+    FString SessionAvatarNames;
+    UPROPERTY(Config, GlobalConfig)
+    float SessionAvatarSpacing;
+    UPROPERTY(Config, GlobalConfig)
+    float SessionHeartbeatSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    FString SessionIds;
+    UPROPERTY(Config, GlobalConfig)
+    float SessionLeaseSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    FString SessionRegistryBucket;
+    UPROPERTY(Config, GlobalConfig)
+    FString SessionRegistryEndpointOverride;
+    UPROPERTY(Config, GlobalConfig)
+    FString SessionRegistryRegion;
+    UPROPERTY(Config, GlobalConfig)
+    float SettingsReloadIntervalSeconds;
+    UPROPERTY(Config, GlobalConfig)
     int SignFontSize;
     UPROPERTY(Config, GlobalConfig)
+    FString SignManifestPath;
+    UPROPERTY(Config, GlobalConfig)
+    FString SignPackPath;
+    UPROPERTY(Config, GlobalConfig)
+    FString SignPackSyncBucket;
+    UPROPERTY(Config, GlobalConfig)
+    FString SignPackSyncEndpointOverride;
+    UPROPERTY(Config, GlobalConfig)
+    float SignPackSyncIntervalSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    FString SignPackSyncPrefix;
+    UPROPERTY(Config, GlobalConfig)
+    FString SignPackSyncRegion;
+    UPROPERTY(Config, GlobalConfig)
+    float SignPackSyncTimeoutSeconds;
+    UPROPERTY(Config, GlobalConfig)
     FString SQSActionQueueName;
     UPROPERTY(Config, GlobalConfig)
+    int SQSCircuitFailureThreshold;
+    UPROPERTY(Config, GlobalConfig)
+    float SQSCircuitMaxOpenSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    float SQSCircuitOpenSeconds;
+    UPROPERTY(Config, GlobalConfig)
+    int SQSConnectTimeoutMs;
+    UPROPERTY(Config, GlobalConfig)
+    FString SQSEndpointOverride;
+    UPROPERTY(Config, GlobalConfig)
+    int SQSHedgeAfterMs;
+    UPROPERTY(Config, GlobalConfig)
+    int SQSKeepAliveIntervalMs;
+    UPROPERTY(Config, GlobalConfig)
+    int SQSMaxAttempts;
+    UPROPERTY(Config, GlobalConfig)
+    int SQSRequestTimeoutMs;
+    UPROPERTY(Config, GlobalConfig)
+    int SQSRetryBaseDelayMs;
+    UPROPERTY(Config, GlobalConfig)
+    int SQSRetryMaxDelayMs;
+    UPROPERTY(Config, GlobalConfig)
     FString SQSTranslationQueueName;
     UPROPERTY(Config, GlobalConfig)
     float SQSSpinlockSeconds;
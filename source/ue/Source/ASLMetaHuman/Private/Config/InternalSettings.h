@@ -17,78 +17,326 @@
  */
 #pragma once
 
-// Represents internal settings; note: a struct could be used instead and a mutex
-// is encouraged for value synchronization needs
+// Represents internal settings. Getters read the current snapshot (see TSnapshotPublisher); read Get() once and
+// keep the reference for values that belong together
 //
+
+#include "Config/SettingsSnapshot.h"
+
 namespace ASLMetaHuman::Config {
 
 class FInternalSettings {
 public:
+    // One consistent set of internal settings (published snapshots are never modified)
+    //
+    struct FSnapshot {
+        FString ActionFilePath = "";
+        FString ActionRecordPath = "";
+        bool ActionReplayExitWhenDone = false;
+        FString ActionReplayPath = "";
+        float ActionReplaySpeed = 1.0;
+        int32 ActionSocketPort = 7777;
+        FString ActionSource = "SQS";
+        float AnimationLoadTimeoutSeconds = 5.0;
+        int32 AnimationResidencyBudgetMB = 256;
+        float AnimationSpinlockSeconds = 0.05;
+        int32 BackgroundCacheBudgetMB = 256;
+        float BackgroundDownloadTimeoutSeconds = 10.0f;
+        FString BackgroundIngestFormat = "BC7";
+        bool BackgroundIngestMipsEnabled = false;
+        bool BackgroundIngestResizeEnabled = true;
+        bool BackgroundS3DownloadEnabled = true;
+        int32 BackgroundS3MaxConnections = 8;
+        int32 BackgroundS3PartSizeKB = 1024;
+        int32 BackgroundTexturePoolSize = 2;
+        bool BackgroundWorkerDecodeEnabled = true;
+        bool EnforceSingleInstance = false;
+        FString FixedTextToSign = "";
+        float HideMessageSynchronizationMultiplier = 2.0;
+        bool IgnoreSQS = false;
+        FString MqttAckTopic = "asl/actions/ack";
+        FString MqttCaFilePath = "";
+        FString MqttCertificatePath = "";
+        FString MqttClientId = "asl-metahuman";
+        FString MqttEndpoint = "localhost";
+        FString MqttImmediateTopic = "asl/actions/immediate";
+        int32 MqttPort = 1883;
+        FString MqttPrivateKeyPath = "";
+        int32 MqttReconnectMaxSeconds = 32;
+        int32 MqttReconnectMinSeconds = 1;
+        FString MqttTranslationTopic = "asl/actions/translation";
+        bool MqttUseTls = false;
+        bool OnlySignFixedText = false;
+        FString PinnedSignTokens = "";
+        bool PoseCacheEnabled = false;
+        int32 PoseCacheHotPlays = 3;
+        int32 PoseCacheHotSigns = 32;
+        bool PurgeQueuesOnStartup = false;
+        int32 RenderSessionCount = 1;
+        float SessionHeartbeatSeconds = 10.0;
+        FString SessionIds = "";
+        float SessionLeaseSeconds = 30.0;
+        FString SessionRegistryBucket = "";
+        FString SessionRegistryEndpointOverride = "";
+        FString SessionRegistryRegion = "";
+        float SettingsReloadIntervalSeconds = 2.0;
+        FString SignManifestPath = "Content/SignManifest/SignManifest.bin";
+        FString SignPackPath = "";
+        FString SignPackSyncBucket = "";
+        FString SignPackSyncEndpointOverride = "";
+        float SignPackSyncIntervalSeconds = 300.0;
+        FString SignPackSyncPrefix = "signpacks/";
+        FString SignPackSyncRegion = "us-east-1";
+        float SignPackSyncTimeoutSeconds = 30.0;
+        int32 SQSCircuitFailureThreshold = 5;
+        float SQSCircuitMaxOpenSeconds = 60.0;
+        float SQSCircuitOpenSeconds = 2.0;
+        int32 SQSConnectTimeoutMs = 2000;
+        FString SQSEndpointOverride = "";
+        int32 SQSHedgeAfterMs = 0;
+        int32 SQSKeepAliveIntervalMs = 2000;
+        int32 SQSMaxAttempts = 3;
+        int32 SQSRequestTimeoutMs = 2000;
+        int32 SQSRetryBaseDelayMs = 100;
+        int32 SQSRetryMaxDelayMs = 2000;
+        float SQSSpinlockSeconds = 1.0;
+        FString SQSActionQueueName = "";
+        FString SQSTranslationQueueName = "";
+    };
+
+    static const FSnapshot & Get() {
+        return Snapshots.Get();
+    }
+    static TSharedRef<const FSnapshot> GetShared() {
+        return Snapshots.GetShared();
+    }
+    static void Publish(FSnapshot && Snapshot) {
+        Snapshots.Publish(MoveTemp(Snapshot));
+    }
+    template <typename FModify>
+    static void Update(FModify && Modify) {
+        Snapshots.Update(Forward<FModify>(Modify));
+    }
+
+    static FString GetActionFilePath() {
+        return Get().ActionFilePath;
+    }
+    static FString GetActionRecordPath() {
+        return Get().ActionRecordPath;
+    }
+    static bool GetActionReplayExitWhenDone() {
+        return Get().ActionReplayExitWhenDone;
+    }
+    static FString GetActionReplayPath() {
+        return Get().ActionReplayPath;
+    }
+    static float GetActionReplaySpeed() {
+        return Get().ActionReplaySpeed;
+    }
+    static int32 GetActionSocketPort() {
+        return Get().ActionSocketPort;
+    }
+    static FString GetActionSource() {
+        return Get().ActionSource;
+    }
+    static float GetAnimationLoadTimeoutSeconds() {
+        return Get().AnimationLoadTimeoutSeconds;
+    }
+    static int32 GetAnimationResidencyBudgetMB() {
+        return Get().AnimationResidencyBudgetMB;
+    }
     static float GetAnimationSpinlockSeconds() {
-        return AnimationSpinlockSeconds;
+        return Get().AnimationSpinlockSeconds;
+    }
+    static int32 GetBackgroundCacheBudgetMB() {
+        return Get().BackgroundCacheBudgetMB;
+    }
+    static float GetBackgroundDownloadTimeoutSeconds() {
+        return Get().BackgroundDownloadTimeoutSeconds;
+    }
+    static FString GetBackgroundIngestFormat() {
+        return Get().BackgroundIngestFormat;
+    }
+    static bool GetBackgroundIngestMipsEnabled() {
+        return Get().BackgroundIngestMipsEnabled;
+    }
+    static bool GetBackgroundIngestResizeEnabled() {
+        return Get().BackgroundIngestResizeEnabled;
+    }
+    static bool GetBackgroundS3DownloadEnabled() {
+        return Get().BackgroundS3DownloadEnabled;
+    }
+    static int32 GetBackgroundS3MaxConnections() {
+        return Get().BackgroundS3MaxConnections;
+    }
+    static int32 GetBackgroundS3PartSizeKB() {
+        return Get().BackgroundS3PartSizeKB;
+    }
+    static int32 GetBackgroundTexturePoolSize() {
+        return Get().BackgroundTexturePoolSize;
+    }
+    static bool GetBackgroundWorkerDecodeEnabled() {
+        return Get().BackgroundWorkerDecodeEnabled;
+    }
+    static bool GetEnforceSingleInstance() {
+        return Get().EnforceSingleInstance;
     }
     static FString GetFixedTextToSign() {
-        return FixedTextToSign;
+        return Get().FixedTextToSign;
     }
     static float GetHideMessageSynchronizationMultiplier() {
-        return HideMessageSynchronizationMultiplier;
+        return Get().HideMessageSynchronizationMultiplier;
     }
     static bool GetIgnoreSQS() {
-        return IgnoreSQS;
+        return Get().IgnoreSQS;
+    }
+    static FString GetMqttAckTopic() {
+        return Get().MqttAckTopic;
+    }
+    static FString GetMqttCaFilePath() {
+        return Get().MqttCaFilePath;
+    }
+    static FString GetMqttCertificatePath() {
+        return Get().MqttCertificatePath;
+    }
+    static FString GetMqttClientId() {
+        return Get().MqttClientId;
+    }
+    static FString GetMqttEndpoint() {
+        return Get().MqttEndpoint;
+    }
+    static FString GetMqttImmediateTopic() {
+        return Get().MqttImmediateTopic;
+    }
+    static int32 GetMqttPort() {
+        return Get().MqttPort;
+    }
+    static FString GetMqttPrivateKeyPath() {
+        return Get().MqttPrivateKeyPath;
+    }
+    static int32 GetMqttReconnectMaxSeconds() {
+        return Get().MqttReconnectMaxSeconds;
+    }
+    static int32 GetMqttReconnectMinSeconds() {
+        return Get().MqttReconnectMinSeconds;
+    }
+    static FString GetMqttTranslationTopic() {
+        return Get().MqttTranslationTopic;
+    }
+    static bool GetMqttUseTls() {
+        return Get().MqttUseTls;
     }
     static bool GetOnlySignFixedText() {
-        return OnlySignFixedText;
+        return Get().OnlySignFixedText;
+    }
+    static FString GetPinnedSignTokens() {
+        return Get().PinnedSignTokens;
+    }
+    static bool GetPoseCacheEnabled() {
+        return Get().PoseCacheEnabled;
+    }
+    static int32 GetPoseCacheHotPlays() {
+        return Get().PoseCacheHotPlays;
+    }
+    static int32 GetPoseCacheHotSigns() {
+        return Get().PoseCacheHotSigns;
     }
     static bool GetPurgeQueuesOnStartup() {
-        return PurgeQueuesOnStartup;
+        return Get().PurgeQueuesOnStartup;
+    }
+    static int32 GetRenderSessionCount() {
+        return Get().RenderSessionCount;
+    }
+    static float GetSessionHeartbeatSeconds() {
+        return Get().SessionHeartbeatSeconds;
+    }
+    static FString GetSessionIds() {
+        return Get().SessionIds;
+    }
+    static float GetSessionLeaseSeconds() {
+        return Get().SessionLeaseSeconds;
+    }
+    static FString GetSessionRegistryBucket() {
+        return Get().SessionRegistryBucket;
+    }
+    static FString GetSessionRegistryEndpointOverride() {
+        return Get().SessionRegistryEndpointOverride;
+    }
+    static FString GetSessionRegistryRegion() {
+        return Get().SessionRegistryRegion;
+    }
+    static float GetSettingsReloadIntervalSeconds() {
+        return Get().SettingsReloadIntervalSeconds;
+    }
+    static FString GetSignManifestPath() {
+        return Get().SignManifestPath;
+    }
+    static FString GetSignPackPath() {
+        return Get().SignPackPath;
+    }
+    static FString GetSignPackSyncBucket() {
+        return Get().SignPackSyncBucket;
+    }
+    static FString GetSignPackSyncEndpointOverride() {
+        return Get().SignPackSyncEndpointOverride;
+    }
+    static float GetSignPackSyncIntervalSeconds() {
+        return Get().SignPackSyncIntervalSeconds;
+    }
+    static FString GetSignPackSyncPrefix() {
+        return Get().SignPackSyncPrefix;
+    }
+    static FString GetSignPackSyncRegion() {
+        return Get().SignPackSyncRegion;
+    }
+    static float GetSignPackSyncTimeoutSeconds() {
+        return Get().SignPackSyncTimeoutSeconds;
     }
     static FString GetSQSActionQueueName() {
-        return SQSActionQueueName;
+        return Get().SQSActionQueueName;
     }
-    static FString GetSQSTranslationQueueName() {
-        return SQSTranslationQueueName;
+    static int32 GetSQSCircuitFailureThreshold() {
+        return Get().SQSCircuitFailureThreshold;
     }
-    static float GetSQSSpinlockSeconds() {
-        return SQSSpinlockSeconds;
+    static float GetSQSCircuitMaxOpenSeconds() {
+        return Get().SQSCircuitMaxOpenSeconds;
     }
-    static void SetAnimationSpinlockSeconds(const float Value) {
-        AnimationSpinlockSeconds = Value;
+    static float GetSQSCircuitOpenSeconds() {
+        return Get().SQSCircuitOpenSeconds;
     }
-    static void SetFixedTextToSign(const FString& Value) {
-        FixedTextToSign = Value;
+    static int32 GetSQSConnectTimeoutMs() {
+        return Get().SQSConnectTimeoutMs;
     }
-    static void SetHideMessageSynchronizationMultiplier(const float Value) {
-        HideMessageSynchronizationMultiplier = Value;
+    static FString GetSQSEndpointOverride() {
+        return Get().SQSEndpointOverride;
     }
-    static void SetIgnoreSQS(const bool Value) {
-        IgnoreSQS = Value;
+    static int32 GetSQSHedgeAfterMs() {
+        return Get().SQSHedgeAfterMs;
     }
-    static void SetOnlySignFixedText(const bool Value) {
-        OnlySignFixedText = Value;
+    static int32 GetSQSKeepAliveIntervalMs() {
+        return Get().SQSKeepAliveIntervalMs;
     }
-    static void SetPurgeQueuesOnStartup(const bool Value) {
-        PurgeQueuesOnStartup = Value;
+    static int32 GetSQSMaxAttempts() {
+        return Get().SQSMaxAttempts;
     }
-    static void SetSQSActionQueueName(const FString & Value) {
-        SQSActionQueueName = Value;
+    static int32 GetSQSRequestTimeoutMs() {
+        return Get().SQSRequestTimeoutMs;
     }
-    static void SetSQSTranslationQueueName(const FString & Value) {
-        SQSTranslationQueueName = Value;
+    static int32 GetSQSRetryBaseDelayMs() {
+        return Get().SQSRetryBaseDelayMs;
     }
-    static void SetSQSSpinlockSeconds(const float Value) {
-        SQSSpinlockSeconds = Value;
+    static int32 GetSQSRetryMaxDelayMs() {
+        return Get().SQSRetryMaxDelayMs;
+    }
+    static FString GetSQSTranslationQueueName() {
+        return Get().SQSTranslationQueueName;
+    }
+    static float GetSQSSpinlockSeconds() {
+        return Get().SQSSpinlockSeconds;
     }
 
 private:
     FInternalSettings();
-    static inline float AnimationSpinlockSeconds = 0.05;
-    static inline FString FixedTextToSign = "";
-    static inline float HideMessageSynchronizationMultiplier = 2.0;
-    static inline bool IgnoreSQS = false;
-    static inline bool OnlySignFixedText = false;
-    static inline bool PurgeQueuesOnStartup = false;
-    static inline float SQSSpinlockSeconds = 1.0;
-    static inline FString SQSActionQueueName = "";
-    static inline FString SQSTranslationQueueName = "";
+    static inline TSnapshotPublisher<FSnapshot> Snapshots;
 };
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Publication of immutable settings snapshots: readers get the current snapshot with a single atomic load (getters
+// copy a value out right away) or keep one consistent set for as long as they need it (GetShared(), e.g. for a whole
+// sentence); writers build a replacement on the side and publish it.
+//
+// Reclamation is deferred to the writer: a replaced snapshot is retired and released by a later publication once it's
+// been retired for RetireSeconds, which no short read lasts; holders of GetShared() keep it alive past that. So
+// frequent publications (console variables, CHANGE_SETTINGS actions) don't accumulate, and reads write no shared state.
+//
+
+#include <CoreMinimal.h>
+
+#include <atomic>
+
+namespace ASLMetaHuman::Config {
+
+// Publications that span several settings classes (a configuration reload, a settings change) run one at a time and
+// bump a generation before and after (odd while in progress). Readers that need one snapshot of each class from the
+// same publication (e.g. a sentence as it starts) retry until no publication ran meanwhile, without locking
+//
+class FSettingsPublication {
+public:
+    template <typename FPublishAll>
+    static void Publish(FPublishAll && PublishAll) {
+        FScopeLock ScopeLock(&MutexPublication);
+        Generation.fetch_add(1);
+        PublishAll();
+        Generation.fetch_add(1);
+    }
+
+    template <typename FReadAll>
+    static auto Read(FReadAll && ReadAll) {
+        while (true) {
+            const uint64 StartGeneration = Generation.load();
+            if (0 == (StartGeneration & 1)) {
+                auto Snapshots = ReadAll();
+                if (Generation.load() == StartGeneration) {
+                    return Snapshots;
+                }
+            }
+            FPlatformProcess::Yield();
+        }
+    }
+
+private:
+    static inline FCriticalSection MutexPublication;
+    static inline std::atomic<uint64> Generation {0};
+};
+
+template <typename T>
+class TSnapshotPublisher {
+public:
+    TSnapshotPublisher() {
+        PublishLocked(T());
+    }
+    TSnapshotPublisher(const TSnapshotPublisher &) = delete;
+    TSnapshotPublisher & operator=(const TSnapshotPublisher &) = delete;
+
+    ~TSnapshotPublisher() {
+        delete Current.load();
+    }
+
+    // Returns the current snapshot (the defaults before the first Publish()). Note: only valid for a short read (e.g.
+    // copying values out); use GetShared() to keep the snapshot
+    //
+    const T & Get() const {
+        return *Current.load(std::memory_order_acquire)->Value;
+    }
+
+    // Returns the current snapshot, kept alive for as long as the reference is held
+    //
+    TSharedRef<const T> GetShared() const {
+        return Current.load(std::memory_order_acquire)->Value;
+    }
+
+    // Publishes Snapshot to subsequent readers
+    //
+    void Publish(T && Snapshot) {
+        FScopeLock ScopeLock(&MutexPublish);
+        PublishLocked(MoveTemp(Snapshot));
+    }
+
+    // Publishes a copy of the current snapshot changed by Modify (concurrent updates aren't lost)
+    //
+    template <typename FModify>
+    void Update(FModify && Modify) {
+        FScopeLock ScopeLock(&MutexPublish);
+        T Snapshot = Get();
+        Modify(Snapshot);
+        PublishLocked(MoveTemp(Snapshot));
+    }
+
+private:
+    struct FEntry {
+        TSharedRef<const T> Value;
+        double RetiredSeconds {0.0};
+    };
+
+    static constexpr double RetireSeconds {10.0};
+
+    void PublishLocked(T && Snapshot) {
+        const double NowSeconds = FPlatformTime::Seconds();
+        Retired.RemoveAll([NowSeconds](const TUniquePtr<FEntry> & Entry) {
+            return NowSeconds - Entry->RetiredSeconds > RetireSeconds;
+        });
+        FEntry * Previous = Current.exchange(new FEntry {MakeShared<T>(MoveTemp(Snapshot))}, std::memory_order_acq_rel);
+        if (nullptr != Previous) {
+            Previous->RetiredSeconds = NowSeconds;
+            Retired.Emplace(Previous);
+        }
+    }
+
+    std::atomic<FEntry *> Current {nullptr};
+    TArray<TUniquePtr<FEntry>> Retired;
+    FCriticalSection MutexPublish;
+};
+}
\ No newline at end of file
@@ -17,92 +17,86 @@
  */
 #pragma once
 
-// Represents user interface settings; note: a struct could be used instead and a mutex
-// is encouraged for value synchronization needs
+// Represents user interface settings. Getters read the current snapshot (see TSnapshotPublisher); read Get() once and
+// keep the reference for values that belong together
 //
+
+#include "Config/SettingsSnapshot.h"
+
 namespace ASLMetaHuman::Config {
 
 class FUISettings {
 public:
+    // One consistent set of user interface settings (published snapshots are never modified)
+    //
+    struct FSnapshot {
+        FString FontPath {""};
+        unsigned int FontSize {14};
+        bool GlyphAtlasEnabled = true;
+        unsigned int SignFontSize {14};
+        FVector BackgroundImagePlaneScale {1.25, 0.75, 1.0};
+        FVector BackgroundImagePlaneLocationOffset {200, 200, 200};
+        FVector BackgroundImagePlaneRotationOffset {200, 200, 200};
+        FVector2D ASLTextPosition {300, 300};
+        FVector2D LetterPosition {300, 300};
+        FVector2D SentencePosition {100, 100};
+        FVector2D TokenPosition {200, 200};
+        bool UseEntireBackgroundForImages {false};
+    };
+
+    static const FSnapshot & Get() {
+        return Snapshots.Get();
+    }
+    static TSharedRef<const FSnapshot> GetShared() {
+        return Snapshots.GetShared();
+    }
+    static void Publish(FSnapshot && Snapshot) {
+        Snapshots.Publish(MoveTemp(Snapshot));
+    }
+    template <typename FModify>
+    static void Update(FModify && Modify) {
+        Snapshots.Update(Forward<FModify>(Modify));
+    }
+
     static FString GetFontPath() {
-        return FontPath;
+        return Get().FontPath;
     }
     static unsigned int GetFontSize() {
-        return FontSize;
+        return Get().FontSize;
     }
     static void GetASLTextPosition(FVector2D & Value) {
-        Value = ASLTextPosition;
+        Value = Get().ASLTextPosition;
     }
     static void GetBackgroundImagePlaneLocationOffset(FVector & Value) {
-        Value = BackgroundImagePlaneLocationOffset;
+        Value = Get().BackgroundImagePlaneLocationOffset;
     }
     static void GetBackgroundImagePlaneRotationOffset(FVector & Value) {
-        Value = BackgroundImagePlaneRotationOffset;
+        Value = Get().BackgroundImagePlaneRotationOffset;
     }
     static void GetBackgroundImagePlaneScale(FVector & Value) {
-        Value = BackgroundImagePlaneScale;
+        Value = Get().BackgroundImagePlaneScale;
+    }
+    static bool GetGlyphAtlasEnabled() {
+        return Get().GlyphAtlasEnabled;
     }
     static void GetLetterPosition(FVector2D & Value) {
-        Value = LetterPosition;
+        Value = Get().LetterPosition;
     }
     static void GetSentencePosition(FVector2D & Value) {
-        Value = SentencePosition;
+        Value = Get().SentencePosition;
     }
     static unsigned int GetSignFontSize() {
-        return SignFontSize;
+        return Get().SignFontSize;
     }
     static void GetTokenPosition(FVector2D & Value) {
-        Value = TokenPosition;
+        Value = Get().TokenPosition;
     }
     static bool GetUseEntireBackgroundForImages() {
-        return UseEntireBackgroundForImages;
-    }
-    static void SetBackgroundImagePlaneLocationOffset(const FVector & Value) {
-        BackgroundImagePlaneLocationOffset = Value;
-    }
-    static void SetBackgroundImagePlaneRotationOffset(const FVector & Value) {
-        BackgroundImagePlaneRotationOffset = Value;
-    }
-    static void SetBackgroundImagePlaneScale(const FVector & Value) {
-        BackgroundImagePlaneScale = Value;
-    }
-    static void SetFontPath(const FString & Value) {
-        FontPath = Value;
-    }
-    static void SetFontSize(const unsigned int Value) {
-        FontSize = Value;
-    }
-    static void SetSignFontSize(const unsigned int Value) {
-        SignFontSize = Value;
-    }
-    static void SetLetterPosition(const FVector2D & Value) {
-        LetterPosition = Value;
-    }
-    static void SetASLTextPosition(const FVector2D & Value) {
-        ASLTextPosition = Value;
-    }
-    static void SetSentencePosition(const FVector2D & Value) {
-        SentencePosition = Value;
-    }
-    static void SetTokenPosition(const FVector2D & Value) {
-        TokenPosition = Value;
-    }
-    static void SetUseEntireBackgroundForImages(const bool Value) {
-        UseEntireBackgroundForImages = Value;
+        return Get().UseEntireBackgroundForImages;
     }
 
 private:
     FUISettings();
-    static inline FString FontPath {""};
-    static inline unsigned int FontSize {14};
-    static inline unsigned int SignFontSize {14};
-    static inline FVector BackgroundImagePlaneScale {1.25, 0.75, 1.0};
-    static inline FVector BackgroundImagePlaneLocationOffset {200, 200, 200};
-    static inline FVector BackgroundImagePlaneRotationOffset {200, 200, 200};
-    static inline FVector2D ASLTextPosition {300, 300};
-    static inline FVector2D LetterPosition {300, 300};
-    static inline FVector2D SentencePosition {100, 100};
-    static inline FVector2D TokenPosition {200, 200};
-    static inline bool UseEntireBackgroundForImages {false};
+    static inline TSnapshotPublisher<FSnapshot> Snapshots;
 };
 }
\ No newline at end of file
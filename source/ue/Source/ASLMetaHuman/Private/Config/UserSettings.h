@@ -17,141 +17,118 @@
  */
 #pragma once
 
-// Represents general user settings; note: a struct could be used instead and a mutex
-// is encouraged for value synchronization needs
+// Represents general user settings. Getters read the current snapshot (see TSnapshotPublisher); read Get() once and
+// keep the reference for values that belong together
 //
+
+#include "Config/SettingsSnapshot.h"
+
 namespace ASLMetaHuman::Config {
 
 class FUserSettings {
 public:
+    // One consistent set of user settings (published snapshots are never modified)
+    //
+    struct FSnapshot {
+        FString AvatarName = "";
+        FVector AvatarLocation = FVector(130, -20, 20);
+        FVector AvatarRotation = FVector(0, 0, 90);
+        FColor BackgroundLightingColor = FColor(0, 0, 0);
+        float BackgroundLightingIntensity = 0.0f;
+        float BackgroundLightingRadius = 0.0f;
+        float CameraFOV = 100.0f;
+        FVector CameraLocationOffset = FVector(0, 0, 0);
+        FVector CameraRotationOffset = FVector(0, 0, 0);
+        bool FlipHands = true;
+        bool HideAtmosphere = false;
+        bool HideBackgroundPlane = true;
+        bool HideSkyLight = false;
+        bool HideSpotLight = false;
+        float PlayStartOffset = 0.8f;
+        float PlayEndOffset = 0.8f;
+        float PlayRate = 3.0f;
+        FString SessionAvatarNames = "";
+        float SessionAvatarSpacing = 120.0;
+        float WordTransitionDelaySeconds = 1.2f;
+    };
+
+    static const FSnapshot & Get() {
+        return Snapshots.Get();
+    }
+    static TSharedRef<const FSnapshot> GetShared() {
+        return Snapshots.GetShared();
+    }
+    static void Publish(FSnapshot && Snapshot) {
+        Snapshots.Publish(MoveTemp(Snapshot));
+    }
+    template <typename FModify>
+    static void Update(FModify && Modify) {
+        Snapshots.Update(Forward<FModify>(Modify));
+    }
+
     static FString GetAvatarName() {
-        return AvatarName;
+        return Get().AvatarName;
     }
     static void GetAvatarLocation(FVector & Value) {
-        Value = AvatarLocation;
+        Value = Get().AvatarLocation;
     }
     static void GetAvatarRotation(FVector & Value) {
-        Value = AvatarRotation;
+        Value = Get().AvatarRotation;
     }
     static void GetBackgroundLightingColor(FColor & Value) {
-        Value = BackgroundLightingColor;
+        Value = Get().BackgroundLightingColor;
     }
     static float GetBackgroundLightingIntensity() {
-        return BackgroundLightingIntensity;
+        return Get().BackgroundLightingIntensity;
     }
     static float GetBackgroundLightingRadius() {
-        return BackgroundLightingRadius;
+        return Get().BackgroundLightingRadius;
     }
     static float GetCameraFOV() {
-        return CameraFOV;
+        return Get().CameraFOV;
     }
     static void GetCameraLocationOffset(FVector & Value) {
-        Value = CameraLocationOffset;
+        Value = Get().CameraLocationOffset;
     }
     static void GetCameraRotationOffset(FVector & Value) {
-        Value = CameraRotationOffset;
+        Value = Get().CameraRotationOffset;
     }
     static float GetFlipHands() {
-        return FlipHands;
+        return Get().FlipHands;
     }
     static bool GetHideAtmosphere() {
-        return HideAtmosphere;
+        return Get().HideAtmosphere;
     }
     static bool GetHideBackgroundPlane() {
-        return HideBackgroundPlane;
+        return Get().HideBackgroundPlane;
     }
     static bool GetHideSkyLight() {
-        return HideSkyLight;
+        return Get().HideSkyLight;
     }
     static bool GetHideSpotLight() {
-        return HideSpotLight;
+        return Get().HideSpotLight;
     }
     static float GetPlayEndOffset() {
-        return PlayEndOffset;
+        return Get().PlayEndOffset;
     }
     static float GetPlayRate() {
-        return PlayRate;
+        return Get().PlayRate;
     }
     static float GetPlayStartOffset() {
-        return PlayStartOffset;
-    }
-    static float GetWordTransitionDelay() {
-        return WordTransitionDelaySeconds;
-    }
-    static void SetAvatarName(const FString & Value) {
-        AvatarName = Value;
-    }
-    static void SetAvatarLocation(const FVector & Value) {
-        AvatarLocation = Value;
-    }
-    static void SetAvatarRotation(const FVector & Value) {
-        AvatarRotation = Value;
+        return Get().PlayStartOffset;
     }
-    static void SetBackgroundLightingColor(const FColor & Value) {
-        BackgroundLightingColor = Value;
+    static FString GetSessionAvatarNames() {
+        return Get().SessionAvatarNames;
     }
-    static void SetBackgroundLightingIntensity(const float Value) {
-        BackgroundLightingIntensity = Value;
+    static float GetSessionAvatarSpacing() {
+        return Get().SessionAvatarSpacing;
     }
-    static void SetBackgroundLightingRadius(const float Value) {
-        BackgroundLightingRadius = Value;
-    }
-    static void SetCameraFOV(const float Value) {
-        CameraFOV = Value;
-    }
-    static void SetCameraLocationOffset(const FVector & Value) {
-        CameraLocationOffset = Value;
-    }
-    static void SetCameraRotationOffset(const FVector & Value) {
-        CameraRotationOffset = Value;
-    }
-    static void SetFlipHands(const bool Value) {
-        FlipHands = Value;
-    }
-    static void SetHideAtmosphere(const bool Value) {
-        HideAtmosphere = Value;
-    }
-    static void SetHideBackgroundPlane(const bool Value) {
-        HideBackgroundPlane = Value;
-    }
-    static void SetHideSkyLight(const bool Value) {
-        HideSkyLight = Value;
-    }
-    static void SetHideSpotLight(const bool Value) {
-        HideSpotLight = Value;
-    }
-    static void SetPlayEndOffset(const float Value) {
-        PlayEndOffset = Value;
-    }
-    static void SetPlayRate(const float Value) {
-        PlayRate = Value;
-    }
-    static void SetPlayStartOffset(const float Value) {
-        PlayStartOffset = Value;
-    }
-    static void SetWordTransitionDelay(const float Value) {
-        WordTransitionDelaySeconds = Value;
+    static float GetWordTransitionDelay() {
+        return Get().WordTransitionDelaySeconds;
     }
 
 private:
     FUserSettings();
-    static inline FString AvatarName = "";
-    static inline FVector AvatarLocation = FVector(130, -20, 20);
-    static inline FVector AvatarRotation = FVector(0, 0, 90);
-    static inline FColor BackgroundLightingColor = FColor(0, 0, 0);
-    static inline float BackgroundLightingIntensity = 0.0f;
-    static inline float BackgroundLightingRadius = 0.0f;
-    static inline float CameraFOV = 100.0f;
-    static inline FVector CameraLocationOffset = FVector(0, 0, 0);
-    static inline FVector CameraRotationOffset = FVector(0, 0, 0);
-    static inline bool FlipHands = true;
-    static inline bool HideAtmosphere = false;
-    static inline bool HideBackgroundPlane = true;
-    static inline bool HideSkyLight = false;
-    static inline bool HideSpotLight = false;
-    static inline float PlayStartOffset = 0.8f;
-    static inline float PlayEndOffset = 0.8f;
-    static inline float PlayRate = 3.0f;
-    static inline float WordTransitionDelaySeconds = 1.2f;
+    static inline TSnapshotPublisher<FSnapshot> Snapshots;
 };
 }
\ No newline at end of file
@@ -53,6 +53,7 @@ enum class EASLMetaHumanActionType : uint8 {
     ANIMATE_SENTENCE,
     CHANGE_AVATAR,
     CHANGE_BACKGROUND,
+    CHANGE_SETTINGS,
     CHANGE_SIGN_RATE,
     STOP_ALL_ANIMATIONS,
 };
@@ -17,7 +17,7 @@
  */
 #pragma once
 
-// Supports main ASL Demo workflow
+// Supports main ASL Demo workflow: owns the shared sign dictionary and the render sessions
 //
 
 // Note: Making this class a UClass is possible, though there are some concerns about object lifetime.
@@ -25,11 +25,12 @@
 // PROPERTY() decorating, AddRoot(), TArray copies, TWeakObjectPtr usage.
 //
 
-#include <Animation/AnimSequence.h>
 #include <Engine.h>
 
-#include "ASLMetaHumanAction.h"
-#include "AsynchronousSQSWorker.h"
+#include "ASLMetaHumanSession.h"
+#include "ASLMetaHumanSignDictionary.h"
+#include "GlyphAtlas.h"
+#include "SignPackSync.h"
 
 #include <Tools/ControlRigPose.h>
 
@@ -55,156 +56,38 @@ private:
     ASLMetaHumanDemo & operator=(const ASLMetaHumanDemo &) = delete;
     ASLMetaHumanDemo(ASLMetaHumanDemo const &) = delete;
 
-    // Returns whether animation pipeline cancellation was initiated
-    //
-    static bool IsCancelling() {
-        FScopeLock ScopeLock(&MutexCancellationActive);
-        return CancellationActive;
-    }
-
-    // Returns false if there's an animation in progress; true otherwise
-    //
-    static bool IsReadyToAnimateNextSentence() {
-        FScopeLock ScopeLock(&MutexReadyToAnimateNextSentence);
-        return ReadyToAnimateNextSentence;
-    }
-
-    // Returns false if there is an animation in progress; true otherwise
-    //
-    static bool IsReadyToAnimateNextToken() {
-        FScopeLock ScopeLock(&MutexReadyToAnimateNextToken);
-        return ReadyToAnimateNextToken;
-    }
-
-    // Updates the cancellation state of the animation pipeline
-    //
-    static void SetCancellingState(const bool State) {
-        FScopeLock ScopeLock(&MutexCancellationActive);
-        CancellationActive = State;
-    }
-
-    // Allows another sentence to be processed if State==true; else current animation is not interrupted
-    //
-    static void SetReadyToAnimateNextSentence(const bool State) {
-        FScopeLock ScopeLock(&MutexReadyToAnimateNextSentence);
-        ReadyToAnimateNextSentence = State;
-    }
-
-    // Allows another animation to be processed if State==true; else current animation is not interrupted
-    //
-    static void SetReadyToAnimateNextToken(const bool State) {
-        FScopeLock ScopeLock(&MutexReadyToAnimateNextToken);
-        ReadyToAnimateNextToken = State;
-    }
-
-    void ActionHandler(const ASLMetaHumanAction & Action);
-    bool AnimateIndividualLettersForToken(const FString & Token);
-    void AnimateSentence(const FString & Sentence,
-            const FString & ASLText,
-            const EASLMetaHumanSentimentType Sentiment = EASLMetaHumanSentimentType::NONE,
-            const bool Verbose = false);
-    bool AnimateSequence(const FString & Token, const float Rate, const float StartPosition);
-    bool AnimateToken(const FString & Token, const bool FinalToken = false);
-    void AssignBackgroundTexture(const FString & SignedUrl, const bool Verbose = false);
-    void ChangeSignRate(const float SignRate, const bool Verbose = false);
-    void DisplaySentencePairs(const FString & Sentence, const FString & ASLText);
-    void DisplaySentiment(const EASLMetaHumanSentimentType SentimentType);
-    void DisplayToken(const FString & Token);
-    void DisplayTokenComponent(const FString & Token);
     void DisplayVersion();
-    float GetAnimationDuration(const FString & Token);
     bool Init();
-    void InitAnimations();
-    void InitAnimationSequences(const FString & AnimationPath);
+    void CreateGlyphAtlas();
+    void CreateSessions();
+    void InitActionSources();
     bool InitInternalUEObjectReferences();
-    void InitSQSBackgroundWorker();
+    bool InitSessionAvatars();
     bool InitUEObjectsAndEnvironment();
-    void OnAssign2DTextureToBackground(const UTexture2DDynamic * DynamicTexture);
-    void RunInternalTestAction(const FString & JsonPayload);
-    void ResetToBeginState();
-    void StopAllAnimations(const bool Verbose = false);
-    void SwapWithActiveAvatar(const TWeakObjectPtr<AActor> & BPActorNewPtr);
-    bool SwitchAvatar(const FString & AvatarName, const bool Verbose = false);
-
-    // Tracks state: shutdown requests and readiness to process next word token - with related protection
-    //
-    static inline bool ReadyToAnimateNextToken = true;
-    static inline FCriticalSection MutexReadyToAnimateNextToken;
-    static inline bool ReadyToAnimateNextSentence = true;
-    static inline FCriticalSection MutexReadyToAnimateNextSentence;
-
-    // Tracks state of animation pipeline cancellation requests
-    //
-    static inline bool CancellationActive = false;
-    static inline FCriticalSection MutexCancellationActive;
+    void OpenSessions();
 
     static inline bool IsInitialized = false;
 
     static inline TUniquePtr<ASLMetaHumanDemo> DemoInstancePtr;
 
-    // For external classes (SQS handler) to invoke actions
-    //
-    TDelegate<void(const ASLMetaHumanAction &)> ActionHandlerDelegate;
-
-    // For external classes (UE download handler) to invoke actions
-    //
-    TDelegate<void(const UTexture2DDynamic *)> DownloadTextureDelegate;
-
-    // Blueprint-based Actor object access - MetaHuman actor
-    //
-    TWeakObjectPtr<AActor> BPActorInternalPtr;
-
-    // Access to skeleton of animating character or blueprint.
-    // Note: "Body" is referring to hand/fingers component in the MetaHumans rig.
-    //
-    TWeakObjectPtr<USkeletalMeshComponent> SkeletalMeshBodyComponentInternalPtr;
-
-    // Background Plane Actor (for changing backgrounds) and Heads Up Display Actor
+    // ASL sign vocabulary shared by all sessions
     //
-    TWeakObjectPtr<AStaticMeshActor> PlaneActorPtr;
-    //TWeakObjectPtr<AStaticMeshActor> PlaneHUDActorPtr;
+    ASLMetaHumanSignDictionary SignDictionary;
 
-    // Stores references to animation sequences by character and whole word (if it is defined)
-    // Note: this likely won't scale well for a complete ASL alphabet and should instead
-    // consider contextual information/ASL rules while feeding in skeleton motion data associated
+    // Keeps the sign pack up to date from S3 (only with SignPackSyncBucket)
     //
-    TMap<FString, TWeakObjectPtr<UAnimSequence>> * AnimationSequenceByTokenMap;
+    TUniquePtr<FSignPackSync> SignPackSync;
 
-    // Pairwise-related to AnimationSequenceByTokenMap keys - the length in seconds of an animation sequence
+    // Render sessions hosted by this process (RenderSessionCount, side by side)
     //
-    TMap<FString, float> * AnimationSequenceLengthByTokenMap;
-
-    // Tracks individual ASL translations by the number of words that they contain
-    //
-    TMap<unsigned int, TArray<FString>> * TranslatableTokensByWordCount;
-
-    // Holds background static mesh component materials (for changing backgrounds)
-    //
-    TWeakObjectPtr<UMaterialInstanceDynamic> DynamicBackgroundMaterialInstancePtr;
-    TWeakObjectPtr<UMaterialInterface> DynamicBackgroundMaterialInterfacePtr;
-    TWeakObjectPtr<UMaterialInterface> DefaultBackgroundMaterialInterfacePtr;
-
-    // Background worker that receives ASL requests
-    //
-    TUniquePtr<FAsyncTask<FAsynchronousSqsWorker>> SQSWorkerTaskPtr;
-
-    // Font preserving to prevent crashes (and having to resolve font many times)
-    //
-    TWeakObjectPtr<UFont> FontPtr;
-
-    FVector2D ViewportSize;
+    TArray<TUniquePtr<ASLMetaHumanSession>> Sessions;
 
-    // X,Y position for status update text
+    // Font, background plane and background materials resolved once for all sessions
     //
-    FVector2D GeneralStatusPosition;
+    FASLMetaHumanSharedObjects SharedObjects;
 
-    // On-screen message hiding triggers to avoid having to pre-compute animation durations.
-    // Changing their value will trigger HUD/UI element visibility changes. Consider packing into a structure.
+    // Pre-rasterized fingerspelling glyphs shared by the sessions' HUDs (only with GlyphAtlasEnabled)
     //
-    FThreadSafeBool HideSimplifiedSentenceTrigger = false;
-    FThreadSafeBool HideASLSentenceTrigger = false;
-    FThreadSafeBool HideTokenTextTrigger = false;
-    FThreadSafeBool HideTokenComponentTextTrigger = false;
-    FThreadSafeBool HideSentimentTrigger = false;
+    TSharedPtr<const FGlyphAtlas> GlyphAtlas;
 };
 }
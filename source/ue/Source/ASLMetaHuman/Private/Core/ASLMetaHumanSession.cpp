@@ -0,0 +1,991 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// This implementation drives one render session of the ASL Demo: sentence animation, HUD messages and actions
+//
+
+#include "ASLMetaHumanSession.h"
+#include "ASLAlgorithms.h"
+#include "ASLMetaHumanAction.h"
+#include "ASLMetaHumanSentenceAction.h"
+#include "BackgroundImageLoader.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+#include "Config/UISettings.h"
+#include "Config/UserSettings.h"
+#include "SettingsTuning.h"
+#include "SignPoseAnimInstance.h"
+#include "TimerWheel.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Async/Async.h>
+#include <Kismet/KismetMathLibrary.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Config::FSettingsPublication;
+using ASLMetaHuman::Config::FUISettings;
+using ASLMetaHuman::Config::FUserSettings;
+using ASLMetaHuman::Core::ASLAlgorithms;
+using ASLMetaHuman::Core::ASLMetaHumanAction;
+using ASLMetaHuman::Core::ASLMetaHumanAnimateSentenceAction;
+using ASLMetaHuman::Core::ASLMetaHumanSession;
+using ASLMetaHuman::Core::ASLMetaHumanSignDictionary;
+using ASLMetaHuman::Core::EHudSlot;
+using ASLMetaHuman::Core::FASLMetaHumanSharedObjects;
+using ASLMetaHuman::Core::FBackgroundImageIngest;
+using ASLMetaHuman::Core::FBackgroundImageLoader;
+using ASLMetaHuman::Core::FBackgroundTextureCache;
+using ASLMetaHuman::Core::FGlyphAtlas;
+using ASLMetaHuman::Core::FHudOverlay;
+using ASLMetaHuman::Core::FSettingsTuning;
+using ASLMetaHuman::Core::FSignPoseTracks;
+using ASLMetaHuman::Core::FSignVocabulary;
+using ASLMetaHuman::Core::FTimerWheel;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+// Blueprint Actor-specific naming convention (for MetaHuman)
+// Provides access to Actor's Skeletal Mesh Components
+// Notice the (compiled) BP paths ending in _C
+//
+const auto BPActorObjectPathFormat {TEXT("Blueprint'/Game/MetaHumans/{0}/BP_{0}.BP_{0}_C'")};
+// Consider exposing/configuring these (hardcoded) Content paths into an outside configuration file (ASLMetaHuman.ini)
+//
+const auto DefaultBackgroundMaterialPath {TEXT("/Material'/Game/Custom/AWS-reInvent-Logo_Mat.AWS-reInvent-Logo_Mat'")};
+constexpr int64 BytesPerMB {1024 * 1024};
+// Action source that can be turned off via bIgnoreSQS
+//
+const FString & SQSActionSourceName {"SQS"};
+// Important: links to a material's texture's parameter name, which needs to match in order to change that texture!
+//
+const auto TextureImageParameterName {FName("Image")};
+// Timing specific settings
+//
+constexpr int SQSShutdownWaitTimeSeconds {2};
+constexpr float UpdateMessageDurationSeconds {2.0f};
+constexpr float RunTestActionDelaySeconds {2.0f};
+// Conventions for distinguishing similar signs (can extend more broadly)
+//
+const FString & LetterIAsSubject {"I"};
+const FString & LetterIAsAlphabetSymbol {"_I"};
+const FString & AnimationNameWordDelimiterStr {"_"};
+const FString & AnimationNameWordSpaceStr {" "};
+// Action Update HUD Messages
+//
+const FString & AnimateSentenceMessage {"ANIMATE SENTENCE"};
+const FString & ChangingAvatarMessage {"CHANGING AVATAR"};
+const FString & ChangingBackgroundMessage {"CHANGING BACKGROUND"};
+const FString & ChangingSettingsMessage {"SETTINGS CHANGED"};
+const FString & ChangingSignRateMessage {"CHANGING SIGN RATE"};
+const FString & RejectedSettingsMessage {"SETTINGS REJECTED"};
+const FString & StoppingAnimationMessage {"STOPPING ANIMATION"};
+const auto SettingsStatusFormat {TEXT("{0}: {1}")};
+// Sentence-related HUD Status Messages
+//
+const auto SentenceOutputFormat {TEXT("GenAI simplification: {0}")};
+const auto ASLOutputFormat {TEXT("GenAI ASL: {0}")};
+const auto SentimentPromptMessageFormat {TEXT("Sentiment: {0}")};
+const FString & NegativeSentimentMessage {"negative :/"};
+const FString & PositiveSentimentMessage {"positive ^_^"};
+const FString & MixedSentimentMessage {"mixed (o-o)"};
+const FString & NeutralSentimentMessage {"neutral(-)"};
+const FString & ShockedSentimentMessage {"shocked (!)"};
+// UI settings - note: these could migrate into a config file (ASLMetaHuman.ini)
+//
+constexpr int SentimentHorizontalLocation = 50;
+constexpr int SentimentFontSize = 40;
+constexpr float StatusHorizontalProportion = 0.75;
+constexpr int StatusVerticalOffset = -50;
+// Logging
+//
+constexpr auto & InfoBackgroundNotOwnedFormatted = TEXT("Session %d doesn't own the background plane: background change ignored");
+constexpr auto & WarningAvatarInUseFormatted = TEXT("Avatar %s is already used by another session (session %d)");
+}
+
+ASLMetaHumanSession::ASLMetaHumanSession(const int32 InSessionIndex, const ASLMetaHumanSignDictionary & InDictionary):
+    SessionIndex(InSessionIndex),
+    Dictionary(InDictionary),
+    PlayRate(FUserSettings::GetPlayRate()) {
+}
+
+ASLMetaHumanSession::~ASLMetaHumanSession() {
+    FScopeLock ScopeLock(&MutexActiveAvatarNames);
+    ActiveAvatarNames.Remove(AvatarNameInUse);
+}
+
+// Takes this session's avatar and HUD region. Returns true if the avatar could be initialized; false otherwise.
+//
+bool ASLMetaHumanSession::Init(const FString & AvatarName,
+        const FASLMetaHumanSharedObjects & SharedObjects,
+        const FVector2D & InRegionOffset,
+        const FVector2D & InRegionSize) {
+    Shared = SharedObjects;
+    RegionOffset = InRegionOffset;
+    RegionSize = InRegionSize;
+    if (nullptr != Shared.PlaneActorPtr) {
+        BackgroundCache = MakeShared<FBackgroundTextureCache>(
+                static_cast<int64>(FMath::Max(0, FInternalSettings::GetBackgroundCacheBudgetMB())) * BytesPerMB,
+                FMath::Max(0, FInternalSettings::GetBackgroundTexturePoolSize()));
+    }
+    UnrealAPI::GetViewportSize(ViewportSize, true);
+    StatusPosition = ToRegion(FVector2D(UKismetMathLibrary::FFloor(ViewportSize.X * StatusHorizontalProportion),
+            ViewportSize.Y + StatusVerticalOffset));
+    TStaticArray<int32, FHudOverlay::NumSlots> FontSizes;
+    for (auto & FontSize: FontSizes) {
+        FontSize = FUISettings::GetFontSize();
+    }
+    FontSizes[static_cast<int32>(EHudSlot::Letter)] = FUISettings::GetSignFontSize();
+    FontSizes[static_cast<int32>(EHudSlot::Sentiment)] = SentimentFontSize;
+    Hud = MakeUnique<FHudOverlay>(Shared.FontPtr.Get(), FontSizes);
+    AvatarReady = SwitchAvatar(AvatarName);
+    return AvatarReady;
+}
+
+// Sets up a background thread to check for (and act on) this session's action requests - including sentence
+// animation. The configured action source (SQS by default) determines where those requests come from; the worker
+// claims one of SessionCandidates (all of SessionIds if empty). Note: nothing is dispatched before OpenActionSource()
+//
+void ASLMetaHumanSession::InitActionSourceWorker(const TArray<FString> & SessionCandidates) {
+    const FString & ActionSource = FInternalSettings::GetActionSource();
+    if (FInternalSettings::GetIgnoreSQS() && ActionSource.Equals(SQSActionSourceName, ESearchCase::IgnoreCase)) {
+        return;
+    }
+    auto Worker = FAsynchronousActionWorker::Create(
+            ActionSource, ActionHandlerDelegate.CreateRaw(this, &ASLMetaHumanSession::ActionHandler));
+    if (nullptr == Worker) {
+        return;
+    }
+    Worker->SetSessionSlot(SessionIndex, SessionCandidates);
+    Worker->SetDispatchEnabled(false);
+    ActionWorkerPtr = Worker.Get();
+    ActionWorkerTaskPtr = MakeUnique<FAsyncTask<FAsynchronousActionWorkerTask>>(MoveTemp(Worker));
+    ActionWorkerTaskPtr->StartBackgroundTask();
+}
+
+// Note: the background downloader needs the AWS SDK, which is initialized by now
+//
+void ASLMetaHumanSession::OpenActionSource() {
+    if ((nullptr != Shared.PlaneActorPtr) && (nullptr == BackgroundDownloader)) {
+        BackgroundDownloader = FBackgroundImageLoader::CreateDownloader();
+    }
+    if (AvatarReady && (nullptr != ActionWorkerPtr)) {
+        ActionWorkerPtr->SetDispatchEnabled(true);
+    }
+}
+
+// Stops the ongoing animation (if any) and the action source (even if blocked)
+//
+void ASLMetaHumanSession::Shutdown() {
+    if (nullptr != SkeletalMeshBodyComponentInternalPtr) {
+        SkeletalMeshBodyComponentInternalPtr->Stop();
+        USignPoseAnimInstance::StopSign(*SkeletalMeshBodyComponentInternalPtr.Get());
+    }
+    if (nullptr != ActionWorkerTaskPtr) {
+        ActionWorkerTaskPtr->TryAbandonTask();
+        ActionWorkerTaskPtr->WaitCompletionWithTimeout(SQSShutdownWaitTimeSeconds);
+        ActionWorkerPtr = nullptr;
+        ActionWorkerTaskPtr.Reset();
+    }
+    if (nullptr != BackgroundDownloader) {
+        BackgroundDownloader->CancelAll();
+        BackgroundDownloader.Reset();
+    }
+    if (nullptr != BackgroundCache) {
+        BackgroundCache->LogStats();
+        StagedBackgrounds.Empty();
+        BackgroundCache->Clear();
+    }
+}
+
+// HUD positions are configured for the whole viewport; sessions squeeze them horizontally into their own column
+//
+FVector2D ASLMetaHumanSession::ToRegion(const FVector2D & Position) const {
+    if (0.0 == ViewportSize.X) {
+        return Position + RegionOffset;
+    }
+    return FVector2D(RegionOffset.X + Position.X * (RegionSize.X / ViewportSize.X), RegionOffset.Y + Position.Y);
+}
+
+// Redirects Action requests (based on their type) from SQS to handling logic after unpacking details of those requests
+// Note: called via delegate in the action source worker (FAsynchronousActionWorker::ProcessMessage()) to process an action
+// Consider enhancing with a polymorphic implementation (v.s. switch/case) to cleanly scale to more request types
+//
+void ASLMetaHumanSession::ActionHandler(const ASLMetaHumanAction & Action) {
+    FString ActionData;
+    Action.GetActionData(ActionData);
+    switch (Action.GetActionType()) {
+        case EASLMetaHumanActionType::ANIMATE_SENTENCE: {
+            // Periodic optimization for stability in case of gradual memory leakage that's external to this project
+            //
+            UnrealAPI::ClearMemory();
+            FString ASLTense = "";
+            ASLMetaHumanAnimateSentenceAction::GetASLTense(Action, ASLTense);
+            FString ASLText;
+            ASLMetaHumanAnimateSentenceAction::GetASLText(Action, ASLText);
+            const auto & Sentiment = ASLMetaHumanAnimateSentenceAction::GetSentiment(Action);
+            // Assumes an 'inappropriate' sentence was constructed, ignores its tense, displays warning message instead.
+            //
+            if (EASLMetaHumanSentimentType::SHOCKED == Sentiment) {
+                ASLTense.Empty();
+                ASLText = ActionData;
+            }
+            AnimateSentence(ActionData, FString::Format(TEXT("{0} {1}"), TArray<FStringFormatArg>({ASLTense, ASLText})),
+                    Sentiment, true);
+            break;
+        }
+        case EASLMetaHumanActionType::CHANGE_AVATAR:
+            SwitchAvatar(ActionData, true);
+            break;
+        case EASLMetaHumanActionType::CHANGE_BACKGROUND:
+            AssignBackgroundTexture(ActionData, true);
+            break;
+        case EASLMetaHumanActionType::CHANGE_SETTINGS:
+            ChangeSettings(Action, true);
+            break;
+        case EASLMetaHumanActionType::CHANGE_SIGN_RATE:
+            ChangeSignRate(FCString::Atof(*ActionData), true);
+            break;
+        case EASLMetaHumanActionType::STOP_ALL_ANIMATIONS:
+            StopAllAnimations(true);
+            break;
+        default:
+            break;
+    }
+}
+
+// Adjusts UI and related state tracking to a default state (to accept new requests, clear UI elements)
+//
+// Note: the background is reset before the next sentence is accepted, so that the reset can't override the background
+// staged for that sentence
+//
+void ASLMetaHumanSession::ResetToBeginState() {
+    SetCancellingState(false);
+    ResetBackground();
+    SetReadyToAnimateNextToken(true);
+    SetReadyToAnimateNextSentence(true);
+    if (nullptr != ActionWorkerPtr) {
+        ActionWorkerPtr->SetReadyForNextTranslateMessage(true);
+    }
+    Hud->Hide(EHudSlot::Sentence);
+    Hud->Hide(EHudSlot::ASLText);
+    Hud->Hide(EHudSlot::Token);
+    Hud->Hide(EHudSlot::Letter);
+    Hud->Hide(EHudSlot::Sentiment);
+}
+
+// Resets the generated background to a default texture (only the session owning the background plane)
+//
+void ASLMetaHumanSession::ResetBackground() {
+    if ((nullptr == Shared.PlaneActorPtr) || (! Shared.PlaneActorPtr->IsValidLowLevelFast())) {
+        return;
+    }
+    auto BackgroundStaticMeshComponent = Shared.PlaneActorPtr->GetStaticMeshComponent();
+    if ((nullptr == BackgroundStaticMeshComponent) || (! BackgroundStaticMeshComponent->IsValidLowLevelFast())) {
+        return;
+    }
+
+    if ((nullptr == Shared.DefaultBackgroundMaterialInterfacePtr)
+            || (! Shared.DefaultBackgroundMaterialInterfacePtr->IsValidLowLevelFast())) {
+
+        const auto Task = FFunctionGraphTask::CreateAndDispatchWhenReady(
+                [&]() {
+                    if (! UnrealAPI::GetMaterial(
+                                DefaultBackgroundMaterialPath, Shared.DefaultBackgroundMaterialInterfacePtr)) {
+                        return;
+                    }
+                },
+                TStatId(), nullptr, ENamedThreads::GameThread);
+        Task->Wait();
+    }
+    if ((nullptr != Shared.DefaultBackgroundMaterialInterfacePtr)
+            && (Shared.DefaultBackgroundMaterialInterfacePtr->IsValidLowLevelFast())) {
+        const auto Task = FFunctionGraphTask::CreateAndDispatchWhenReady(
+                [&]() {
+                    BackgroundStaticMeshComponent->SetMaterial(
+                            0, Shared.DefaultBackgroundMaterialInterfacePtr->GetMaterial());
+                },
+                TStatId(), nullptr, ENamedThreads::GameThread);
+        Task->Wait();
+    }
+}
+
+// Stop any existing animation in progress to avoid conflicts with those animations. Prior active actor can be GC'd.
+//
+void ASLMetaHumanSession::StopAllAnimations(const bool Verbose) {
+    SetReadyToAnimateNextSentence(false);
+    // Backgrounds staged for the stopped sentences won't be shown (like the pending ones STOP preempts); their downloads
+    // are cancelled
+    //
+    if (nullptr != BackgroundDownloader) {
+        BackgroundDownloader->CancelAll();
+    }
+    AsyncTask(ENamedThreads::GameThread, [this]() {
+        DropStagedBackgrounds();
+    });
+    if (Verbose) {
+        DisplayStatus(StoppingAnimationMessage);
+    }
+    FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [&]() {
+                SetCancellingState(true);
+                FPlatformProcess::Sleep(1.0f);
+                ResetToBeginState();
+                FFunctionGraphTask::CreateAndDispatchWhenReady(
+                        [&]() {
+                            if ((nullptr != SkeletalMeshBodyComponentInternalPtr)
+                                    && SkeletalMeshBodyComponentInternalPtr->IsValidLowLevel()) { 
+                                FPlatformProcess::Sleep(FInternalSettings::GetAnimationSpinlockSeconds()
+                                        * FInternalSettings::GetHideMessageSynchronizationMultiplier());
+                                SkeletalMeshBodyComponentInternalPtr->Stop();
+                                USignPoseAnimInstance::StopSign(*SkeletalMeshBodyComponentInternalPtr.Get());
+                            }
+                        },
+                        TStatId(), nullptr, ENamedThreads::GameThread);
+            },
+            TStatId(), nullptr, ENamedThreads::AnyThread);
+}
+
+// Displays a HUD message containing a simplified English sentence and its ASL text approximation beneath.
+// Note: message will be cleared externally.
+//
+void ASLMetaHumanSession::DisplaySentencePairs(const FString & Sentence,
+        const FString & ASLText,
+        const FSentenceSettings & Settings) {
+    const FVector2D & MessagePosition = ToRegion(Settings.UI->SentencePosition);
+    const FVector2D & ASLTextPosition = ToRegion(Settings.UI->ASLTextPosition);
+    const FString & Message = FString::Format(SentenceOutputFormat, TArray<FStringFormatArg>({Sentence}));
+    const FString & ASLMessage = FString::Format(ASLOutputFormat, TArray<FStringFormatArg>({ASLText}));
+    Hud->Show(EHudSlot::Sentence, Message, MessagePosition, FColor::Green);
+    Hud->Show(EHudSlot::ASLText, ASLMessage, ASLTextPosition, FColor::Purple);
+}
+
+// Displays a HUD message containing an ASL Sign/Token. Note: message will be cleared externally.
+//
+void ASLMetaHumanSession::DisplayToken(const FString & Token, const FSentenceSettings & Settings) {
+    FString TokenOutput = FString::Format(TEXT("Token: {0}"), TArray<FStringFormatArg>({Token}));
+    TokenOutput = TokenOutput.Replace(*AnimationNameWordDelimiterStr, *AnimationNameWordSpaceStr);
+    Hud->Show(EHudSlot::Token, TokenOutput, ToRegion(Settings.UI->TokenPosition), FColor::Yellow);
+}
+
+// Displays a HUD message containing an ASL Sign/Token's component (a subset of the token that's possibly one or more words or one letter).
+// Note: message will be cleared after DurationSeconds (the animation duration of the token).
+//
+void ASLMetaHumanSession::DisplayTokenComponent(const FString & Token,
+        const float DurationSeconds,
+        const FSentenceSettings & Settings) {
+    Hud->Show(EHudSlot::Letter, Token, ToRegion(Settings.UI->LetterPosition), FColor::Red, DurationSeconds);
+}
+
+// Displays a HUD message containing a color-colored message with emoji (based on SentimentType)
+// Note: Message will be cleared externally. Consider externally configuring this message's placement.
+//
+void ASLMetaHumanSession::DisplaySentiment(const EASLMetaHumanSentimentType SentimentType) {
+    FString Message;
+    FColor Color;
+    switch (SentimentType) {
+        case EASLMetaHumanSentimentType::NEGATIVE:
+            Message = NegativeSentimentMessage;
+            Color = FColor::Red;
+            break;
+        case EASLMetaHumanSentimentType::POSITIVE:
+            Message = PositiveSentimentMessage;
+            Color = FColor::Green;
+            break;
+        case EASLMetaHumanSentimentType::MIXED:
+            Message = MixedSentimentMessage;
+            Color = FColor::Blue;
+            break;
+        case EASLMetaHumanSentimentType::NEUTRAL:
+            Message = NeutralSentimentMessage;
+            Color = FColor::Cyan;
+            break;
+        case EASLMetaHumanSentimentType::SHOCKED:
+            Message = ShockedSentimentMessage;
+            Color = FColor::Red;
+            break;
+        default:
+            return;
+    }
+    const auto & Position = ToRegion(FVector2D(SentimentHorizontalLocation, ViewportSize.Y / 2));
+    Hud->Show(EHudSlot::Sentiment, FString::Format(SentimentPromptMessageFormat, TArray<FStringFormatArg>({Message})),
+            Position, Color);
+}
+
+void ASLMetaHumanSession::SetGlyphAtlas(const TSharedRef<const FGlyphAtlas> & Atlas) {
+    if (nullptr != Hud) {
+        Hud->SetGlyphAtlas(EHudSlot::Letter, Atlas);
+    }
+}
+
+void ASLMetaHumanSession::DisplayStatus(const FString & Message) {
+    if (nullptr != Hud) {
+        Hud->Show(EHudSlot::Status, Message, StatusPosition, FColor::Red, UpdateMessageDurationSeconds);
+    }
+}
+
+// Applies the settings change carried by Action's keyword arguments (see FSettingsTuning). Settings are process-wide:
+// the change applies to every session from its next sentence on. The status shows the effective values, or why the
+// change was rejected
+//
+void ASLMetaHumanSession::ChangeSettings(const ASLMetaHumanAction & Action, const bool Verbose) {
+    TMap<FString, FString> Values;
+    Action.GetActionKeywordArgs(Values);
+    FString Acknowledgement;
+    const bool Applied = FSettingsTuning::Apply(Values, Acknowledgement);
+    if (Verbose) {
+        DisplayStatus(FString::Format(SettingsStatusFormat,
+                TArray<FStringFormatArg>({Applied ? ChangingSettingsMessage : RejectedSettingsMessage, Acknowledgement})));
+    }
+}
+
+// Adjusts the speed (by SignRate) by which this session's Skeleton animates. Applies from the next sentence on (a
+// sentence in progress keeps the rate its sign durations were computed with; each sign sets the rate it plays at).
+//
+void ASLMetaHumanSession::ChangeSignRate(const float SignRate, const bool Verbose) {
+    if (Verbose) {
+        Hud->Show(EHudSlot::Status, ChangingSignRateMessage, StatusPosition, FColor::Red, UpdateMessageDurationSeconds);
+    }
+    PlayRate.store(SignRate);
+}
+
+// Callback function that converts a downloaded Dynamic Texture to a Static Texture and stages it as background
+// Sequence (see OnBackgroundStaged()).
+// Note: only used without BackgroundWorkerDecodeEnabled (the conversion reads the texture back from the GPU).
+//
+void ASLMetaHumanSession::OnAssign2DTextureToBackground(const UTexture2DDynamic * DynamicTexture,
+        const uint64 Sequence,
+        const FString & UrlKey) {
+    // Must have a Static Texture-equivalent copy to apply to a Material
+    //
+    TWeakObjectPtr<UTexture2D> StaticTexture;
+    if (nullptr != DynamicTexture) {
+        UnrealAPI::ConvertTexture(DynamicTexture, StaticTexture);
+    }
+    const auto Task = FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [&]() {
+                OnBackgroundStaged(Sequence,
+                        StaticTexture.IsValid() ? BackgroundCache->Add(UrlKey, 0, StaticTexture.Get()) : nullptr);
+            },
+            TStatId(), nullptr, ENamedThreads::GameThread);
+    Task->Wait();
+}
+
+// Game thread: background Sequence finished loading (Texture is nullptr if it failed). It's applied right away if its
+// sentence already started (i.e. it's playing or over) or if it belongs to the next sentence and none is playing;
+// otherwise it stays staged (pinned in the cache) until its sentence starts
+//
+void ASLMetaHumanSession::OnBackgroundStaged(const uint64 Sequence, UTexture2D * Texture) {
+    const auto IsSequence = [Sequence](const FStagedBackground & Staged) {
+        return Staged.Sequence == Sequence;
+    };
+    const auto StagedPtr = StagedBackgrounds.FindByPredicate(IsSequence);
+    if (nullptr == StagedPtr) {
+        // Superseded by a newer background or dropped by STOP meanwhile
+        //
+        return;
+    }
+    if (nullptr == Texture) {
+        StagedBackgrounds.RemoveAll(IsSequence);
+        return;
+    }
+    StagedPtr->Texture = Texture;
+    BackgroundCache->Pin(Texture);
+    if (StagedPtr->SentenceIndex <= StartedSentenceCount) {
+        ApplyStagedBackground(StartedSentenceCount);
+    } else if ((StagedPtr->SentenceIndex == StartedSentenceCount + 1) && IsReadyToAnimateNextSentence()) {
+        ApplyStagedBackground(StagedPtr->SentenceIndex);
+    }
+}
+
+// Game thread: applies the newest loaded background staged for a sentence up to UpToSentenceIndex, then drops it and
+// the backgrounds it supersedes (older ones, even if they're still loading)
+//
+void ASLMetaHumanSession::ApplyStagedBackground(const uint64 UpToSentenceIndex) {
+    const FStagedBackground * NewestPtr = nullptr;
+    for (const auto & Staged: StagedBackgrounds) {
+        if ((Staged.SentenceIndex <= UpToSentenceIndex) && (nullptr != Staged.Texture)) {
+            NewestPtr = &Staged;
+        }
+    }
+    if (nullptr == NewestPtr) {
+        return;
+    }
+    const uint64 AppliedSequence = NewestPtr->Sequence;
+    ApplyBackgroundTexture(NewestPtr->Texture);
+    for (const auto & Staged: StagedBackgrounds) {
+        if ((Staged.Sequence <= AppliedSequence) && (nullptr != Staged.Texture)) {
+            BackgroundCache->Unpin(Staged.Texture);
+        }
+    }
+    StagedBackgrounds.RemoveAll([AppliedSequence](const FStagedBackground & Staged) {
+        return Staged.Sequence <= AppliedSequence;
+    });
+}
+
+// Game thread: forgets every staged background (loads still in flight are ignored when they finish)
+//
+void ASLMetaHumanSession::DropStagedBackgrounds() {
+    for (const auto & Staged: StagedBackgrounds) {
+        if (nullptr != Staged.Texture) {
+            BackgroundCache->Unpin(Staged.Texture);
+        }
+    }
+    StagedBackgrounds.Empty();
+}
+
+// Assigns a static texture to the material (dynamic material instance) that's assigned to the static mesh representing
+// the background image plane. Game thread only.
+//
+void ASLMetaHumanSession::ApplyBackgroundTexture(UTexture2D * StaticTexture) {
+    if (nullptr == StaticTexture) {
+        return;
+    }
+    if ((nullptr == Shared.PlaneActorPtr) || (! Shared.PlaneActorPtr->IsValidLowLevelFast())) {
+        return;
+    }
+    auto BackgroundStaticMeshComponent = Shared.PlaneActorPtr->GetStaticMeshComponent();
+    if ((nullptr == BackgroundStaticMeshComponent) || (! BackgroundStaticMeshComponent->IsValidLowLevelFast())) {
+        return;
+    }
+    if (nullptr == DynamicBackgroundMaterialInstancePtr) {
+        DynamicBackgroundMaterialInstancePtr = UMaterialInstanceDynamic::Create(
+                Shared.DynamicBackgroundMaterialInterfacePtr.Get(), BackgroundStaticMeshComponent);
+    }
+    if (nullptr != DynamicBackgroundMaterialInstancePtr) {
+        // Note: the texture parameter name (in the material) needs to be set to TextureImageParameterName.
+        // You can modify the material corresponding to BackgroundMaterialPath in the editor mode to capture
+        // this texture parameter name (must match!). Otherwise, there will be no effect in terms of texture
+        // changes.
+        //
+        DynamicBackgroundMaterialInstancePtr->SetTextureParameterValue(TextureImageParameterName, StaticTexture);
+        BackgroundStaticMeshComponent->SetMaterial(0, DynamicBackgroundMaterialInstancePtr.Get());
+        BackgroundCache->SetDisplayed(StaticTexture);
+    }
+}
+
+// High-level action that wraps the download process for the texture pointed at by SignedUrl (unless it's cached, see
+// FBackgroundTextureCache). With BackgroundWorkerDecodeEnabled the image is decoded, resized to the plane's on-screen
+// size and block-compressed on a worker thread (see FBackgroundImageLoader and FBackgroundImageIngest); otherwise the
+// OnAssign2DTextureToBackground() callback will be triggered, once downloading completes. The texture belongs to the
+// latest sentence requested before it: the translation trigger publishes a sentence first and its generated image
+// once it's ready, usually while the sentence plays. It's applied as soon as it's loaded if that sentence already
+// started; otherwise it's staged until the sentence starts.
+//
+void ASLMetaHumanSession::AssignBackgroundTexture(const FString & SignedUrl, const bool Verbose) {
+    if (nullptr == Shared.PlaneActorPtr) {
+        UE_LOG(LogTemp, Log, InfoBackgroundNotOwnedFormatted, SessionIndex);
+        return;
+    }
+    if (Verbose) {
+        DisplayStatus(ChangingBackgroundMessage);
+    }
+    const uint64 SentenceIndex = RequestedSentenceCount.GetValue();
+    AsyncTask(ENamedThreads::GameThread, [this, SignedUrl, SentenceIndex]() {
+        const uint64 Sequence = ++StagedBackgroundSequence;
+        StagedBackgrounds.Add({Sequence, SentenceIndex, nullptr});
+        if (FInternalSettings::GetBackgroundWorkerDecodeEnabled()) {
+            FBackgroundImageLoader::Load(SignedUrl, BackgroundCache.ToSharedRef(), BackgroundDownloader,
+                    FBackgroundImageIngest::GetOptions(Shared.PlaneActorPtr.Get()),
+                    [this, Sequence](UTexture2D * Texture) {
+                        OnBackgroundStaged(Sequence, Texture);
+                    });
+            return;
+        }
+        const FString UrlKey = FBackgroundTextureCache::ToUrlKey(SignedUrl);
+        if (UTexture2D * CachedTexture = BackgroundCache->FindByUrl(UrlKey)) {
+            OnBackgroundStaged(Sequence, CachedTexture);
+            return;
+        }
+        UnrealAPI::DownloadTexture(SignedUrl,
+                TDelegate<void(const UTexture2DDynamic *)>::CreateLambda(
+                        [this, Sequence, UrlKey](const UTexture2DDynamic * DynamicTexture) {
+                            OnAssign2DTextureToBackground(DynamicTexture, Sequence, UrlKey);
+                        }));
+    });
+}
+
+// Changes the Avatar that's currently active (internally) and visually applies that changes.
+// Initializes the configured Blueprint Actor (Avatar by name) and its Skeletal Mesh Component objects.
+// Both require persistence in order to produce animations at different time frames.
+// Returns true if the Avatar name was valid and could be initialized (and is possible the same avatar); false otherwise
+//
+bool ASLMetaHumanSession::SwitchAvatar(const FString & AvatarName, const bool Verbose) {
+    TWeakObjectPtr<UWorld> WorldPtr;
+    if (! UnrealAPI::GetWorld(WorldPtr)) {
+        return false;
+    }
+    // Changing to the existing active avatar (if any) is unnecessary
+    //
+    if ((nullptr != BPActorInternalPtr) && BPActorInternalPtr->IsValidLowLevel()) {
+        if (BPActorInternalPtr->GetName() == AvatarName) {
+            return true;
+        }
+    }
+    // Another session of this process may already be driving the requested avatar
+    //
+    {
+        FScopeLock ScopeLock(&MutexActiveAvatarNames);
+        if (ActiveAvatarNames.Contains(AvatarName)) {
+            UE_LOG(LogTemp, Warning, WarningAvatarInUseFormatted, *AvatarName, SessionIndex);
+            return false;
+        }
+        ActiveAvatarNames.Add(AvatarName);
+    }
+    // Get a reference to the latest user-specified avatar. Bail if it's an invalid avatar,
+    // and maintain the existing assigned actor.
+    //
+    TWeakObjectPtr<AActor> BPActorNewPtr;
+    const auto & BPActorObjectPath = FString::Format(BPActorObjectPathFormat, TArray<FStringFormatArg>({AvatarName}));
+    if (! UnrealAPI::GetActorByPath(BPActorObjectPath, WorldPtr.Get(), BPActorNewPtr)) {
+        FScopeLock ScopeLock(&MutexActiveAvatarNames);
+        ActiveAvatarNames.Remove(AvatarName);
+        return false;
+    }
+    {
+        FScopeLock ScopeLock(&MutexActiveAvatarNames);
+        ActiveAvatarNames.Remove(AvatarNameInUse);
+    }
+    AvatarNameInUse = AvatarName;
+    // Fully transition the Actor in the GUI thread to prevent crashes; it's also possible to stop the
+    // prior animation via StopAllAnimations() for stability needs.
+    //
+    const auto & TransitionActorTask = FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [&]() {
+                if (nullptr != BPActorInternalPtr) {
+                    BPActorInternalPtr->SetActorHiddenInGame(true);
+                }
+            },
+            TStatId(), nullptr, ENamedThreads::GameThread);
+    TransitionActorTask->Wait();
+    if (Verbose) {
+        DisplayStatus(ChangingAvatarMessage);
+    }
+    // Visually, only show the avatar of interest - where other BP-based avatars have been hidden.
+    //
+    SwapWithActiveAvatar(BPActorNewPtr);
+    SkeletalMeshBodyComponentInternalPtr = Cast<USkeletalMeshComponent>(
+            BPActorInternalPtr->GetComponentByClass(USkeletalMeshComponent::StaticClass()));
+    return SkeletalMeshBodyComponentInternalPtr->IsValidLowLevel();
+}
+
+// Updates the active avatar and adjusts its location and orientation to match corresponding preferences (and the
+// session's place in the row of avatars).
+//
+void ASLMetaHumanSession::SwapWithActiveAvatar(const TWeakObjectPtr<AActor> & BPActorNewPtr) {
+    BPActorInternalPtr = BPActorNewPtr;
+    const auto & ActorSetupTask = FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [&]() {
+                // Flip Actor
+                //
+                if (FUserSettings::GetFlipHands()) {
+                    BPActorInternalPtr->SetActorScale3D(FVector(-1, 1, 1));
+                }
+                // Place Actor in same location
+                //
+                FVector Location, Rotation;
+                FUserSettings::GetAvatarLocation(Location);
+                FUserSettings::GetAvatarRotation(Rotation);
+                // Sessions stand side by side
+                //
+                Location.Y += SessionIndex * FUserSettings::GetSessionAvatarSpacing();
+                BPActorInternalPtr->SetActorLocationAndRotation(Location, FQuat::MakeFromEuler(Rotation));
+                BPActorInternalPtr->SetActorHiddenInGame(false);
+            },
+            TStatId(), nullptr, ENamedThreads::GameThread);
+    ActorSetupTask->Wait();
+}
+
+// High-level routine for HUD to display a simplified English phrase (Sentence), its corresponding (approximated)
+// ASL text representation (ASLText), and inferred sentiment. ASLText will be broken into ASL tokens (signs), which will
+// be passed (one at a time) to a lower-level routine for visual rendition of individual ASL signs. Co-ordinates the
+// time between animating a sentence and receiving another sentence to animate (since UE returns asynchronously when it
+// is requested to play animations).
+//
+void ASLMetaHumanSession::AnimateSentence(const FString & Sentence,
+        const FString & ASLText,
+        const EASLMetaHumanSentimentType Sentiment,
+        const bool Verbose) {
+    const uint64 SentenceIndex = RequestedSentenceCount.Increment();
+    const auto & Task = FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [&, Sentence, ASLText, Sentiment, Verbose, SentenceIndex]() {
+                // Sentence in progress? Don't conflict with existing animation
+                //
+                while (! IsReadyToAnimateNextSentence()) {
+                    FPlatformProcess::Sleep(FInternalSettings::GetAnimationSpinlockSeconds());
+                }
+                // Sentence boundary: show the background staged for this sentence (if it's loaded already)
+                //
+                if (nullptr != Shared.PlaneActorPtr) {
+                    const auto BackgroundTask = FFunctionGraphTask::CreateAndDispatchWhenReady(
+                            [this, SentenceIndex]() {
+                                StartedSentenceCount = FMath::Max(StartedSentenceCount, SentenceIndex);
+                                ApplyStagedBackground(StartedSentenceCount);
+                            },
+                            TStatId(), nullptr, ENamedThreads::GameThread);
+                    BackgroundTask->Wait();
+                }
+                // The HUD work since the previous sentence started is that sentence's
+                //
+                if (1 < SentenceIndex) {
+                    Hud->LogStats(SessionIndex, SentenceIndex - 1);
+                }
+                if (Verbose) {
+                    DisplayStatus(AnimateSentenceMessage);
+                }
+                if (EASLMetaHumanSentimentType::NONE != Sentiment) {
+                    DisplaySentiment(Sentiment);
+                }
+                SetReadyToAnimateNextSentence(false);
+                // The whole sentence is played with the settings current now
+                //
+                const FSentenceSettings Settings = CaptureSentenceSettings();
+                DisplaySentencePairs(Sentence, ASLText, Settings);
+                // Determine the ASL Signs/tokens to animate, where they'll be animated in sequence. The whole sentence
+                // is planned and played from one vocabulary snapshot (a sign pack swapped in meanwhile applies from the
+                // next sentence on).
+                //
+                const auto Vocabulary = Dictionary.GetVocabulary();
+                TArray<FString> Tokens;
+                ASLAlgorithms::GetSignTokensFromSentence(
+                        &Vocabulary->GetTranslatableTokensByWordCount(), ASLText, Tokens);
+                // Stream in the whole sentence's signs while the first ones play
+                //
+                TArray<FString> UpperTokens;
+                for (const auto & Token: Tokens) {
+                    UpperTokens.Add(Token.ToUpper());
+                }
+                Vocabulary->Prefetch(UpperTokens);
+                unsigned int i = 0;
+                const int NumTokens = Tokens.Num();
+                for (const auto & Token: Tokens) {
+                    while (! IsReadyToAnimateNextToken()) {
+                        if (FGlobalState::IsAborting() || IsCancelling()) {
+                            Hud->Hide(EHudSlot::Sentence);
+                            Hud->Hide(EHudSlot::ASLText);
+                            return;
+                        }
+                        FPlatformProcess::Sleep(Settings.Internal->AnimationSpinlockSeconds);
+                    }
+                    // Note: overall animation completion time is only known when the last token is processed (in
+                    // AnimateToken()'s thread).
+                    //
+                    if (! AnimateToken(Token.ToUpper(), (NumTokens == i + 1), Vocabulary, Settings)) {
+                        return;
+                    }
+                    i++;
+                }
+            },
+            TStatId(), nullptr, ENamedThreads::AnyThread);
+}
+
+// Lower-level routine to take one ASL sign/token and request its animation (either by word(s) or letter-by-letter
+// - if lacking an ASL translation or known animation). Co-ordinates the time for being ready to animate another token.
+// Returns false if there was an animation sequence referencing issue or if the animation had to be aborted; true
+// otherwise.
+//
+bool ASLMetaHumanSession::AnimateToken(const FString & Token,
+        const bool FinalToken,
+        const TSharedRef<const FSignVocabulary> & Vocabulary,
+        const FSentenceSettings & Settings) {
+    // Note: this will indirectly affect AsynchronousSQSWorker - triggering it to pause!
+    //
+    SetReadyToAnimateNextToken(false);
+    DisplayToken(Token, Settings);
+    // The word transition delay runs on the timer wheel (nothing waits for it); the sign is then played and waited for
+    // on a worker thread
+    //
+    FTimerWheel::Schedule(Settings.User->WordTransitionDelaySeconds, [this, Token, FinalToken, Vocabulary, Settings]() {
+        FFunctionGraphTask::CreateAndDispatchWhenReady(
+                [this, Token, FinalToken, Vocabulary, Settings]() {
+                    if (FGlobalState::IsAborting() || IsCancelling()) {
+                        Hud->Hide(EHudSlot::Token);
+                        return;
+                    }
+                    // Determine whether one or more whole words or one word's individual letters (due to lack of an
+                    // ASL translation knowledge) are animated. Wait for each animation to complete.
+                    //
+                    if (Vocabulary->Contains(Token)) {
+                        const float DelaySeconds = AnimateSequence(Token, 0.0f, Vocabulary, Settings)
+                                ? GetAnimationDuration(Token, *Vocabulary, Settings)
+                                : 0.0f;
+                        const float SpinlockSeconds = Settings.Internal->AnimationSpinlockSeconds;
+                        for (float i = 0.0f; i < DelaySeconds; i += SpinlockSeconds) {
+                            if (FGlobalState::IsAborting() || IsCancelling()) {
+                                Hud->Hide(EHudSlot::Token);
+                                return;
+                            }
+                            FPlatformProcess::Sleep(SpinlockSeconds);
+                        }
+                    } else {
+                        // Whole word(s) translation was not found
+                        //
+                        if (! AnimateIndividualLettersForToken(Token, Vocabulary, Settings)) {
+                            Hud->Hide(EHudSlot::Token);
+                            return;
+                        }
+                    }
+                    Hud->Hide(EHudSlot::Token);
+                    if (FinalToken) {
+                        ResetToBeginState();
+                    }
+                    SetReadyToAnimateNextToken(true);
+                },
+                TStatId(), nullptr, ENamedThreads::AnyThread);
+    });
+    return true;
+}
+
+// Lower-level routine to animate individual ASL letter-by-letter signs/tokens derived from an input token (Token).
+// Each individual token is passed (one at a time) to a lower-level routine for animation playing.
+//
+bool ASLMetaHumanSession::AnimateIndividualLettersForToken(const FString & Token,
+        const TSharedRef<const FSignVocabulary> & Vocabulary,
+        const FSentenceSettings & Settings) {
+    const unsigned int TokenLength = Token.Len();
+    for (unsigned int i = 0; i < TokenLength; i++) {
+        if (FGlobalState::IsAborting() || IsCancelling()) {
+            return false;
+        }
+        // Note: corner case representation for letter 'I'... 'I' => Noun-based, '_I' => Alphabet-based.
+        // Consider having a cleaner representation mechanism for signs such as context indicators versus an underscore.
+        //
+        FString Letter = FString(1, &Token[i]);
+        if (Letter == LetterIAsSubject) {
+            // Reference again as an alphabetical letter
+            //
+            Letter = FString(LetterIAsAlphabetSymbol);
+        }
+        if (Vocabulary->Contains(Letter)) {
+            const float StartPosition = i == 0 ? 0.0f : Settings.User->PlayStartOffset;
+            const float DelaySeconds = AnimateSequence(Letter, StartPosition, Vocabulary, Settings)
+                    ? GetAnimationDuration(Letter, *Vocabulary, Settings)
+                    : 0.0f;
+            for (float j = 0.0f; j < DelaySeconds; j += Settings.Internal->AnimationSpinlockSeconds) {
+                if (FGlobalState::IsAborting() || IsCancelling()) {
+                    return false;
+                }
+                FPlatformProcess::Sleep(Settings.Internal->AnimationSpinlockSeconds);
+            }
+            Hud->Hide(EHudSlot::Letter);
+        }
+    }
+    Hud->Hide(EHudSlot::Token);
+    return true;
+}
+
+// Lowest-level animation processing routine - cross-references the animation sequence (or the sign pack tracks) for a
+// given ASL sign/token (Token) and requests that UE plays that animation. Applies that animation to the internal
+// SkeletalMeshComponent at the sentence's play speed (Settings) and a specified start position (StartPosition). Note:
+// the UE API for playing animations will return asynchronously. Returns false if the requested animation couldn't be
+// found or streamed in (in time); true otherwise.
+//
+bool ASLMetaHumanSession::AnimateSequence(const FString & Token,
+        const float StartPosition,
+        const TSharedRef<const FSignVocabulary> & Vocabulary,
+        const FSentenceSettings & Settings) {
+    // Signs of the sign pack are decoded from its tracks; others need their animation sequence
+    //
+    const auto PackClip = Vocabulary->FindPackClip(Token);
+    TWeakObjectPtr<UAnimSequence> AnimSequencePtr;
+    TSharedPtr<const FSignPoseTracks> PoseTracks;
+    if (! PackClip.IsValid()) {
+        AnimSequencePtr = Vocabulary->AcquireSequence(Token);
+        if (! AnimSequencePtr.IsValid()) {
+            return false;
+        }
+        PoseTracks = Vocabulary->FindPoseTracks(Token, AnimSequencePtr);
+    }
+    const float DurationSeconds = GetAnimationDuration(Token, *Vocabulary, Settings);
+    const bool HasSignPack = Vocabulary->HasSignPack();
+    const auto & Task = FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [&, AnimSequencePtr, PoseTracks, PackClip, StartPosition, Token, DurationSeconds, HasSignPack, Settings]() {
+                const float Rate = Settings.PlayRate;
+                if (FGlobalState::IsAborting() || IsCancelling()) {
+                    return;
+                }
+                // Note: the residency manager may have released the sequence since (it's then only kept until GC)
+                //
+                if ((! PackClip.IsValid()) && (! AnimSequencePtr.IsValid())) {
+                    return;
+                }
+                // Consider having a cleaner representation for signs such as context indicators versus an underscore.
+                //
+                FString TokenCopy(Token);
+                if (LetterIAsAlphabetSymbol == TokenCopy) {
+                    TokenCopy = LetterIAsSubject;
+                }
+                TokenCopy = TokenCopy.Replace(*AnimationNameWordDelimiterStr, *AnimationNameWordSpaceStr);
+                DisplayTokenComponent(TokenCopy, DurationSeconds, Settings);
+                if (FGlobalState::IsAborting() || IsCancelling()) {
+                    return;
+                }
+                // Note: with a sign pack, sequences also play through USignPoseAnimInstance (avoids switching the
+                // animation mode between signs)
+                //
+                if (PackClip.IsValid()) {
+                    USignPoseAnimInstance::PlayClip(
+                            *SkeletalMeshBodyComponentInternalPtr.Get(), PackClip, Rate, StartPosition);
+                } else if (Settings.Internal->PoseCacheEnabled || HasSignPack) {
+                    USignPoseAnimInstance::PlaySign(*SkeletalMeshBodyComponentInternalPtr.Get(), *AnimSequencePtr.Get(),
+                            PoseTracks, Rate, StartPosition);
+                } else {
+                    UnrealAPI::PlayAnimation(
+                            *SkeletalMeshBodyComponentInternalPtr.Get(), *AnimSequencePtr.Get(), Rate, StartPosition);
+                }
+            },
+            TStatId(), nullptr, ENamedThreads::GameThread);
+    return true;
+}
+
+// Returns one snapshot of each settings class from the same publication (see FSettingsPublication), and the sign rate
+//
+ASLMetaHumanSession::FSentenceSettings ASLMetaHumanSession::CaptureSentenceSettings() const {
+    return FSettingsPublication::Read([this]() -> FSentenceSettings {
+        return {FInternalSettings::GetShared(), FUISettings::GetShared(), FUserSettings::GetShared(), PlayRate.load()};
+    });
+}
+
+// Returns the animation duration corresponding to the specific ASL sign/token provided. A value of 0.0f is returned
+// if the animation duration wasn't found.
+//
+float ASLMetaHumanSession::GetAnimationDuration(const FString & Token,
+        const FSignVocabulary & Vocabulary,
+        const FSentenceSettings & Settings) const {
+    const float PlayLength = Vocabulary.GetPlayLength(Token);
+    if (0.0f == PlayLength) {
+        return 0.0f;
+    }
+    return (PlayLength - Settings.User->PlayStartOffset - Settings.User->PlayEndOffset) / Settings.PlayRate;
+}
+
+// A QA/testbed-related method to perform actions in a controlled manner given a JSON payload
+//
+void ASLMetaHumanSession::RunInternalTestAction(const FString & JsonPayload) {
+    if (FGlobalState::IsAborting()) {
+        return;
+    }
+    // Include a sufficient delay to prevent issues with screen text clearing/overlapping.
+    //
+    FPlatformProcess::Sleep(RunTestActionDelaySeconds);
+    if (FGlobalState::IsAborting()) {
+        return;
+    }
+    const auto Action = new ASLMetaHumanAction(JsonPayload);
+    ActionHandler(*Action);
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// One render session of the demo: an avatar, its HUD region and its own action source worker. A process hosts
+// RenderSessionCount sessions side by side (see ASLMetaHumanDemo), each signing for a different session id.
+//
+
+#include <Animation/AnimSequence.h>
+#include <Engine.h>
+
+#include <atomic>
+
+#include "ASLMetaHumanAction.h"
+#include "ASLMetaHumanSignDictionary.h"
+#include "AsynchronousActionWorker.h"
+#include "BackgroundTextureCache.h"
+#include "Config/InternalSettings.h"
+#include "Config/UISettings.h"
+#include "Config/UserSettings.h"
+#include "CrtS3Downloader.h"
+#include "HudOverlay.h"
+
+namespace ASLMetaHuman::Core {
+
+// Engine objects that the demo resolves once and lends to its sessions
+//
+struct FASLMetaHumanSharedObjects {
+    TWeakObjectPtr<UFont> FontPtr;
+    TWeakObjectPtr<AStaticMeshActor> PlaneActorPtr;
+    TWeakObjectPtr<UMaterialInterface> DynamicBackgroundMaterialInterfacePtr;
+    TWeakObjectPtr<UMaterialInterface> DefaultBackgroundMaterialInterfacePtr;
+};
+
+class ASLMetaHumanSession {
+public:
+    ASLMetaHumanSession(const int32 InSessionIndex, const ASLMetaHumanSignDictionary & InDictionary);
+    ~ASLMetaHumanSession();
+    ASLMetaHumanSession & operator=(const ASLMetaHumanSession &) = delete;
+    ASLMetaHumanSession(ASLMetaHumanSession const &) = delete;
+
+    // Takes the session's avatar and HUD region (a column of the viewport). Only the session that is given the
+    // background plane (in SharedObjects) handles background changes. Returns false if the avatar is unavailable
+    //
+    bool Init(const FString & AvatarName,
+            const FASLMetaHumanSharedObjects & SharedObjects,
+            const FVector2D & InRegionOffset,
+            const FVector2D & InRegionSize);
+    void InitActionSourceWorker(const TArray<FString> & SessionCandidates);
+
+    // Lets the action source worker dispatch actions (it only opens its source until then). Ignored if the session
+    // has no avatar
+    //
+    void OpenActionSource();
+    void Shutdown();
+
+    bool HasAvatar() const {
+        return AvatarReady;
+    }
+
+    void AnimateSentence(const FString & Sentence,
+            const FString & ASLText,
+            const EASLMetaHumanSentimentType Sentiment = EASLMetaHumanSentimentType::NONE,
+            const bool Verbose = false);
+
+    // Game thread: draws the fingerspelling letters from Atlas
+    //
+    void SetGlyphAtlas(const TSharedRef<const FGlyphAtlas> & Atlas);
+
+    // Any thread: shows Message in the status slot of this session's HUD for a moment
+    //
+    void DisplayStatus(const FString & Message);
+
+private:
+    // Settings a sentence is played with: captured once when it starts (one snapshot of each settings class, see
+    // TSnapshotPublisher), so that a configuration reload or a sign rate change meanwhile applies from the next
+    // sentence on
+    //
+    struct FSentenceSettings {
+        TSharedRef<const Config::FInternalSettings::FSnapshot> Internal;
+        TSharedRef<const Config::FUISettings::FSnapshot> UI;
+        TSharedRef<const Config::FUserSettings::FSnapshot> User;
+        float PlayRate;
+    };
+
+    // Returns whether animation pipeline cancellation was initiated
+    //
+    bool IsCancelling() const {
+        FScopeLock ScopeLock(&MutexCancellationActive);
+        return CancellationActive;
+    }
+
+    // Returns false if there's an animation in progress; true otherwise
+    //
+    bool IsReadyToAnimateNextSentence() const {
+        FScopeLock ScopeLock(&MutexReadyToAnimateNextSentence);
+        return ReadyToAnimateNextSentence;
+    }
+
+    // Returns false if there is an animation in progress; true otherwise
+    //
+    bool IsReadyToAnimateNextToken() const {
+        FScopeLock ScopeLock(&MutexReadyToAnimateNextToken);
+        return ReadyToAnimateNextToken;
+    }
+
+    // Updates the cancellation state of the animation pipeline
+    //
+    void SetCancellingState(const bool State) {
+        FScopeLock ScopeLock(&MutexCancellationActive);
+        CancellationActive = State;
+    }
+
+    // Allows another sentence to be processed if State==true; else current animation is not interrupted
+    //
+    void SetReadyToAnimateNextSentence(const bool State) {
+        FScopeLock ScopeLock(&MutexReadyToAnimateNextSentence);
+        ReadyToAnimateNextSentence = State;
+    }
+
+    // Allows another animation to be processed if State==true; else current animation is not interrupted
+    //
+    void SetReadyToAnimateNextToken(const bool State) {
+        FScopeLock ScopeLock(&MutexReadyToAnimateNextToken);
+        ReadyToAnimateNextToken = State;
+    }
+
+    // Maps a full-viewport HUD position into this session's region
+    //
+    FVector2D ToRegion(const FVector2D & Position) const;
+
+    void ActionHandler(const ASLMetaHumanAction & Action);
+    bool AnimateIndividualLettersForToken(const FString & Token,
+            const TSharedRef<const FSignVocabulary> & Vocabulary,
+            const FSentenceSettings & Settings);
+    bool AnimateSequence(const FString & Token,
+            const float StartPosition,
+            const TSharedRef<const FSignVocabulary> & Vocabulary,
+            const FSentenceSettings & Settings);
+    bool AnimateToken(const FString & Token,
+            const bool FinalToken,
+            const TSharedRef<const FSignVocabulary> & Vocabulary,
+            const FSentenceSettings & Settings);
+    void ApplyBackgroundTexture(UTexture2D * StaticTexture);
+    void ApplyStagedBackground(const uint64 UpToSentenceIndex);
+    FSentenceSettings CaptureSentenceSettings() const;
+    void AssignBackgroundTexture(const FString & SignedUrl, const bool Verbose = false);
+    void ChangeSettings(const ASLMetaHumanAction & Action, const bool Verbose = false);
+    void ChangeSignRate(const float SignRate, const bool Verbose = false);
+    void DisplaySentencePairs(const FString & Sentence, const FString & ASLText, const FSentenceSettings & Settings);
+    void DisplaySentiment(const EASLMetaHumanSentimentType SentimentType);
+    void DisplayToken(const FString & Token, const FSentenceSettings & Settings);
+    void DisplayTokenComponent(const FString & Token, const float DurationSeconds, const FSentenceSettings & Settings);
+    void DropStagedBackgrounds();
+    float GetAnimationDuration(const FString & Token,
+            const FSignVocabulary & Vocabulary,
+            const FSentenceSettings & Settings) const;
+    void OnAssign2DTextureToBackground(const UTexture2DDynamic * DynamicTexture,
+            const uint64 Sequence,
+            const FString & UrlKey);
+    void OnBackgroundStaged(const uint64 Sequence, UTexture2D * Texture);
+    void RunInternalTestAction(const FString & JsonPayload);
+    void ResetBackground();
+    void ResetToBeginState();
+    void StopAllAnimations(const bool Verbose = false);
+    void SwapWithActiveAvatar(const TWeakObjectPtr<AActor> & BPActorNewPtr);
+    bool SwitchAvatar(const FString & AvatarName, const bool Verbose = false);
+
+    const int32 SessionIndex;
+    const ASLMetaHumanSignDictionary & Dictionary;
+
+    // Tracks state: readiness to process next word token and sentence - with related protection
+    //
+    bool ReadyToAnimateNextToken = true;
+    mutable FCriticalSection MutexReadyToAnimateNextToken;
+    bool ReadyToAnimateNextSentence = true;
+    mutable FCriticalSection MutexReadyToAnimateNextSentence;
+
+    // Tracks state of animation pipeline cancellation requests
+    //
+    bool CancellationActive = false;
+    mutable FCriticalSection MutexCancellationActive;
+
+    // Avatars taken by the sessions of this process (a Blueprint actor can only be driven by one session)
+    //
+    static inline TSet<FString> ActiveAvatarNames;
+    static inline FCriticalSection MutexActiveAvatarNames;
+
+    // For external classes (action source handler) to invoke actions
+    //
+    TDelegate<void(const ASLMetaHumanAction &)> ActionHandlerDelegate;
+
+    // Blueprint-based Actor object access - MetaHuman actor
+    //
+    TWeakObjectPtr<AActor> BPActorInternalPtr;
+    FString AvatarNameInUse;
+    bool AvatarReady = false;
+
+    // Access to skeleton of animating character or blueprint.
+    // Note: "Body" is referring to hand/fingers component in the MetaHumans rig.
+    //
+    TWeakObjectPtr<USkeletalMeshComponent> SkeletalMeshBodyComponentInternalPtr;
+
+    // Sign rate of this session's avatar (starts at the configured PlayRate; changed by actions, read by each sentence
+    // as it starts)
+    //
+    std::atomic<float> PlayRate;
+
+    // Engine objects lent by the demo; PlaneActorPtr is only set for the session that owns the background
+    //
+    FASLMetaHumanSharedObjects Shared;
+
+    // Holds background static mesh component material instance (for changing backgrounds)
+    //
+    TWeakObjectPtr<UMaterialInstanceDynamic> DynamicBackgroundMaterialInstancePtr;
+
+    // Decoded backgrounds kept for reuse, and their downloader (only for the session that owns the background; no
+    // downloader: backgrounds are downloaded over HTTP)
+    //
+    TSharedPtr<FBackgroundTextureCache> BackgroundCache;
+    TSharedPtr<FCrtS3Downloader> BackgroundDownloader;
+
+    // Backgrounds waiting for their sentence, in arrival order (game thread only): a background belongs to the latest
+    // sentence requested before its message and is applied once it's loaded and that sentence started. Texture is
+    // nullptr while loading. RequestedSentenceCount counts the sentences requested so far, StartedSentenceCount the
+    // started ones
+    //
+    struct FStagedBackground {
+        uint64 Sequence {0};
+        uint64 SentenceIndex {0};
+        UTexture2D * Texture {nullptr};
+    };
+    TArray<FStagedBackground> StagedBackgrounds;
+    uint64 StagedBackgroundSequence {0};
+    FThreadSafeCounter64 RequestedSentenceCount;
+    uint64 StartedSentenceCount {0};
+
+    // Background worker that receives this session's ASL requests (from the configured action source).
+    // ActionWorkerPtr is owned by the task and only used to reopen translation intake
+    //
+    TUniquePtr<FAsyncTask<FAsynchronousActionWorkerTask>> ActionWorkerTaskPtr;
+    FAsynchronousActionWorker * ActionWorkerPtr {nullptr};
+
+    FVector2D ViewportSize;
+    FVector2D RegionOffset;
+    FVector2D RegionSize;
+
+    // X,Y position for status update text
+    //
+    FVector2D StatusPosition;
+
+    // This session's HUD slots (created by Init()). Messages without a known duration are hidden explicitly, so
+    // animation durations don't need to be pre-computed
+    //
+    TUniquePtr<FHudOverlay> Hud;
+};
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Builds the ASL sign vocabulary from the asset registry (animations are streamed in later, on demand)
+//
+
+#include "ASLMetaHumanSignDictionary.h"
+#include "Config/InternalSettings.h"
+#include "SignManifest.h"
+#include "Utilities/UnrealAPI.h"
+
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::ASLMetaHumanSignDictionary;
+using ASLMetaHuman::Core::FAnimationResidency;
+using ASLMetaHuman::Core::FSignManifest;
+using ASLMetaHuman::Core::FSignPack;
+using ASLMetaHuman::Core::FSignPackClip;
+using ASLMetaHuman::Core::FSignPoseCache;
+using ASLMetaHuman::Core::FSignPoseTracks;
+using ASLMetaHuman::Core::FSignVocabulary;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+// Filename convention for animation sequences, where the ASL Sign word(s) follow an underscore and are separated by
+// underscores
+//
+const auto AnimationNamePrefix {TEXT("Anim_")};
+constexpr auto AnimationNameWordDelimiter {'_'};
+const FString & AnimationNameWordDelimiterStr {"_"};
+// Asset registry tag holding an animation sequence's length (seconds), readable without loading the sequence
+//
+const FName SequenceLengthTagName {"SequenceLength"};
+constexpr int64 BytesPerMB {1024 * 1024};
+constexpr auto & InfoDictionaryReadyFormatted = TEXT("Sign dictionary ready: %d signs from %s in %.1f ms");
+constexpr auto & InfoManifestSource = TEXT("the sign manifest");
+constexpr auto & InfoAssetRegistrySource = TEXT("the asset registry");
+constexpr auto & InfoSignPackFormatted = TEXT("Sign pack installed: %d signs (%d not in the animation sequences)");
+}
+
+ASLMetaHumanSignDictionary::ASLMetaHumanSignDictionary() {
+    Vocabulary.Publish(MakeShared<FSignVocabulary>());
+}
+
+// Initializes the vocabulary:
+// - Residency: ASL sign labels -> Animation sequence asset (and length), streamed in on demand
+// - TranslatableTokensByWordCount: number of words -> array[ASL sign labels that have that amount of words]
+// Alphabet letters (fingerspelling, including _I) and PinnedSignTokens are pinned and start loading right away.
+//
+void ASLMetaHumanSignDictionary::Init(const FString & AnimationPath) {
+    const double StartSeconds = FPlatformTime::Seconds();
+    Residency = MakeShared<FAnimationResidency>(
+            static_cast<int64>(FMath::Max(0, FInternalSettings::GetAnimationResidencyBudgetMB())) * BytesPerMB);
+    TArray<FString> PinnedTokens;
+    FInternalSettings::GetPinnedSignTokens().ToUpper().ParseIntoArray(PinnedTokens, TEXT(","));
+    for (auto & PinnedToken: PinnedTokens) {
+        PinnedToken.TrimStartAndEndInline();
+    }
+    const FString & ManifestPath = FInternalSettings::GetSignManifestPath();
+    const bool FromManifest = (! ManifestPath.IsEmpty()) && InitFromManifest(ManifestPath, PinnedTokens);
+    if (! FromManifest) {
+        InitFromAssetRegistry(AnimationPath, PinnedTokens);
+    }
+    if (FInternalSettings::GetPoseCacheEnabled()) {
+        PoseCache = MakeShared<FSignPoseCache>(
+                FInternalSettings::GetPoseCacheHotSigns(), FInternalSettings::GetPoseCacheHotPlays());
+    }
+    int32 NewSigns = 0;
+    Vocabulary.Publish(MakeVocabulary(nullptr, NewSigns));
+    const FString & PackPath = FInternalSettings::GetSignPackPath();
+    if (! PackPath.IsEmpty()) {
+        InitSignPack(PackPath);
+    }
+    Residency->LoadPinned();
+    const int32 SignCount = GetVocabulary()->Signs.Num();
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+    UE_LOG(LogTemp, Log, InfoDictionaryReadyFormatted, SignCount,
+            FromManifest ? InfoManifestSource : InfoAssetRegistrySource, ElapsedMs);
+}
+
+// Indexes the signs of the prebuilt manifest - no asset registry queries or name parsing. Returns false if there's no
+// valid manifest at ManifestPath (relative to the project directory)
+//
+bool ASLMetaHumanSignDictionary::InitFromManifest(const FString & ManifestPath, const TArray<FString> & PinnedTokens) {
+    const FString & FullPath =
+            FPaths::IsRelative(ManifestPath) ? FPaths::Combine(FPaths::ProjectDir(), ManifestPath) : ManifestPath;
+    FSignManifest Manifest;
+    if (! Manifest.Open(FullPath)) {
+        return false;
+    }
+    const int32 NumSigns = Manifest.Num();
+    for (int32 i = 0; i < NumSigns; i++) {
+        const FString & SignName = Manifest.GetSignName(i);
+        RegisterSign(SignName, FSoftObjectPath(Manifest.GetObjectPath(i)), Manifest.GetPlayLength(i),
+                Manifest.GetWordCount(i), IsLetter(SignName) || PinnedTokens.Contains(SignName));
+    }
+    return true;
+}
+
+// Indexes the animation sequences found in AnimationPath (asset registry metadata only; nothing is loaded).
+//
+// Warning: ensure that your animation sequences are cooked and that nothing is preventing them from being
+// cooked (including DefaultGame.ini files)!
+// Consider memory and compute efficiency - an on-demand MoCap/Live Link data streaming could be used instead
+// to produce similar animation data, which would need to be re-targeted to a skeleton (see SignPackPath for signs
+// shipped as compressed tracks).
+//
+void ASLMetaHumanSignDictionary::InitFromAssetRegistry(const FString & AnimationPath,
+        const TArray<FString> & PinnedTokens) {
+    TArray<FAssetData> AssetDataList;
+    if (! UnrealAPI::GetAssetData<UAnimSequence>(AnimationPath, AssetDataList)) {
+        return;
+    }
+    for (const auto & AssetData: AssetDataList) {
+        const FString & SignName = ToSignName(AssetData.AssetName.ToString());
+        float PlayLength = 0.0f;
+        AssetData.GetTagValue(SequenceLengthTagName, PlayLength);
+        RegisterSign(SignName, AssetData.GetSoftObjectPath(), PlayLength, CountWords(SignName),
+                IsLetter(SignName) || PinnedTokens.Contains(SignName));
+    }
+}
+
+void ASLMetaHumanSignDictionary::RegisterSign(const FString & SignName,
+        const FSoftObjectPath & Path,
+        const float PlayLength,
+        const unsigned int WordCount,
+        const bool Pinned) {
+    Residency->Register(SignName, Path, PlayLength, Pinned);
+    BaseSigns.Add(SignName, {INDEX_NONE, Pinned});
+    AddTranslatableToken(BaseTokensByWordCount, SignName, WordCount);
+}
+
+// Maps the sign pack at PackPath (relative to the project directory). Only the index is read; tracks are paged in
+// when a sign is first played
+//
+void ASLMetaHumanSignDictionary::InitSignPack(const FString & PackPath) {
+    const FString & FullPath =
+            FPaths::IsRelative(PackPath) ? FPaths::Combine(FPaths::ProjectDir(), PackPath) : PackPath;
+    const auto SignPack = MakeShared<FSignPack>();
+    if (SignPack->Open(FullPath)) {
+        InstallSignPack(SignPack);
+    }
+}
+
+// Publishes a vocabulary with the signs of the pack; the pack's clips replace the animation sequences of the signs that
+// both provide
+//
+void ASLMetaHumanSignDictionary::InstallSignPack(const TSharedRef<const FSignPack> & NewPack) {
+    int32 NewSigns = 0;
+    Vocabulary.Publish(MakeVocabulary(NewPack, NewSigns));
+    UE_LOG(LogTemp, Log, InfoSignPackFormatted, NewPack->Num(), NewSigns);
+}
+
+// Vocabulary of the animation sequences' signs plus those of SignPack (if any). Word counts are sorted descending
+// (ASL signs/tokens are substituted from the largest to the smallest word count)
+//
+TSharedRef<FSignVocabulary> ASLMetaHumanSignDictionary::MakeVocabulary(const TSharedPtr<const FSignPack> & SignPack,
+        int32 & NewSigns) const {
+    const auto NewVocabulary = MakeShared<FSignVocabulary>();
+    NewVocabulary->Signs = BaseSigns;
+    NewVocabulary->TranslatableTokensByWordCount = BaseTokensByWordCount;
+    NewVocabulary->Pack = SignPack;
+    NewVocabulary->Residency = Residency;
+    NewVocabulary->PoseCache = PoseCache;
+    NewSigns = 0;
+    const int32 NumSigns = SignPack.IsValid() ? SignPack->Num() : 0;
+    for (int32 i = 0; i < NumSigns; i++) {
+        const FString & SignName = SignPack->GetSignName(i);
+        auto & Sign = NewVocabulary->Signs.FindOrAdd(SignName);
+        if (! BaseSigns.Contains(SignName)) {
+            AddTranslatableToken(NewVocabulary->TranslatableTokensByWordCount, SignName, SignPack->GetWordCount(i));
+            NewSigns++;
+        }
+        Sign.PackSign = i;
+    }
+    NewVocabulary->TranslatableTokensByWordCount.KeySort([](const unsigned int A, const unsigned int B) {
+        return A > B;
+    });
+    return NewVocabulary;
+}
+
+void ASLMetaHumanSignDictionary::AddTranslatableToken(FTokensByWordCount & Tokens,
+        const FString & SignName,
+        const unsigned int WordCount) {
+    const auto TokensArrayPtr = Tokens.Find(WordCount);
+    if (! TokensArrayPtr) {
+        Tokens.Add(WordCount, TArray {SignName});
+    } else {
+        TokensArrayPtr->Add(SignName);
+    }
+}
+
+FString ASLMetaHumanSignDictionary::ToSignName(const FString & AssetName) {
+    return AssetName.Replace(AnimationNamePrefix, TEXT("")).ToUpper();
+}
+
+// Treat a whole word as 'more substitutable' in preference (higher score) than a single letter (fingerspelling)
+// Ignore _I (special case). Consider having a cleaner representation mechanism for signs such as context indicators
+// (i.e. I (noun), I (letter)) versus an underscore.
+//
+unsigned int ASLMetaHumanSignDictionary::CountWords(const FString & SignName) {
+    auto OccurrenceCount = UnrealAPI::CountCharOccurrences(SignName, AnimationNameWordDelimiter);
+    if ((! SignName.StartsWith(AnimationNameWordDelimiterStr)) && (SignName.Len() > 1)) {
+        OccurrenceCount++;
+    }
+    return OccurrenceCount;
+}
+
+// Alphabet: single letters and the _I letter symbol
+//
+bool ASLMetaHumanSignDictionary::IsLetter(const FString & SignName) {
+    return (1 == SignName.Len()) || ((2 == SignName.Len()) && SignName.StartsWith(AnimationNameWordDelimiterStr));
+}
+
+bool ASLMetaHumanSignDictionary::WaitForPinned(const float TimeoutSeconds) const {
+    return (nullptr != Residency) && Residency->WaitForPinned(TimeoutSeconds);
+}
+
+void ASLMetaHumanSignDictionary::WarmPoseCache() const {
+    if ((nullptr == PoseCache) || (nullptr == Residency)) {
+        return;
+    }
+    for (const auto & Token: Residency->GetPinnedTokens()) {
+        const auto Sequence = Residency->FindResident(Token);
+        if (Sequence.IsValid()) {
+            PoseCache->Find(Token, Sequence, true);
+        }
+    }
+}
+
+void ASLMetaHumanSignDictionary::LogStats() const {
+    if (nullptr != Residency) {
+        Residency->LogStats();
+    }
+    if (nullptr != PoseCache) {
+        PoseCache->LogStats();
+    }
+}
+
+float FSignVocabulary::GetPlayLength(const FString & Token) const {
+    const auto SignPtr = Signs.Find(Token);
+    if (nullptr == SignPtr) {
+        return 0.0f;
+    }
+    if (INDEX_NONE != SignPtr->PackSign) {
+        return Pack->GetPlayLength(SignPtr->PackSign);
+    }
+    // The sequence's own length once it's loaded (the asset metadata until then)
+    //
+    return Residency->GetPlayLength(Token);
+}
+
+TSharedPtr<const FSignPackClip> FSignVocabulary::FindPackClip(const FString & Token) const {
+    const auto SignPtr = Signs.Find(Token);
+    if ((nullptr == SignPtr) || (INDEX_NONE == SignPtr->PackSign)) {
+        return nullptr;
+    }
+    return FSignPackClip::Create(Pack.ToSharedRef(), SignPtr->PackSign);
+}
+
+TWeakObjectPtr<UAnimSequence> FSignVocabulary::AcquireSequence(const FString & Token) const {
+    if (nullptr == Residency) {
+        return nullptr;
+    }
+    return Residency->Acquire(Token, FInternalSettings::GetAnimationLoadTimeoutSeconds());
+}
+
+// Note: signs of the sign pack are played from the pack, so their sequences (if any) aren't streamed in
+//
+void FSignVocabulary::Prefetch(const TArray<FString> & Tokens) const {
+    if (nullptr == Residency) {
+        return;
+    }
+    Residency->Prefetch(Tokens.FilterByPredicate([this](const FString & Token) {
+        const auto SignPtr = Signs.Find(Token);
+        return (nullptr != SignPtr) && (INDEX_NONE == SignPtr->PackSign);
+    }));
+}
+
+TSharedPtr<const FSignPoseTracks> FSignVocabulary::FindPoseTracks(const FString & Token,
+        const TWeakObjectPtr<UAnimSequence> & Sequence) const {
+    if (nullptr == PoseCache) {
+        return nullptr;
+    }
+    const auto SignPtr = Signs.Find(Token);
+    return PoseCache->Find(Token, Sequence, (nullptr != SignPtr) && SignPtr->Pinned);
+}
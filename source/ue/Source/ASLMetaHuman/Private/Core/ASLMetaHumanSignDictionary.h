@@ -0,0 +1,173 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Holds the ASL sign vocabulary: the known signs/tokens, their animations (kept resident on demand, see
+// FAnimationResidency, or played from the sign pack, see FSignPack) and the tokens grouped by the number of words that
+// they represent. Initialized once per process and shared by every render session.
+//
+// The vocabulary is published as immutable snapshots (FSignVocabulary, read-copy-update: see TRcuPointer). A session
+// takes the current snapshot once per sentence and plans/plays the whole sentence from it without any locking; the sign
+// pack sync (see FSignPackSync) builds a new snapshot on the side and swaps it in between sentences. A replaced
+// snapshot (and its pack) is freed when the last sentence using it finishes.
+//
+
+#include <Animation/AnimSequence.h>
+#include <Engine.h>
+
+#include "AnimationResidency.h"
+#include "RcuPointer.h"
+#include "SignPack.h"
+#include "SignPoseCache.h"
+
+namespace ASLMetaHuman::Core {
+
+// Immutable snapshot of the sign vocabulary. Animation residency and the pose cache are shared by every snapshot
+// (internally synchronized streaming state, not vocabulary)
+//
+class FSignVocabulary {
+public:
+    using FTokensByWordCount = TMap<unsigned int, TArray<FString>>;
+
+    bool Contains(const FString & Token) const {
+        return Signs.Contains(Token);
+    }
+
+    bool HasSignPack() const {
+        return Pack.IsValid();
+    }
+
+    // Returns the (unscaled) play length in seconds of an ASL sign/token's animation; 0.0f if the sign isn't known
+    //
+    float GetPlayLength(const FString & Token) const;
+
+    // Returns the playable tracks of a sign of the sign pack, or nullptr if the sign isn't in the pack (then use
+    // AcquireSequence())
+    //
+    TSharedPtr<const FSignPackClip> FindPackClip(const FString & Token) const;
+
+    // Returns the animation sequence for an ASL sign/token, waiting for it to stream in if needed (see
+    // AnimationLoadTimeoutSeconds). Returns an invalid pointer if the sign isn't known or couldn't be loaded
+    //
+    TWeakObjectPtr<UAnimSequence> AcquireSequence(const FString & Token) const;
+
+    // Starts streaming in the animations of upcoming signs/tokens
+    //
+    void Prefetch(const TArray<FString> & Tokens) const;
+
+    // Pose cache (if PoseCacheEnabled): returns the pre-decompressed tracks of a sign that is about to be played, or
+    // nullptr if it isn't cached (yet)
+    //
+    TSharedPtr<const FSignPoseTracks> FindPoseTracks(const FString & Token,
+            const TWeakObjectPtr<UAnimSequence> & Sequence) const;
+
+    // Word counts are sorted descending (ASL signs/tokens are substituted from the largest to the smallest word count)
+    //
+    const FTokensByWordCount & GetTranslatableTokensByWordCount() const {
+        return TranslatableTokensByWordCount;
+    }
+
+private:
+    friend class ASLMetaHumanSignDictionary;
+
+    struct FSign {
+        // Index in Pack; INDEX_NONE if the sign is played from its animation sequence
+        //
+        int32 PackSign {INDEX_NONE};
+        bool Pinned {false};
+    };
+
+    TMap<FString, FSign> Signs;
+    FTokensByWordCount TranslatableTokensByWordCount;
+    TSharedPtr<const FSignPack> Pack;
+    TSharedPtr<FAnimationResidency> Residency;
+    TSharedPtr<FSignPoseCache> PoseCache;
+};
+
+class ASLMetaHumanSignDictionary {
+public:
+    using FTokensByWordCount = FSignVocabulary::FTokensByWordCount;
+
+    // Starts with an empty vocabulary (until Init())
+    //
+    ASLMetaHumanSignDictionary();
+
+    // Indexes the signs from the prebuilt manifest (SignManifestPath) if there's a valid one; otherwise from the
+    // animation sequences found in AnimationPath. Then adds the signs of the sign pack (SignPackPath), if any
+    //
+    void Init(const FString & AnimationPath);
+
+    // Naming conventions shared with the SignManifest commandlet: sign name of an animation asset, the number of words
+    // that a sign represents, and whether it's an alphabet letter (fingerspelling)
+    //
+    static FString ToSignName(const FString & AssetName);
+    static unsigned int CountWords(const FString & SignName);
+    static bool IsLetter(const FString & SignName);
+
+    // Returns the current vocabulary snapshot (lock-free). Note: keep it for a whole sentence
+    //
+    TSharedRef<const FSignVocabulary> GetVocabulary() const {
+        return Vocabulary.Get().ToSharedRef();
+    }
+
+    // Publishes a new vocabulary with a new sign pack (e.g. synced from S3). Sentences in flight keep the previous one
+    //
+    void InstallSignPack(const TSharedRef<const FSignPack> & NewPack);
+
+    // Waits up to TimeoutSeconds for the pinned signs (alphabet and PinnedSignTokens) to stream in. Returns false if
+    // some of them are still loading
+    //
+    bool WaitForPinned(const float TimeoutSeconds) const;
+
+    // Starts caching the poses of the resident pinned signs (i.e. the alphabet), if PoseCacheEnabled
+    //
+    void WarmPoseCache() const;
+
+    void LogStats() const;
+
+private:
+    bool InitFromManifest(const FString & ManifestPath, const TArray<FString> & PinnedTokens);
+    void InitFromAssetRegistry(const FString & AnimationPath, const TArray<FString> & PinnedTokens);
+    void InitSignPack(const FString & PackPath);
+    void RegisterSign(const FString & SignName,
+            const FSoftObjectPath & Path,
+            const float PlayLength,
+            const unsigned int WordCount,
+            const bool Pinned);
+    TSharedRef<FSignVocabulary> MakeVocabulary(const TSharedPtr<const FSignPack> & SignPack, int32 & NewSigns) const;
+    static void AddTranslatableToken(FTokensByWordCount & Tokens,
+            const FString & SignName,
+            const unsigned int WordCount);
+
+    TRcuPointer<FSignVocabulary> Vocabulary;
+
+    // Known signs and their animation residency (alphabet and PinnedSignTokens pinned, others LRU within a budget)
+    //
+    TSharedPtr<FAnimationResidency> Residency;
+
+    // Pre-decompressed poses of the hot signs (only with PoseCacheEnabled)
+    //
+    TSharedPtr<FSignPoseCache> PoseCache;
+
+    // The animation sequences' signs, which every vocabulary starts from (then the signs that only its sign pack
+    // provides are added). Only written during Init()
+    //
+    TMap<FString, FSignVocabulary::FSign> BaseSigns;
+    FTokensByWordCount BaseTokensByWordCount;
+};
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents a compact binary log of received actions (for recording production traffic and replaying it later).
+//
+
+#include "ActionRecording.h"
+
+#include <HAL/FileManager.h>
+
+using ASLMetaHuman::Core::EActionChannel;
+using ASLMetaHuman::Core::FActionMessage;
+using ASLMetaHuman::Core::FActionRecord;
+using ASLMetaHuman::Core::FActionRecordReader;
+using ASLMetaHuman::Core::FActionRecordWriter;
+
+namespace {
+constexpr uint32 RecordingMagic = 0x524C5341; // "ASLR"
+constexpr uint32 RecordingVersion = 1;
+// Size of one entry without its body: offset, send time, channel, body length
+//
+constexpr int64 RecordHeaderSize = sizeof(int64) + sizeof(int64) + sizeof(uint8) + sizeof(uint32);
+// Console status-related messages
+//
+constexpr auto & ErrorOpenRecordingFormatted = TEXT("Error: can't open action recording: %s");
+constexpr auto & ErrorInvalidRecordingFormatted = TEXT("Error: not a (supported) action recording: %s");
+constexpr auto & ErrorTruncatedRecordingFormatted = TEXT("Action recording is truncated after %d entries: %s");
+constexpr auto & InfoRecordingFormatted = TEXT("Recording received actions to: %s");
+
+int64 GetUtcNowMs() {
+    return static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+}
+}
+
+FActionRecordWriter::~FActionRecordWriter() {
+    FScopeLock ScopeLock(&MutexWriter);
+    if (nullptr != Writer) {
+        Writer->Close();
+        Writer.Reset();
+    }
+}
+
+bool FActionRecordWriter::Open(const FString & Path) {
+    FScopeLock ScopeLock(&MutexWriter);
+    Writer = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_AllowRead));
+    if (nullptr == Writer) {
+        UE_LOG(LogTemp, Error, ErrorOpenRecordingFormatted, *Path);
+        return false;
+    }
+    uint32 Magic = RecordingMagic;
+    uint32 Version = RecordingVersion;
+    int64 StartMs = GetUtcNowMs();
+    *Writer << Magic << Version << StartMs;
+    Writer->Flush();
+    StartSeconds = FPlatformTime::Seconds();
+    UE_LOG(LogTemp, Log, InfoRecordingFormatted, *Path);
+    return true;
+}
+
+// Appends one entry, timestamped with the time that the message was received
+//
+void FActionRecordWriter::Append(const EActionChannel Channel, const FActionMessage & Message) {
+    FScopeLock ScopeLock(&MutexWriter);
+    if (nullptr == Writer) {
+        return;
+    }
+    const FTCHARToUTF8 Utf8Body(*Message.Body);
+    int64 OffsetMicroseconds = static_cast<int64>(FMath::Max(0.0, Message.ReceivedSeconds - StartSeconds) * 1000000.0);
+    int64 SentTimestampMs = Message.SentTimestampMs;
+    uint8 ChannelValue = static_cast<uint8>(Channel);
+    uint32 BodyLength = static_cast<uint32>(Utf8Body.Length());
+    *Writer << OffsetMicroseconds << SentTimestampMs << ChannelValue << BodyLength;
+    Writer->Serialize(const_cast<ANSICHAR *>(Utf8Body.Get()), BodyLength);
+    // Keep the recording usable if the process doesn't shut down cleanly
+    //
+    Writer->Flush();
+}
+
+bool FActionRecordReader::Load(const FString & Path, TArray<FActionRecord> & Records) {
+    Records.Reset();
+    const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+    if (nullptr == Reader) {
+        UE_LOG(LogTemp, Error, ErrorOpenRecordingFormatted, *Path);
+        return false;
+    }
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    int64 StartMs = 0;
+    *Reader << Magic << Version << StartMs;
+    if (Reader->IsError() || (RecordingMagic != Magic) || (RecordingVersion != Version)) {
+        UE_LOG(LogTemp, Error, ErrorInvalidRecordingFormatted, *Path);
+        return false;
+    }
+    TArray<ANSICHAR> BodyBuffer;
+    while (! Reader->AtEnd()) {
+        FActionRecord Record;
+        uint8 ChannelValue = 0;
+        uint32 BodyLength = 0;
+        if (Reader->TotalSize() - Reader->Tell() < RecordHeaderSize) {
+            UE_LOG(LogTemp, Warning, ErrorTruncatedRecordingFormatted, Records.Num(), *Path);
+            break;
+        }
+        *Reader << Record.OffsetMicroseconds << Record.SentTimestampMs << ChannelValue << BodyLength;
+        if (Reader->TotalSize() - Reader->Tell() < BodyLength) {
+            UE_LOG(LogTemp, Warning, ErrorTruncatedRecordingFormatted, Records.Num(), *Path);
+            break;
+        }
+        BodyBuffer.SetNumUninitialized(BodyLength);
+        Reader->Serialize(BodyBuffer.GetData(), BodyLength);
+        const FUTF8ToTCHAR Converted(BodyBuffer.GetData(), BodyLength);
+        Record.Body = FString(Converted.Length(), Converted.Get());
+        Record.Channel = ChannelValue ? EActionChannel::TRANSLATION : EActionChannel::IMMEDIATE;
+        Records.Add(MoveTemp(Record));
+    }
+    return true;
+}
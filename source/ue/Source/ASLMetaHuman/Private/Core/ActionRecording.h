@@ -0,0 +1,60 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents a compact binary log of received actions (for recording production traffic and replaying it later).
+//
+// Layout (little endian): uint32 magic "ASLR", uint32 version, int64 recording start (UTC ms since the Unix epoch),
+// then one entry per action: int64 offset (microseconds since the recording start), int64 producer send time (UTC ms;
+// 0 if unknown), uint8 channel, uint32 body length, UTF-8 body.
+//
+
+#include "AsynchronousActionWorker.h"
+
+namespace ASLMetaHuman::Core {
+
+// One recorded action
+//
+struct FActionRecord {
+    int64 OffsetMicroseconds {0};
+    int64 SentTimestampMs {0};
+    EActionChannel Channel {EActionChannel::IMMEDIATE};
+    FString Body;
+};
+
+// Appends received actions to a recording; thread-safe
+//
+class FActionRecordWriter {
+public:
+    ~FActionRecordWriter();
+    bool Open(const FString & Path);
+    void Append(const EActionChannel Channel, const FActionMessage & Message);
+
+private:
+    TUniquePtr<FArchive> Writer;
+    double StartSeconds {0.0};
+    FCriticalSection MutexWriter;
+};
+
+// Loads a recording written by FActionRecordWriter
+//
+class FActionRecordReader {
+public:
+    static bool Load(const FString & Path, TArray<FActionRecord> & Records);
+};
+}
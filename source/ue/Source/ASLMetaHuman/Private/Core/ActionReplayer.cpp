@@ -0,0 +1,116 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents a replayer for recorded action traffic (see ActionRecording.h).
+//
+
+#include "ActionReplayer.h"
+#include "Config/GlobalState.h"
+
+#include <Async/Async.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Core::FActionRecord;
+using ASLMetaHuman::Core::FActionReplayer;
+
+namespace {
+// Longest single sleep while waiting for the next action (keeps shutdown responsive)
+//
+constexpr double MaxReplayWaitSeconds = 0.05;
+// Console status-related messages
+//
+constexpr auto & InfoReplayLoadedFormatted = TEXT("Replaying %d recorded actions (%.2f s recorded) from: %s");
+constexpr auto & InfoReplayReportFormatted = TEXT(
+        "%s replay: %d injected (%d failed) in %.2f s at speed %.2f | %llu drained in %.2f s (%.2f actions/s) | "
+        "timing divergence avg %.2f ms max %.2f ms");
+}
+
+FActionReplayer::~FActionReplayer() {
+    Stopping = true;
+    if (ReplayFuture.IsValid()) {
+        ReplayFuture.Wait();
+    }
+}
+
+bool FActionReplayer::Load(const FString & Path) {
+    if (! FActionRecordReader::Load(Path, Records)) {
+        return false;
+    }
+    const double RecordedSeconds = Records.IsEmpty()
+            ? 0.0
+            : (Records.Last().OffsetMicroseconds - Records[0].OffsetMicroseconds) / 1000000.0;
+    UE_LOG(LogTemp, Log, InfoReplayLoadedFormatted, Records.Num(), RecordedSeconds, *Path);
+    return true;
+}
+
+void FActionReplayer::Start(const float Speed, TFunction<bool(const FActionRecord &)> && Sink) {
+    ReplaySpeed = Speed;
+    InjectSink = MoveTemp(Sink);
+    ReplayFuture = Async(EAsyncExecution::Thread, [this]() {
+        Run();
+    });
+}
+
+bool FActionReplayer::IsStopping() const {
+    return Stopping || FGlobalState::IsAborting();
+}
+
+// Injects every record at its (scaled) recorded offset; divergence is the lateness of each injection
+//
+void FActionReplayer::Run() {
+    StartSeconds = FPlatformTime::Seconds();
+    const int64 FirstOffsetMicroseconds = Records.IsEmpty() ? 0 : Records[0].OffsetMicroseconds;
+    for (const auto & Record: Records) {
+        if (IsStopping()) {
+            break;
+        }
+        double DueSeconds = StartSeconds;
+        if (ReplaySpeed > 0.0f) {
+            DueSeconds += (Record.OffsetMicroseconds - FirstOffsetMicroseconds) / 1000000.0 / ReplaySpeed;
+            double NowSeconds = FPlatformTime::Seconds();
+            while ((NowSeconds < DueSeconds) && (! IsStopping())) {
+                FPlatformProcess::Sleep(static_cast<float>(FMath::Min(DueSeconds - NowSeconds, MaxReplayWaitSeconds)));
+                NowSeconds = FPlatformTime::Seconds();
+            }
+            if (IsStopping()) {
+                break;
+            }
+        }
+        if (InjectSink(Record)) {
+            InjectedCount.Increment();
+        } else {
+            FailedCount.Increment();
+        }
+        if (ReplaySpeed > 0.0f) {
+            const double DivergenceSeconds = FMath::Max(0.0, FPlatformTime::Seconds() - DueSeconds);
+            TotalDivergenceSeconds += DivergenceSeconds;
+            MaxDivergenceSeconds = FMath::Max(MaxDivergenceSeconds, DivergenceSeconds);
+        }
+    }
+    FinishedSeconds = FPlatformTime::Seconds();
+    Finished = true;
+}
+
+void FActionReplayer::LogReport(const FString & SourceName, const uint64 DrainedCount, const double DrainedAtSeconds) const {
+    const double DrainedSeconds = DrainedAtSeconds - StartSeconds;
+    const int32 Attempted = InjectedCount.GetValue() + FailedCount.GetValue();
+    const double AverageDivergenceMs = Attempted ? TotalDivergenceSeconds / Attempted * 1000.0 : 0.0;
+    UE_LOG(LogTemp, Log, InfoReplayReportFormatted, *SourceName, InjectedCount.GetValue(), FailedCount.GetValue(),
+            FinishedSeconds - StartSeconds, ReplaySpeed, DrainedCount, DrainedSeconds,
+            DrainedSeconds > 0.0 ? DrainedCount / DrainedSeconds : 0.0, AverageDivergenceMs, MaxDivergenceSeconds * 1000.0);
+}
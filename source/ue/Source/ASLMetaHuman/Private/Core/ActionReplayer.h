@@ -0,0 +1,77 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents a replayer for recorded action traffic (see ActionRecording.h). Actions are injected into an action
+// source at the recorded pace, N times faster, or as fast as possible; the report covers drain throughput and how far
+// injection diverged from the recorded timing (per-stage latency is reported by the action source's ingest stats).
+//
+
+#include "ActionRecording.h"
+
+namespace ASLMetaHuman::Core {
+
+class FActionReplayer {
+public:
+    // Stops injecting (if started) and waits for the replay thread
+    //
+    ~FActionReplayer();
+
+    bool Load(const FString & Path);
+
+    // Starts injecting on a dedicated thread. Speed: 1 = recorded timing, N = N times faster, <= 0 = no delays.
+    // Sink returns false if an action couldn't be injected
+    //
+    void Start(const float Speed, TFunction<bool(const FActionRecord &)> && Sink);
+
+    bool IsFinished() const {
+        return Finished;
+    }
+    int32 GetInjectedCount() const {
+        return InjectedCount.GetValue();
+    }
+    double GetFinishedSeconds() const {
+        return FinishedSeconds;
+    }
+    // Logs injection timing and drain throughput (DrainedCount completions from the replay start until DrainedAtSeconds)
+    //
+    void LogReport(const FString & SourceName, const uint64 DrainedCount, const double DrainedAtSeconds) const;
+
+private:
+    bool IsStopping() const;
+    void Run();
+
+    TArray<FActionRecord> Records;
+    TFunction<bool(const FActionRecord &)> InjectSink;
+    TFuture<void> ReplayFuture;
+    float ReplaySpeed {1.0f};
+    FThreadSafeBool Finished {false};
+    // Set by the destructor: stops injecting between actions and while waiting for the next one
+    //
+    FThreadSafeBool Stopping {false};
+    FThreadSafeCounter InjectedCount;
+    FThreadSafeCounter FailedCount;
+
+    // Written by the replay thread only; read once Finished is set
+    //
+    double StartSeconds {0.0};
+    double FinishedSeconds {0.0};
+    double TotalDivergenceSeconds {0.0};
+    double MaxDivergenceSeconds {0.0};
+};
+}
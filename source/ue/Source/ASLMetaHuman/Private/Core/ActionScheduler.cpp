@@ -0,0 +1,137 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents the in-process action scheduler that sits between an action source and the action handler.
+//
+
+#include "ActionScheduler.h"
+
+using ASLMetaHuman::Core::EActionChannel;
+using ASLMetaHuman::Core::EActionPriority;
+using ASLMetaHuman::Core::FActionMessage;
+using ASLMetaHuman::Core::FActionScheduler;
+using ASLMetaHuman::Core::FScheduledAction;
+
+namespace {
+// Console status-related messages
+//
+constexpr auto & InfoCoalescedFormatted = TEXT("Superseded %s action dropped");
+constexpr auto & InfoPreemptedFormatted = TEXT("Pending %s action dropped (preempted by STOP)");
+constexpr auto & InfoSchedulerStatsFormatted = TEXT(
+        "%s scheduler: %llu enqueued | %llu dispatched | %llu coalesced | %llu preempted | max pending %d");
+}
+
+// Classifies an action: STOP preempts everything; avatar/sign rate/settings changes are cheap control actions;
+// backgrounds belong to a sentence (content); sentences are long-running
+//
+EActionPriority FActionScheduler::GetPriority(const EASLMetaHumanActionType ActionType) {
+    switch (ActionType) {
+        case EASLMetaHumanActionType::STOP_ALL_ANIMATIONS:
+            return EActionPriority::PREEMPT;
+        case EASLMetaHumanActionType::CHANGE_BACKGROUND:
+            return EActionPriority::CONTENT;
+        case EASLMetaHumanActionType::ANIMATE_SENTENCE:
+            return EActionPriority::TRANSLATION;
+        default:
+            return EActionPriority::CONTROL;
+    }
+}
+
+// Only the newest pending action of these types is worth executing (each one fully replaces a setting; settings changes
+// aren't coalesced since each one may change different knobs)
+//
+bool FActionScheduler::IsCoalescable(const EASLMetaHumanActionType ActionType) {
+    switch (ActionType) {
+        case EASLMetaHumanActionType::CHANGE_AVATAR:
+        case EASLMetaHumanActionType::CHANGE_SIGN_RATE:
+        case EASLMetaHumanActionType::STOP_ALL_ANIMATIONS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void FActionScheduler::Enqueue(const EActionChannel Channel,
+        const FActionMessage & Message,
+        TArray<FScheduledAction> & DroppedActions) {
+    FScheduledAction NewAction;
+    NewAction.Message = Message;
+    NewAction.Channel = Channel;
+    NewAction.ActionType = ASLMetaHumanAction(Message.Body).GetActionType();
+    NewAction.Priority = GetPriority(NewAction.ActionType);
+    NewAction.Sequence = NextSequence++;
+    auto & SamePriority = GetPending(NewAction.Priority);
+    if (IsCoalescable(NewAction.ActionType)) {
+        for (int32 i = SamePriority.Num() - 1; i >= 0; i--) {
+            if (SamePriority[i].ActionType == NewAction.ActionType) {
+                UE_LOG(LogTemp, Log, InfoCoalescedFormatted, *UEnum::GetValueAsString(NewAction.ActionType));
+                DroppedActions.Add(MoveTemp(SamePriority[i]));
+                SamePriority.RemoveAt(i);
+                Stats.Coalesced++;
+            }
+        }
+    }
+    if (EActionPriority::PREEMPT == NewAction.Priority) {
+        // Pending backgrounds and sentences were received before the STOP request and are now stale
+        //
+        for (const auto StalePriority: {EActionPriority::CONTENT, EActionPriority::TRANSLATION}) {
+            for (auto & StaleAction: GetPending(StalePriority)) {
+                UE_LOG(LogTemp, Log, InfoPreemptedFormatted, *UEnum::GetValueAsString(StaleAction.ActionType));
+                DroppedActions.Add(MoveTemp(StaleAction));
+                Stats.Preempted++;
+            }
+            GetPending(StalePriority).Reset();
+        }
+    }
+    SamePriority.Add(MoveTemp(NewAction));
+    Stats.Enqueued++;
+    Stats.MaxPending = FMath::Max(Stats.MaxPending, Num());
+}
+
+bool FActionScheduler::Dequeue(FScheduledAction & Action,
+        const TFunctionRef<bool(const FScheduledAction &)> & IsEligible) {
+    for (auto & PendingActions: Pending) {
+        // Note: an ineligible head blocks its class (keeps FIFO order within a class)
+        //
+        if (PendingActions.IsEmpty() || (! IsEligible(PendingActions[0]))) {
+            continue;
+        }
+        Action = MoveTemp(PendingActions[0]);
+        PendingActions.RemoveAt(0);
+        Stats.Dispatched++;
+        return true;
+    }
+    return false;
+}
+
+bool FActionScheduler::HasPending(const EActionPriority Priority) const {
+    return ! Pending[static_cast<uint8>(Priority)].IsEmpty();
+}
+
+int32 FActionScheduler::Num() const {
+    int32 Count = 0;
+    for (const auto & PendingActions: Pending) {
+        Count += PendingActions.Num();
+    }
+    return Count;
+}
+
+void FActionScheduler::LogStats(const FString & SourceName) const {
+    UE_LOG(LogTemp, Log, InfoSchedulerStatsFormatted, *SourceName, Stats.Enqueued, Stats.Dispatched, Stats.Coalesced,
+            Stats.Preempted, Stats.MaxPending);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents the in-process action scheduler that sits between an action source and the action handler.
+// Received actions are held in explicit priority classes; STOP preempts (and discards) stale pending content, and
+// superseded control actions are coalesced so that only the newest one is executed.
+//
+
+#include "AsynchronousActionWorker.h"
+
+namespace ASLMetaHuman::Core {
+
+// Priority classes, highest first
+//
+enum class EActionPriority : uint8 {
+    PREEMPT,
+    CONTROL,
+    CONTENT,
+    TRANSLATION,
+    COUNT
+};
+
+// One received (and already acknowledged) action waiting for dispatch
+//
+struct FScheduledAction {
+    FActionMessage Message;
+    EActionChannel Channel {EActionChannel::IMMEDIATE};
+    EASLMetaHumanActionType ActionType {EASLMetaHumanActionType::NONE};
+    EActionPriority Priority {EActionPriority::CONTROL};
+    uint64 Sequence {0};
+};
+
+// Scheduler outcome counters
+//
+struct FActionSchedulerStats {
+    uint64 Enqueued {0};
+    uint64 Dispatched {0};
+    uint64 Coalesced {0};
+    uint64 Preempted {0};
+    int32 MaxPending {0};
+};
+
+// Note: owned and used by one action source worker thread; not thread-safe
+//
+class FActionScheduler {
+public:
+    // Adds an action; actions that it supersedes (coalescing) or preempts are moved to DroppedActions
+    //
+    void Enqueue(const EActionChannel Channel, const FActionMessage & Message, TArray<FScheduledAction> & DroppedActions);
+
+    // Removes the next action to dispatch: the oldest action of the highest priority class whose head is eligible
+    //
+    bool Dequeue(FScheduledAction & Action, const TFunctionRef<bool(const FScheduledAction &)> & IsEligible);
+
+    bool HasPending(const EActionPriority Priority) const;
+    int32 Num() const;
+    const FActionSchedulerStats & GetStats() const {
+        return Stats;
+    }
+    void LogStats(const FString & SourceName) const;
+
+    static EActionPriority GetPriority(const EASLMetaHumanActionType ActionType);
+    static bool IsCoalescable(const EASLMetaHumanActionType ActionType);
+
+private:
+    TArray<FScheduledAction> & GetPending(const EActionPriority Priority) {
+        return Pending[static_cast<uint8>(Priority)];
+    }
+
+    TArray<FScheduledAction> Pending[static_cast<uint8>(EActionPriority::COUNT)];
+    uint64 NextSequence {1};
+    FActionSchedulerStats Stats;
+};
+}
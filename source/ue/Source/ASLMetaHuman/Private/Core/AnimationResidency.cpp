@@ -0,0 +1,296 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Streams ASL sign animations in and out of memory (see AnimationResidency.h)
+//
+
+#include "AnimationResidency.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FAnimationResidency;
+
+namespace {
+constexpr double BytesPerMB {1024.0 * 1024.0};
+constexpr auto & InfoResidencyStatsFormatted = TEXT("Sign animations: %d known, %d resident (%.1f MB, peak %.1f MB of %.1f MB); %llu hits, %llu misses, %llu timeouts, %llu evictions");
+constexpr auto & WarningLoadTimedOutFormatted = TEXT("Sign animation %s didn't load within %.1f seconds: skipped");
+constexpr auto & WarningLoadFailedFormatted = TEXT("Sign animation %s failed to load (%s)");
+}
+
+FAnimationResidency::FAnimationResidency(const int64 InBudgetBytes): BudgetBytes(InBudgetBytes) {
+}
+
+FAnimationResidency::~FAnimationResidency() {
+    FScopeLock ScopeLock(&MutexSequences);
+    for (auto & [Token, Entry]: Sequences) {
+        if (Entry.Handle.IsValid()) {
+            Entry.Handle->CancelHandle();
+        }
+    }
+}
+
+void FAnimationResidency::Register(const FString & Token,
+        const FSoftObjectPath & Path,
+        const float PlayLength,
+        const bool Pinned) {
+    FScopeLock ScopeLock(&MutexSequences);
+    auto & Entry = Sequences.FindOrAdd(Token);
+    Entry.Path = Path;
+    Entry.PlayLength = PlayLength;
+    Entry.Pinned = Pinned;
+}
+
+void FAnimationResidency::LoadPinned() {
+    RequestLoads(GetPinnedTokens());
+}
+
+bool FAnimationResidency::WaitForPinned(const float TimeoutSeconds) const {
+    const auto IsLoadingPinned = [this]() {
+        FScopeLock ScopeLock(&MutexSequences);
+        for (const auto & [Token, Entry]: Sequences) {
+            if (Entry.Pinned && Entry.Requested) {
+                return true;
+            }
+        }
+        return false;
+    };
+    const float SpinlockSeconds = FInternalSettings::GetAnimationSpinlockSeconds();
+    for (float i = 0.0f; IsLoadingPinned(); i += SpinlockSeconds) {
+        if ((i >= TimeoutSeconds) || FGlobalState::IsAborting()) {
+            return false;
+        }
+        FPlatformProcess::Sleep(SpinlockSeconds);
+    }
+    return true;
+}
+
+void FAnimationResidency::Prefetch(const TArray<FString> & Tokens) {
+    RequestLoads(Tokens);
+}
+
+bool FAnimationResidency::Contains(const FString & Token) const {
+    FScopeLock ScopeLock(&MutexSequences);
+    return Sequences.Contains(Token);
+}
+
+bool FAnimationResidency::IsPinned(const FString & Token) const {
+    FScopeLock ScopeLock(&MutexSequences);
+    const auto EntryPtr = Sequences.Find(Token);
+    return (nullptr != EntryPtr) && EntryPtr->Pinned;
+}
+
+TArray<FString> FAnimationResidency::GetPinnedTokens() const {
+    TArray<FString> Tokens;
+    FScopeLock ScopeLock(&MutexSequences);
+    for (const auto & [Token, Entry]: Sequences) {
+        if (Entry.Pinned) {
+            Tokens.Add(Token);
+        }
+    }
+    return Tokens;
+}
+
+TWeakObjectPtr<UAnimSequence> FAnimationResidency::FindResident(const FString & Token) const {
+    FScopeLock ScopeLock(&MutexSequences);
+    const auto EntryPtr = Sequences.Find(Token);
+    return nullptr == EntryPtr ? nullptr : EntryPtr->Sequence;
+}
+
+float FAnimationResidency::GetPlayLength(const FString & Token) const {
+    FScopeLock ScopeLock(&MutexSequences);
+    const auto EntryPtr = Sequences.Find(Token);
+    return nullptr == EntryPtr ? 0.0f : EntryPtr->PlayLength;
+}
+
+// Note: on the game thread (where streaming completes) a missing sign is loaded synchronously instead of waited for;
+// it is kept by its streamable handle and counted against the budget like any streamed-in sign
+//
+TWeakObjectPtr<UAnimSequence> FAnimationResidency::Acquire(const FString & Token, const float TimeoutSeconds) {
+    FSoftObjectPath Path;
+    {
+        FScopeLock ScopeLock(&MutexSequences);
+        auto EntryPtr = Sequences.Find(Token);
+        if (nullptr == EntryPtr) {
+            return nullptr;
+        }
+        EntryPtr->LastUse = ++UseCounter;
+        if (EntryPtr->Sequence.IsValid()) {
+            Hits++;
+            return EntryPtr->Sequence;
+        }
+        Misses++;
+        Path = EntryPtr->Path;
+    }
+    if (IsInGameThread()) {
+        const auto Handle = StreamableManager.RequestSyncLoad(Path);
+        FScopeLock ScopeLock(&MutexSequences);
+        auto & Entry = Sequences[Token];
+        if (! Entry.Sequence.IsValid()) {
+            // Replaces the handle of a pending asynchronous request (its completion then finds the sign resident)
+            //
+            Entry.Handle = Handle;
+            RecordLoaded(Token, Entry);
+        }
+        return Entry.Sequence;
+    }
+    RequestLoads({Token});
+    const float SpinlockSeconds = FInternalSettings::GetAnimationSpinlockSeconds();
+    for (float i = 0.0f; (i < TimeoutSeconds) && (! FGlobalState::IsAborting()); i += SpinlockSeconds) {
+        FPlatformProcess::Sleep(SpinlockSeconds);
+        FScopeLock ScopeLock(&MutexSequences);
+        const auto & Entry = Sequences[Token];
+        if (Entry.Sequence.IsValid()) {
+            return Entry.Sequence;
+        }
+        if (! Entry.Requested) {
+            // Load failed (see OnLoaded)
+            //
+            return nullptr;
+        }
+    }
+    {
+        FScopeLock ScopeLock(&MutexSequences);
+        Timeouts++;
+    }
+    UE_LOG(LogTemp, Warning, WarningLoadTimedOutFormatted, *Token, TimeoutSeconds);
+    return nullptr;
+}
+
+// Issues one streaming request per sign that is neither resident nor already requested
+//
+void FAnimationResidency::RequestLoads(const TArray<FString> & Tokens) {
+    TArray<TPair<FString, FSoftObjectPath>> Requests;
+    {
+        FScopeLock ScopeLock(&MutexSequences);
+        for (const auto & Token: Tokens) {
+            auto EntryPtr = Sequences.Find(Token);
+            if ((nullptr == EntryPtr) || EntryPtr->Requested || EntryPtr->Sequence.IsValid()) {
+                continue;
+            }
+            EntryPtr->Requested = true;
+            EntryPtr->LastUse = ++UseCounter;
+            Requests.Emplace(Token, EntryPtr->Path);
+        }
+    }
+    if (Requests.IsEmpty()) {
+        return;
+    }
+    const TWeakPtr<FAnimationResidency, ESPMode::ThreadSafe> WeakResidency = AsShared();
+    const auto RequestTask = [WeakResidency, Requests]() {
+        const auto Residency = WeakResidency.Pin();
+        if (! Residency.IsValid()) {
+            return;
+        }
+        for (const auto & [Token, Path]: Requests) {
+            {
+                // Loaded synchronously (see Acquire) while this request was queued
+                //
+                FScopeLock ScopeLock(&Residency->MutexSequences);
+                if (Residency->Sequences[Token].Sequence.IsValid()) {
+                    continue;
+                }
+            }
+            const auto Delegate = FStreamableDelegate::CreateThreadSafeSP(
+                    Residency.ToSharedRef(), &FAnimationResidency::OnLoaded, Token);
+            auto Handle = Residency->StreamableManager.RequestAsyncLoad(Path, Delegate);
+            FScopeLock ScopeLock(&Residency->MutexSequences);
+            Residency->Sequences[Token].Handle = Handle;
+        }
+    };
+    if (IsInGameThread()) {
+        RequestTask();
+    } else {
+        FFunctionGraphTask::CreateAndDispatchWhenReady(RequestTask, TStatId(), nullptr, ENamedThreads::GameThread);
+    }
+}
+
+// Game thread: completes an asynchronous request. A request that a synchronous load (see Acquire) already completed
+// has nothing left to record
+//
+void FAnimationResidency::OnLoaded(FString Token) {
+    FScopeLock ScopeLock(&MutexSequences);
+    auto & Entry = Sequences[Token];
+    if ((! Entry.Requested) || Entry.Sequence.IsValid()) {
+        Entry.Requested = false;
+        return;
+    }
+    RecordLoaded(Token, Entry);
+}
+
+// Game thread (under MutexSequences): records a loaded sign (its actual length and size) and trims the LRU
+//
+void FAnimationResidency::RecordLoaded(const FString & Token, FResidentSequence & Entry) {
+    Entry.Requested = false;
+    const auto Sequence = Cast<UAnimSequence>(Entry.Path.ResolveObject());
+    if (nullptr == Sequence) {
+        UE_LOG(LogTemp, Warning, WarningLoadFailedFormatted, *Token, *Entry.Path.ToString());
+        Entry.Handle.Reset();
+        return;
+    }
+    Entry.Sequence = Sequence;
+    Entry.PlayLength = Sequence->GetPlayLength();
+    Entry.SizeBytes = static_cast<int64>(Sequence->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal));
+    ResidentBytes += Entry.SizeBytes;
+    PeakResidentBytes = FMath::Max(PeakResidentBytes, ResidentBytes);
+    TrimToBudget();
+}
+
+// Releases the least recently used unpinned signs until the resident set fits the budget. The most recently used
+// sign is kept even if it alone exceeds the budget. Note: a released sequence that is still playing is kept alive by
+// its skeletal mesh component until it finishes (then garbage collected)
+//
+void FAnimationResidency::TrimToBudget() {
+    while (ResidentBytes > BudgetBytes) {
+        FResidentSequence * OldestPtr = nullptr;
+        uint64 NewestUse = 0;
+        for (auto & [Token, Entry]: Sequences) {
+            if (! Entry.Sequence.IsValid()) {
+                continue;
+            }
+            NewestUse = FMath::Max(NewestUse, Entry.LastUse);
+            if ((! Entry.Pinned) && ((nullptr == OldestPtr) || (Entry.LastUse < OldestPtr->LastUse))) {
+                OldestPtr = &Entry;
+            }
+        }
+        if ((nullptr == OldestPtr) || (OldestPtr->LastUse == NewestUse)) {
+            return;
+        }
+        if (OldestPtr->Handle.IsValid()) {
+            OldestPtr->Handle->ReleaseHandle();
+            OldestPtr->Handle.Reset();
+        }
+        OldestPtr->Sequence.Reset();
+        ResidentBytes -= OldestPtr->SizeBytes;
+        OldestPtr->SizeBytes = 0;
+        Evictions++;
+    }
+}
+
+void FAnimationResidency::LogStats() const {
+    FScopeLock ScopeLock(&MutexSequences);
+    int32 ResidentCount = 0;
+    for (const auto & [Token, Entry]: Sequences) {
+        if (Entry.Sequence.IsValid()) {
+            ResidentCount++;
+        }
+    }
+    UE_LOG(LogTemp, Log, InfoResidencyStatsFormatted, Sequences.Num(), ResidentCount, ResidentBytes / BytesPerMB,
+            PeakResidentBytes / BytesPerMB, BudgetBytes / BytesPerMB, Hits, Misses, Timeouts, Evictions);
+}
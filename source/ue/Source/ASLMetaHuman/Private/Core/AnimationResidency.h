@@ -0,0 +1,105 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Keeps ASL sign animations resident on demand: only metadata (asset path, play length) is known up front, sequences
+// are streamed in asynchronously on first use or ahead of a planned sentence. Pinned signs (e.g. the alphabet) stay
+// resident; the others are kept in an LRU that is trimmed to a memory budget.
+//
+// Note: the streamable manager is only touched on the game thread; lookups and waits are safe from any thread.
+// Instances must be owned by a (thread-safe) shared pointer: deferred game thread requests and streaming callbacks only
+// hold a weak reference
+//
+
+#include <Animation/AnimSequence.h>
+#include <Engine/StreamableManager.h>
+
+namespace ASLMetaHuman::Core {
+
+class FAnimationResidency: public TSharedFromThis<FAnimationResidency, ESPMode::ThreadSafe> {
+public:
+    explicit FAnimationResidency(const int64 InBudgetBytes);
+    ~FAnimationResidency();
+
+    void Register(const FString & Token, const FSoftObjectPath & Path, const float PlayLength, const bool Pinned);
+
+    // Starts loading every pinned sign (without waiting)
+    //
+    void LoadPinned();
+
+    // Waits up to TimeoutSeconds until no pinned sign is loading anymore (failed loads are logged by OnLoaded).
+    // Returns false on timeout
+    //
+    bool WaitForPinned(const float TimeoutSeconds) const;
+
+    // Starts loading the given signs (without waiting); unknown signs are ignored
+    //
+    void Prefetch(const TArray<FString> & Tokens);
+
+    // Returns a sign's animation, waiting up to TimeoutSeconds for it to stream in. Returns an invalid pointer if the
+    // sign is unknown or didn't load in time
+    //
+    TWeakObjectPtr<UAnimSequence> Acquire(const FString & Token, const float TimeoutSeconds);
+
+    bool Contains(const FString & Token) const;
+    bool IsPinned(const FString & Token) const;
+    TArray<FString> GetPinnedTokens() const;
+
+    // Returns a sign's animation if it's resident (nothing is requested or counted otherwise)
+    //
+    TWeakObjectPtr<UAnimSequence> FindResident(const FString & Token) const;
+
+    // Returns the play length in seconds (from asset metadata until the sequence is loaded); 0.0f if unknown
+    //
+    float GetPlayLength(const FString & Token) const;
+
+    void LogStats() const;
+
+private:
+    struct FResidentSequence {
+        FSoftObjectPath Path;
+        float PlayLength {0.0f};
+        bool Pinned {false};
+        bool Requested {false};
+        TSharedPtr<FStreamableHandle> Handle;
+        TWeakObjectPtr<UAnimSequence> Sequence;
+        int64 SizeBytes {0};
+        uint64 LastUse {0};
+    };
+
+    void RequestLoads(const TArray<FString> & Tokens);
+    void OnLoaded(FString Token);
+    void RecordLoaded(const FString & Token, FResidentSequence & Entry);
+    void TrimToBudget();
+
+    FStreamableManager StreamableManager;
+    TMap<FString, FResidentSequence> Sequences;
+    mutable FCriticalSection MutexSequences;
+    const int64 BudgetBytes;
+    int64 ResidentBytes {0};
+    uint64 UseCounter {0};
+
+    // Statistics (reported on shutdown)
+    //
+    uint64 Hits {0};
+    uint64 Misses {0};
+    uint64 Timeouts {0};
+    uint64 Evictions {0};
+    int64 PeakResidentBytes {0};
+};
+}
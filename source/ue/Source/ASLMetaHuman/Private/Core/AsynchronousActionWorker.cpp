@@ -0,0 +1,405 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents an Action Source Background Worker (separate thread) that will accept requests for processing.
+//
+
+#include "AsynchronousActionWorker.h"
+#include "ActionRecording.h"
+#include "ActionReplayer.h"
+#include "ActionScheduler.h"
+#include "AsynchronousFileWorker.h"
+#include "AsynchronousMqttWorker.h"
+#include "AsynchronousSocketWorker.h"
+#include "AsynchronousSQSWorker.h"
+#include "SessionRegistry.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+
+#include <Async/TaskGraphInterfaces.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::EActionChannel;
+using ASLMetaHuman::Core::EActionPriority;
+using ASLMetaHuman::Core::FActionIngestStats;
+using ASLMetaHuman::Core::FActionMessage;
+using ASLMetaHuman::Core::FActionRecord;
+using ASLMetaHuman::Core::FActionRecordWriter;
+using ASLMetaHuman::Core::FActionReplayer;
+using ASLMetaHuman::Core::FActionScheduler;
+using ASLMetaHuman::Core::FAsynchronousActionWorker;
+using ASLMetaHuman::Core::FAsynchronousFileWorker;
+using ASLMetaHuman::Core::FAsynchronousMqttWorker;
+using ASLMetaHuman::Core::FAsynchronousSocketWorker;
+using ASLMetaHuman::Core::FAsynchronousSqsWorker;
+using ASLMetaHuman::Core::FScheduledAction;
+using ASLMetaHuman::Core::FSessionRegistry;
+
+namespace {
+// Action source names (ActionSource in ASLMetaHuman.ini)
+//
+const FString & FileActionSourceName {"File"};
+const FString & MqttActionSourceName {"MQTT"};
+const FString & SocketActionSourceName {"Socket"};
+const FString & SQSActionSourceName {"SQS"};
+// Emit an ingest latency summary every time this many messages were dispatched
+//
+constexpr uint64 IngestStatsLogInterval = 50;
+// Upper bound of immediate actions that are received (and coalesced) before dispatching
+//
+constexpr int32 MaxImmediateBurst = 16;
+// Placeholder that is replaced by the claimed session (multi-instance mode)
+//
+constexpr auto & SessionPlaceholder = TEXT("{Session}");
+// A replay is considered drained once nothing completed for this long after the last injection
+//
+constexpr double ReplayDrainIdleSeconds = 30.0;
+constexpr auto & ReplayExitReason = TEXT("Action replay finished");
+// Console status-related messages
+//
+constexpr auto & ErrorInitializationFailedFormatted = TEXT("Init %s action source worker failed");
+constexpr auto & ErrorRecordingFailedFormatted = TEXT("Failed to open action recording: %s");
+constexpr auto & ErrorReplayFailedFormatted = TEXT("Failed to load action replay: %s");
+constexpr auto & ErrorSessionClaimFailed = TEXT("Failed to claim a session: action source not started");
+constexpr auto & ErrorUnknownActionSourceFormatted = TEXT("Unknown action source: %s");
+constexpr auto & InfoIngestStatsFormatted = TEXT(
+        "%s ingest: %llu messages | transport avg %.2f ms max %.2f ms | queue avg %.2f ms max %.2f ms | dispatch avg "
+        "%.2f ms max %.2f ms | end-to-end avg %.2f ms max %.2f ms (%llu samples)");
+constexpr auto & InfoMessageReceivedFormatted = TEXT("Message received from %s: %s");
+constexpr auto & InfoNoMessageReceived = TEXT("No messages received from %s");
+constexpr auto & InfoReplayDrainTimedOutFormatted = TEXT("%s replay: %llu of %d injected actions completed (drain timed out)");
+}
+
+//*******************************************************************
+// Ingest latency tracking
+//*******************************************************************
+
+void FActionIngestStats::FLatency::Add(const double Seconds) {
+    Samples++;
+    TotalSeconds += Seconds;
+    MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+}
+
+double FActionIngestStats::FLatency::GetAverageMs() const {
+    return Samples ? (TotalSeconds / Samples) * 1000.0 : 0.0;
+}
+
+// Records the latencies of one dispatched message
+//
+void FActionIngestStats::Record(const FActionMessage & Message,
+        const double DispatchStartSeconds,
+        const double DispatchEndSeconds) {
+    FScopeLock ScopeLock(&MutexStats);
+    MessageCount++;
+    Transport.Add(FMath::Max(0.0, Message.ReceivedSeconds - Message.RequestedSeconds));
+    Queue.Add(FMath::Max(0.0, DispatchStartSeconds - Message.ReceivedSeconds));
+    Dispatch.Add(FMath::Max(0.0, DispatchEndSeconds - DispatchStartSeconds));
+    if (Message.SentTimestampMs > 0) {
+        // Note: wall clock based - only meaningful when producer and renderer clocks are synchronized
+        //
+        const double NowMs = (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds();
+        const double SinceSentSeconds = (NowMs - static_cast<double>(Message.SentTimestampMs)) / 1000.0;
+        EndToEnd.Add(FMath::Max(0.0, SinceSentSeconds - (DispatchEndSeconds - DispatchStartSeconds)));
+    }
+}
+
+// Logs a latency summary of all messages dispatched so far
+//
+void FActionIngestStats::Log(const FString & SourceName) const {
+    FScopeLock ScopeLock(&MutexStats);
+    UE_LOG(LogTemp, Log, InfoIngestStatsFormatted, *SourceName, MessageCount, Transport.GetAverageMs(),
+            Transport.MaxSeconds * 1000.0, Queue.GetAverageMs(), Queue.MaxSeconds * 1000.0, Dispatch.GetAverageMs(),
+            Dispatch.MaxSeconds * 1000.0, EndToEnd.GetAverageMs(), EndToEnd.MaxSeconds * 1000.0, EndToEnd.Samples);
+}
+
+uint64 FActionIngestStats::GetMessageCount() const {
+    FScopeLock ScopeLock(&MutexStats);
+    return MessageCount;
+}
+
+//*******************************************************************
+// Shared action source behavior
+//*******************************************************************
+
+// Note: maintains an ActionHandler callback for received actions
+//
+FAsynchronousActionWorker::FAsynchronousActionWorker(
+        const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate):
+            ActionHandlerDelegate {ExternalActionHandlerDelegate},
+            Scheduler {MakeUnique<FActionScheduler>()} {
+}
+
+FAsynchronousActionWorker::~FAsynchronousActionWorker() = default;
+
+// Creates the action source worker that matches SourceName; returns nullptr if there's no such action source
+//
+TUniquePtr<FAsynchronousActionWorker> FAsynchronousActionWorker::Create(const FString & SourceName,
+        const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate) {
+    if (SourceName.Equals(SQSActionSourceName, ESearchCase::IgnoreCase)) {
+        return MakeUnique<FAsynchronousSqsWorker>(ExternalActionHandlerDelegate);
+    }
+    if (SourceName.Equals(MqttActionSourceName, ESearchCase::IgnoreCase)) {
+        return MakeUnique<FAsynchronousMqttWorker>(ExternalActionHandlerDelegate);
+    }
+    if (SourceName.Equals(SocketActionSourceName, ESearchCase::IgnoreCase)) {
+        return MakeUnique<FAsynchronousSocketWorker>(ExternalActionHandlerDelegate);
+    }
+    if (SourceName.Equals(FileActionSourceName, ESearchCase::IgnoreCase)) {
+        return MakeUnique<FAsynchronousFileWorker>(ExternalActionHandlerDelegate);
+    }
+    UE_LOG(LogTemp, Error, ErrorUnknownActionSourceFormatted, *SourceName);
+    return nullptr;
+}
+
+// Main entry point / busy-wait work loop for this background worker - triggered via StartBackgroundTask()
+// Retrieves queued action requests into the scheduler, then dispatches them by priority.
+//
+void FAsynchronousActionWorker::DoWork() {
+    if (! InitSession()) {
+        UE_LOG(LogTemp, Error, ErrorSessionClaimFailed);
+        return;
+    }
+    if (! InitSource()) {
+        UE_LOG(LogTemp, Log, ErrorInitializationFailedFormatted, GetSourceName());
+        return;
+    }
+    if (FInternalSettings::GetPurgeQueuesOnStartup()) {
+        // Failures are logged by the action source; stale messages are then processed as usual
+        //
+        ClearChannel(EActionChannel::IMMEDIATE);
+        ClearChannel(EActionChannel::TRANSLATION);
+    }
+    while ((! DispatchEnabled) && (! FGlobalState::IsAborting())) {
+        FPlatformProcess::Sleep(FInternalSettings::GetAnimationSpinlockSeconds());
+    }
+    InitRecordReplay();
+    while ((! FGlobalState::IsAborting()) && HoldsSession()) {
+        WaitForMessages();
+        if ((! FGlobalState::IsAborting()) && HoldsSession()) {
+            // Take in a burst of immediate actions first, so that superseded ones coalesce before anything runs
+            //
+            ReceiveQueuedMessages(EActionChannel::IMMEDIATE, MaxImmediateBurst);
+            // Note: the 'ready for next translate message' state will be re-enabled from outside of this class
+            // (i.e. only accept a new sentence to translate when the existing animation sequence finishes playing -
+            // determined outside). Each queued translation is considered long-running (shouldn't interrupt)
+            //
+            if (IsReadyForNextTranslationMessage() && (! Scheduler->HasPending(EActionPriority::TRANSLATION))) {
+                SetReadyForNextTranslateMessage(false);
+                if (0 == ReceiveQueuedMessages(EActionChannel::TRANSLATION, 1)) {
+                    SetReadyForNextTranslateMessage(true);
+                }
+            }
+            DispatchScheduledActions();
+            CheckReplayDrained();
+        }
+    }
+    // Stop injecting before the action source goes away
+    //
+    Replayer.Reset();
+    IngestStats.Log(GetSourceName());
+    Scheduler->LogStats(GetSourceName());
+    ShutdownSource();
+    SessionRegistry.Reset();
+}
+
+// Multi-instance mode: claims one of the configured sessions before the action source (whose queue names or topics
+// may depend on it) starts. Returns true if there's nothing to claim
+//
+bool FAsynchronousActionWorker::InitSession() {
+    TArray<FString> Candidates = SessionCandidates;
+    if (Candidates.IsEmpty()) {
+        FInternalSettings::GetSessionIds().ParseIntoArray(Candidates, TEXT(","));
+    }
+    for (auto & Candidate: Candidates) {
+        Candidate.TrimStartAndEndInline();
+    }
+    Candidates.RemoveAll([](const FString & Candidate) {
+        return Candidate.IsEmpty();
+    });
+    if (Candidates.IsEmpty()) {
+        return true;
+    }
+    SessionRegistry = MakeUnique<FSessionRegistry>();
+    return SessionRegistry->Claim(Candidates);
+}
+
+// False once another instance took this worker's session over; the worker then stops consuming (actions that are
+// still scheduled are not dispatched)
+//
+bool FAsynchronousActionWorker::HoldsSession() const {
+    return (nullptr == SessionRegistry) || (! SessionRegistry->IsLeaseLost());
+}
+
+const FString & FAsynchronousActionWorker::GetSessionId() const {
+    static const FString NoSession;
+    return nullptr != SessionRegistry ? SessionRegistry->GetSessionId() : NoSession;
+}
+
+FString FAsynchronousActionWorker::ExpandSessionName(const FString & Name) const {
+    return Name.Replace(SessionPlaceholder, *GetSessionId());
+}
+
+// Opens the action recording and/or starts a replay through this action source, if configured.
+// Note: relative paths are resolved against the project directory
+//
+void FAsynchronousActionWorker::InitRecordReplay() {
+    // Note: only the first render session of a process records or replays (they'd share the files otherwise)
+    //
+    if (0 != SessionSlot) {
+        return;
+    }
+    const FString & RecordPath = FInternalSettings::GetActionRecordPath();
+    if (! RecordPath.IsEmpty()) {
+        const FString & FullRecordPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), RecordPath);
+        Recorder = MakeUnique<FActionRecordWriter>();
+        if (! Recorder->Open(FullRecordPath)) {
+            UE_LOG(LogTemp, Error, ErrorRecordingFailedFormatted, *FullRecordPath);
+            Recorder.Reset();
+        }
+    }
+    const FString & ReplayPath = FInternalSettings::GetActionReplayPath();
+    if (! ReplayPath.IsEmpty()) {
+        const FString & FullReplayPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), ReplayPath);
+        Replayer = MakeUnique<FActionReplayer>();
+        if (! Replayer->Load(FullReplayPath)) {
+            UE_LOG(LogTemp, Error, ErrorReplayFailedFormatted, *FullReplayPath);
+            Replayer.Reset();
+            return;
+        }
+        CompletedCount = 0;
+        LastCompletedSeconds = FPlatformTime::Seconds();
+        Replayer->Start(FInternalSettings::GetActionReplaySpeed(), [this](const FActionRecord & Record) {
+            return InjectMessage(Record.Channel, Record.Body, Record.SentTimestampMs);
+        });
+    }
+}
+
+// Reports a replay once every injected action completed (dispatched or dropped), or once completions stalled.
+// Only replayed actions count towards the drain (live traffic that arrives meanwhile doesn't).
+// Optionally ends the application afterwards (for unattended regression runs)
+//
+void FAsynchronousActionWorker::CheckReplayDrained() {
+    if ((nullptr == Replayer) || (! Replayer->IsFinished())) {
+        return;
+    }
+    const int32 InjectedCount = Replayer->GetInjectedCount();
+    const double IdleSeconds = FPlatformTime::Seconds() - FMath::Max(LastCompletedSeconds, Replayer->GetFinishedSeconds());
+    const bool Drained = CompletedCount >= static_cast<uint64>(InjectedCount);
+    if ((! Drained) && (IdleSeconds < ReplayDrainIdleSeconds)) {
+        return;
+    }
+    if (! Drained) {
+        UE_LOG(LogTemp, Warning, InfoReplayDrainTimedOutFormatted, GetSourceName(), CompletedCount, InjectedCount);
+    }
+    Replayer->LogReport(GetSourceName(), CompletedCount, Drained ? LastCompletedSeconds : FPlatformTime::Seconds());
+    IngestStats.Log(GetSourceName());
+    Scheduler->LogStats(GetSourceName());
+    Replayer.Reset();
+    if (FInternalSettings::GetActionReplayExitWhenDone()) {
+        FFunctionGraphTask::CreateAndDispatchWhenReady(
+                []() {
+                    RequestEngineExit(ReplayExitReason);
+                },
+                TStatId(), nullptr, ENamedThreads::GameThread);
+    }
+}
+
+void FAsynchronousActionWorker::CountCompletion(const FActionMessage & Message) {
+    if (! Message.Replayed) {
+        return;
+    }
+    CompletedCount++;
+    LastCompletedSeconds = FPlatformTime::Seconds();
+}
+
+// Receives up to MaxMessages (FIFO-based) queued messages of a channel, acknowledges them and hands them to the
+// scheduler. Returns the number of received messages
+//
+int32 FAsynchronousActionWorker::ReceiveQueuedMessages(const EActionChannel Channel, const int32 MaxMessages) {
+    int32 ReceivedCount = 0;
+    TArray<FScheduledAction> DroppedActions;
+    while ((ReceivedCount < MaxMessages) && (! FGlobalState::IsAborting())) {
+        FActionMessage NewMessage;
+        const auto Result = ReceiveMessage(Channel, NewMessage);
+        if (EActionReceiveResult::RECEIVED != Result) {
+            if (EActionReceiveResult::EMPTY == Result) {
+                UE_LOG(LogTemp, Verbose, InfoNoMessageReceived, GetSourceName());
+            }
+            break;
+        }
+        UE_LOG(LogTemp, Log, InfoMessageReceivedFormatted, GetSourceName(), *NewMessage.Body);
+        // The scheduler owns the action from here on (including actions that it drops).
+        // Consider adding additional handling in case a message fails to remove from its queue
+        //
+        AcknowledgeMessage(Channel, NewMessage);
+        if ((nullptr != Recorder) && (! NewMessage.Replayed)) {
+            Recorder->Append(Channel, NewMessage);
+        }
+        Scheduler->Enqueue(Channel, NewMessage, DroppedActions);
+        ReceivedCount++;
+    }
+    CompleteDroppedActions(DroppedActions);
+    return ReceivedCount;
+}
+
+void FAsynchronousActionWorker::CompleteDroppedActions(const TArray<FScheduledAction> & DroppedActions) {
+    for (const auto & DroppedAction: DroppedActions) {
+        OnMessageCompleted(DroppedAction.Channel, DroppedAction.Message, false);
+        CountCompletion(DroppedAction.Message);
+    }
+}
+
+// Dispatches every pending action, highest priority first.
+// Note: background images are taken as soon as they arrive (even while a sentence plays); the session stages them
+// and applies each one when the sentence that follows it starts
+//
+void FAsynchronousActionWorker::DispatchScheduledActions() {
+    const auto IsEligible = [](const FScheduledAction &) {
+        return true;
+    };
+    FScheduledAction NextAction;
+    while ((! FGlobalState::IsAborting()) && HoldsSession() && Scheduler->Dequeue(NextAction, IsEligible)) {
+        ProcessMessage(NextAction.Message);
+        OnMessageCompleted(NextAction.Channel, NextAction.Message, true);
+        CountCompletion(NextAction.Message);
+    }
+}
+
+// High-level method to decode a raw incoming generic action request (which was parsed from a source message) and
+// then forward its decoded action to a handler that will invoke the logic for that requested action
+//
+void FAsynchronousActionWorker::ProcessMessage(const FActionMessage & Message) {
+    const double DispatchStartSeconds = FPlatformTime::Seconds();
+    const auto & Action = ASLMetaHumanAction(Message.Body);
+    ActionHandlerDelegate.ExecuteIfBound(Action);
+    IngestStats.Record(Message, DispatchStartSeconds, FPlatformTime::Seconds());
+    if (0 == IngestStats.GetMessageCount() % IngestStatsLogInterval) {
+        IngestStats.Log(GetSourceName());
+        Scheduler->LogStats(GetSourceName());
+    }
+}
+
+// Sentences are long-running translation actions; everything else is handled on demand (mirrors how the
+// cloud producers fan out to the translation and the other activities queues)
+//
+EActionChannel FAsynchronousActionWorker::GetDefaultChannel(const FString & MessageBody) {
+    const auto & Action = ASLMetaHumanAction(MessageBody);
+    return EASLMetaHumanActionType::ANIMATE_SENTENCE == Action.GetActionType() ? EActionChannel::TRANSLATION
+                                                                               : EActionChannel::IMMEDIATE;
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents an Action Source Background Worker (separate thread) that will accept requests for processing.
+// Derived workers only provide transport (receive, acknowledge, clear) for two channels; prioritization (see
+// FActionScheduler) and gating of received messages is shared here so that every action source behaves the same.
+//
+
+#include <ModelingTaskTypes.h>
+
+#include "ASLMetaHumanAction.h"
+
+namespace ASLMetaHuman::Core {
+
+class FActionRecordWriter;
+class FActionReplayer;
+class FActionScheduler;
+class FSessionRegistry;
+struct FScheduledAction;
+
+// Channels that an action source delivers on. Immediate actions are always handled first; translation actions are
+// considered long-running and are only accepted once the current sentence has finished
+//
+enum class EActionChannel : uint8 {
+    IMMEDIATE,
+    TRANSLATION
+};
+
+// Outcome of one attempt to receive a message from a channel
+//
+enum class EActionReceiveResult : uint8 {
+    RECEIVED,
+    EMPTY,
+    FAILED
+};
+
+// One raw message as delivered by an action source
+//
+struct FActionMessage {
+    // Raw (JSON) message body that decodes into an ASLMetaHumanAction
+    //
+    FString Body;
+
+    // Source-specific token that is needed to acknowledge (remove) the message
+    //
+    FString ReceiptHandle;
+
+    // Time (FPlatformTime::Seconds()) when the source started to request the message and when it was received.
+    // Buffered sources: when the message arrived on the transport and when the worker took it from the buffer
+    //
+    double RequestedSeconds {0.0};
+    double ReceivedSeconds {0.0};
+
+    // Producer-side send time (UTC, milliseconds since the Unix epoch) if the transport provides it; 0 otherwise
+    //
+    int64 SentTimestampMs {0};
+
+    // True if the action replayer injected the message (replays are neither recorded again nor mixed with live
+    // traffic in the drain report)
+    //
+    bool Replayed {false};
+};
+
+// Tracks ingest latency for one action source. Transport: time spent obtaining a message (i.e. poll round trip).
+// Queue: time from receipt until dispatch starts (includes gating). Dispatch: time spent in the action handler.
+// EndToEnd: producer send time until dispatch starts (only when the transport provides a send timestamp).
+//
+class FActionIngestStats {
+public:
+    void Record(const FActionMessage & Message, const double DispatchStartSeconds, const double DispatchEndSeconds);
+    void Log(const FString & SourceName) const;
+    uint64 GetMessageCount() const;
+
+private:
+    struct FLatency {
+        uint64 Samples {0};
+        double TotalSeconds {0.0};
+        double MaxSeconds {0.0};
+        void Add(const double Seconds);
+        double GetAverageMs() const;
+    };
+    FLatency Transport;
+    FLatency Queue;
+    FLatency Dispatch;
+    FLatency EndToEnd;
+    uint64 MessageCount {0};
+    mutable FCriticalSection MutexStats;
+};
+
+class FAsynchronousActionWorker {
+public:
+    explicit FAsynchronousActionWorker(const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate);
+    virtual ~FAsynchronousActionWorker();
+
+    // Creates the action source worker that matches SourceName (SQS, MQTT, Socket, File); nullptr if it is unknown
+    //
+    static TUniquePtr<FAsynchronousActionWorker> Create(const FString & SourceName,
+            const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate);
+
+    void DoWork();
+
+    const FActionIngestStats & GetIngestStats() const {
+        return IngestStats;
+    }
+
+    // Render session (0-based) that this worker feeds and the sessions that it may claim (multi-session processes).
+    // Without candidates, the worker claims from SessionIds
+    //
+    void SetSessionSlot(const int32 Slot, const TArray<FString> & Candidates) {
+        SessionSlot = Slot;
+        SessionCandidates = Candidates;
+    }
+
+    // Startup gate: the source is opened (session claimed, queues resolved) right away, but actions are only taken from
+    // it once dispatch is enabled (i.e. once the session's avatar and the alphabet are ready)
+    //
+    void SetDispatchEnabled(const bool State) {
+        DispatchEnabled = State;
+    }
+
+    bool IsReadyForNextTranslationMessage() const {
+        FScopeLock ScopeLock(&MutexReadyForNextTranslationMessage);
+        return ReadyForNextMessage;
+    }
+
+    void SetReadyForNextTranslateMessage(const bool State) {
+        FScopeLock ScopeLock(&MutexReadyForNextTranslationMessage);
+        ReadyForNextMessage = State;
+    }
+
+protected:
+    // Transport-specific operations implemented by each action source
+    //
+    virtual const TCHAR * GetSourceName() const = 0;
+    virtual bool InitSource() = 0;
+    virtual void ShutdownSource() {
+    }
+    virtual void WaitForMessages() = 0;
+    virtual EActionReceiveResult ReceiveMessage(const EActionChannel Channel, FActionMessage & Message) = 0;
+    virtual bool AcknowledgeMessage(const EActionChannel Channel, const FActionMessage & Message) = 0;
+    virtual bool ClearChannel(const EActionChannel Channel) = 0;
+    // Invoked once an acknowledged message was either dispatched to the action handler or dropped by the scheduler
+    // (superseded or preempted), e.g. to confirm completion to the producer
+    //
+    virtual void OnMessageCompleted(const EActionChannel Channel, const FActionMessage & Message, const bool Dispatched) {
+    }
+    // Feeds a recorded message back through this action source's own transport (used for replays; may be invoked from
+    // any thread). The message must be received with FActionMessage::Replayed set. Returns false if the message
+    // couldn't be injected or the source doesn't support replays
+    //
+    virtual bool InjectMessage(const EActionChannel Channel, const FString & MessageBody, const int64 SentTimestampMs) {
+        return false;
+    }
+
+    // Routes a raw message body to the channel that the cloud producers would have used
+    //
+    static EActionChannel GetDefaultChannel(const FString & MessageBody);
+
+    // Claimed session in multi-instance mode ("" when this instance consumes every action)
+    //
+    const FString & GetSessionId() const;
+    int32 GetSessionSlot() const {
+        return SessionSlot;
+    }
+    // Replaces the "{Session}" placeholder of a queue name, topic or client id with the claimed session
+    //
+    FString ExpandSessionName(const FString & Name) const;
+
+private:
+    bool InitSession();
+    bool HoldsSession() const;
+    void InitRecordReplay();
+    void CheckReplayDrained();
+    void CountCompletion(const FActionMessage & Message);
+    int32 ReceiveQueuedMessages(const EActionChannel Channel, const int32 MaxMessages);
+    void CompleteDroppedActions(const TArray<FScheduledAction> & DroppedActions);
+    void DispatchScheduledActions();
+    void ProcessMessage(const FActionMessage & Message);
+
+    TDelegate<void(const ASLMetaHumanAction &)> ActionHandlerDelegate;
+    FActionIngestStats IngestStats;
+    TUniquePtr<FActionScheduler> Scheduler;
+    TUniquePtr<FSessionRegistry> SessionRegistry;
+    TArray<FString> SessionCandidates;
+    int32 SessionSlot {0};
+    FThreadSafeBool DispatchEnabled = true;
+
+    // Record/replay harness (both optional; see ActionRecordPath and ActionReplayPath in ASLMetaHuman.ini)
+    //
+    TUniquePtr<FActionRecordWriter> Recorder;
+    TUniquePtr<FActionReplayer> Replayer;
+    uint64 CompletedCount {0};
+    double LastCompletedSeconds {0.0};
+
+    // Tracks message retrieval readiness (per render session)
+    //
+    bool ReadyForNextMessage = true;
+    mutable FCriticalSection MutexReadyForNextTranslationMessage;
+};
+
+// Hosts one action source worker on the background thread pool (FAsyncTask needs one concrete task type)
+//
+class FAsynchronousActionWorkerTask: public UE::Geometry::FAbortableBackgroundTask {
+public:
+    explicit FAsynchronousActionWorkerTask(TUniquePtr<FAsynchronousActionWorker> && ExternalWorker):
+        Worker(MoveTemp(ExternalWorker)) {
+    }
+
+    void DoWork() {
+        if (nullptr != Worker) {
+            Worker->DoWork();
+        }
+    }
+
+    FORCEINLINE TStatId GetStatId() const {
+        RETURN_QUICK_DECLARE_CYCLE_STAT(FAsynchronousActionWorkerTask, STATGROUP_ThreadPoolAsyncTasks);
+    }
+
+private:
+    TUniquePtr<FAsynchronousActionWorker> Worker;
+};
+}
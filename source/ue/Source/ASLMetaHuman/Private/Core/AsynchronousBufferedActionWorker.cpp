@@ -0,0 +1,147 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents an in-process buffered action source. Producers (socket readers, file readers, ...) push raw messages
+// from any thread; the worker thread is woken immediately instead of polling a remote queue.
+//
+
+#include "AsynchronousBufferedActionWorker.h"
+#include "Config/InternalSettings.h"
+
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::EActionChannel;
+using ASLMetaHuman::Core::EActionReceiveResult;
+using ASLMetaHuman::Core::FActionMessage;
+using ASLMetaHuman::Core::FAsynchronousBufferedActionWorker;
+
+namespace {
+// Time that a received (but unacknowledged) message stays invisible - similar to a SQS visibility timeout
+//
+constexpr double VisibilityTimeoutSeconds = 1.0;
+}
+
+FAsynchronousBufferedActionWorker::FAsynchronousBufferedActionWorker(
+        const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate):
+            FAsynchronousActionWorker {ExternalActionHandlerDelegate},
+            MessageAvailableEvent {FPlatformProcess::GetSynchEventFromPool(false)} {
+}
+
+FAsynchronousBufferedActionWorker::~FAsynchronousBufferedActionWorker() {
+    FPlatformProcess::ReturnSynchEventToPool(MessageAvailableEvent);
+    MessageAvailableEvent = nullptr;
+}
+
+void FAsynchronousBufferedActionWorker::PushMessage(const FString & MessageBody,
+        const double ArrivedSeconds,
+        const int64 SentTimestampMs) {
+    PushMessage(GetDefaultChannel(MessageBody), MessageBody, ArrivedSeconds, SentTimestampMs);
+}
+
+// Note: the transport latency of a buffered message spans from its arrival until the worker takes it from the buffer
+// (i.e. includes waking up the worker); ReceivedSeconds is stamped in ReceiveMessage()
+//
+void FAsynchronousBufferedActionWorker::PushMessage(const EActionChannel Channel,
+        const FString & MessageBody,
+        const double ArrivedSeconds,
+        const int64 SentTimestampMs) {
+    FActionMessage Message;
+    Message.Body = MessageBody;
+    Message.SentTimestampMs = SentTimestampMs;
+    Message.RequestedSeconds = ArrivedSeconds;
+    BufferMessage(Channel, MoveTemp(Message));
+}
+
+void FAsynchronousBufferedActionWorker::BufferMessage(const EActionChannel Channel, FActionMessage && Message) {
+    FBufferedMessage NewMessage;
+    NewMessage.ActionType = ASLMetaHumanAction(Message.Body).GetActionType();
+    NewMessage.Message = MoveTemp(Message);
+    {
+        FScopeLock ScopeLock(&MutexBuffers);
+        NewMessage.Id = NextMessageId++;
+        NewMessage.Message.ReceiptHandle = FString::Printf(TEXT("%llu"), NewMessage.Id);
+        GetChannelBuffer(Channel).Add(MoveTemp(NewMessage));
+    }
+    MessageAvailableEvent->Trigger();
+}
+
+// Wakes up as soon as a message is pushed; otherwise periodically re-checks translation readiness
+//
+void FAsynchronousBufferedActionWorker::WaitForMessages() {
+    MessageAvailableEvent->Wait(FTimespan::FromSeconds(FInternalSettings::GetAnimationSpinlockSeconds()));
+}
+
+// Provides the oldest visible message of a channel (the message stays buffered until it is acknowledged)
+//
+EActionReceiveResult FAsynchronousBufferedActionWorker::ReceiveMessage(const EActionChannel Channel,
+        FActionMessage & Message) {
+    const double NowSeconds = FPlatformTime::Seconds();
+    FScopeLock ScopeLock(&MutexBuffers);
+    TSet<EASLMetaHumanActionType> BlockedActionTypes;
+    for (auto & BufferedMessage: GetChannelBuffer(Channel)) {
+        if (BlockedActionTypes.Contains(BufferedMessage.ActionType)) {
+            continue;
+        }
+        if (BufferedMessage.VisibleAfterSeconds > NowSeconds) {
+            BlockedActionTypes.Add(BufferedMessage.ActionType);
+            continue;
+        }
+        BufferedMessage.VisibleAfterSeconds = NowSeconds + VisibilityTimeoutSeconds;
+        Message = BufferedMessage.Message;
+        Message.ReceivedSeconds = NowSeconds;
+        return EActionReceiveResult::RECEIVED;
+    }
+    return EActionReceiveResult::EMPTY;
+}
+
+bool FAsynchronousBufferedActionWorker::AcknowledgeMessage(const EActionChannel Channel,
+        const FActionMessage & Message) {
+    FScopeLock ScopeLock(&MutexBuffers);
+    return GetChannelBuffer(Channel).RemoveAll([&Message](const FBufferedMessage & BufferedMessage) {
+        return BufferedMessage.Message.ReceiptHandle == Message.ReceiptHandle;
+    }) > 0;
+}
+
+bool FAsynchronousBufferedActionWorker::ClearChannel(const EActionChannel Channel) {
+    FScopeLock ScopeLock(&MutexBuffers);
+    GetChannelBuffer(Channel).Reset();
+    return true;
+}
+
+// Replayed messages take the same path as messages from the live producers
+//
+bool FAsynchronousBufferedActionWorker::InjectMessage(const EActionChannel Channel,
+        const FString & MessageBody,
+        const int64 SentTimestampMs) {
+    FActionMessage Message;
+    Message.Body = MessageBody;
+    Message.SentTimestampMs = SentTimestampMs;
+    Message.RequestedSeconds = FPlatformTime::Seconds();
+    Message.Replayed = true;
+    BufferMessage(Channel, MoveTemp(Message));
+    return true;
+}
+
+bool FAsynchronousBufferedActionWorker::IsEmpty() const {
+    FScopeLock ScopeLock(&MutexBuffers);
+    return ImmediateBuffer.IsEmpty() && TranslationBuffer.IsEmpty();
+}
+
+TArray<FAsynchronousBufferedActionWorker::FBufferedMessage> & FAsynchronousBufferedActionWorker::GetChannelBuffer(
+        const EActionChannel Channel) {
+    return EActionChannel::IMMEDIATE == Channel ? ImmediateBuffer : TranslationBuffer;
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents an in-process buffered action source. Producers (socket readers, file readers, ...) push raw messages
+// from any thread; the worker thread is woken immediately instead of polling a remote queue.
+//
+
+#include "AsynchronousActionWorker.h"
+
+namespace ASLMetaHuman::Core {
+
+class FAsynchronousBufferedActionWorker: public FAsynchronousActionWorker {
+public:
+    explicit FAsynchronousBufferedActionWorker(
+            const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate);
+    virtual ~FAsynchronousBufferedActionWorker() override;
+
+    // Thread-safe: buffers a raw message on the channel that matches its action type. ArrivedSeconds
+    // (FPlatformTime::Seconds()) is when the producer's bytes were read off the transport
+    //
+    void PushMessage(const FString & MessageBody, const double ArrivedSeconds, const int64 SentTimestampMs = 0);
+    void PushMessage(const EActionChannel Channel,
+            const FString & MessageBody,
+            const double ArrivedSeconds,
+            const int64 SentTimestampMs = 0);
+
+protected:
+    virtual void WaitForMessages() override;
+    virtual EActionReceiveResult ReceiveMessage(const EActionChannel Channel, FActionMessage & Message) override;
+    virtual bool AcknowledgeMessage(const EActionChannel Channel, const FActionMessage & Message) override;
+    virtual bool ClearChannel(const EActionChannel Channel) override;
+    virtual bool InjectMessage(const EActionChannel Channel,
+            const FString & MessageBody,
+            const int64 SentTimestampMs) override;
+
+    // Returns true if nothing is buffered on any channel
+    //
+    bool IsEmpty() const;
+
+private:
+    // Mirrors SQS FIFO semantics: a received but unacknowledged message becomes invisible for a while, and later
+    // messages of the same action type (a message group in the cloud producers) wait behind it
+    //
+    struct FBufferedMessage {
+        FActionMessage Message;
+        EASLMetaHumanActionType ActionType {EASLMetaHumanActionType::NONE};
+        uint64 Id {0};
+        double VisibleAfterSeconds {0.0};
+    };
+    TArray<FBufferedMessage> & GetChannelBuffer(const EActionChannel Channel);
+    void BufferMessage(const EActionChannel Channel, FActionMessage && Message);
+
+    TArray<FBufferedMessage> ImmediateBuffer;
+    TArray<FBufferedMessage> TranslationBuffer;
+    uint64 NextMessageId {1};
+    mutable FCriticalSection MutexBuffers;
+    FEvent * MessageAvailableEvent {nullptr};
+};
+}
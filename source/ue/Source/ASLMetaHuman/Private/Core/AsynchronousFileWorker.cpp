@@ -0,0 +1,175 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents a file (or stdin) action source: reads newline-delimited JSON actions (the same payloads that are
+// published to SQS). Empty lines and lines starting with '#' are ignored. ActionFilePath = "-" reads stdin.
+//
+
+#include "AsynchronousFileWorker.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+
+#include <Async/Async.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+
+#include <iostream>
+#include <string>
+
+#if PLATFORM_WINDOWS
+#include <Windows/WindowsHWrapper.h>
+#else
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FAsynchronousFileWorker;
+
+namespace {
+constexpr auto & FileActionSourceName = TEXT("File");
+const FString & StandardInputPath {"-"};
+const FString & CommentPrefix {"#"};
+// Time between checks for shutdown while waiting on stdin
+//
+constexpr double StandardInputWaitSeconds = 0.1;
+// Console status-related messages
+//
+constexpr auto & ErrorReadingFileFormatted = TEXT("Error: failed to read action file: %s");
+constexpr auto & InfoFileLoadedFormatted = TEXT("Loaded %d actions from %s");
+
+// Waits up to TimeoutSeconds until a line can be read from stdin without blocking (also true at end of stream), so
+// that the reader thread keeps observing shutdown instead of blocking in a read
+//
+bool WaitForStandardInput(const double TimeoutSeconds) {
+    if (std::cin.rdbuf()->in_avail() > 0) {
+        return true;
+    }
+#if PLATFORM_WINDOWS
+    const HANDLE InputHandle = ::GetStdHandle(STD_INPUT_HANDLE);
+    switch (::GetFileType(InputHandle)) {
+    case FILE_TYPE_PIPE: {
+        // A broken pipe (the producer exited) is reported as end of stream by the read
+        //
+        DWORD AvailableBytes = 0;
+        if ((! ::PeekNamedPipe(InputHandle, nullptr, 0, nullptr, &AvailableBytes, nullptr)) || (AvailableBytes > 0)) {
+            return true;
+        }
+        break;
+    }
+    case FILE_TYPE_CHAR: {
+        // Console: only read once a line was completed (a read returns on Enter, not on other input events)
+        //
+        INPUT_RECORD InputEvents[128];
+        DWORD EventCount = 0;
+        if (::PeekConsoleInputW(InputHandle, InputEvents, UE_ARRAY_COUNT(InputEvents), &EventCount)) {
+            for (DWORD i = 0; i < EventCount; i++) {
+                const auto & KeyEvent = InputEvents[i].Event.KeyEvent;
+                if ((KEY_EVENT == InputEvents[i].EventType) && KeyEvent.bKeyDown
+                        && (L'\r' == KeyEvent.uChar.UnicodeChar)) {
+                    return true;
+                }
+            }
+        }
+        break;
+    }
+    default:
+        return true;
+    }
+    FPlatformProcess::Sleep(static_cast<float>(TimeoutSeconds));
+    return false;
+#else
+    pollfd InputDescriptor {STDIN_FILENO, POLLIN, 0};
+    return 0 != ::poll(&InputDescriptor, 1, static_cast<int>(TimeoutSeconds * 1000.0));
+#endif
+}
+}
+
+FAsynchronousFileWorker::FAsynchronousFileWorker(
+        const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate):
+            FAsynchronousBufferedActionWorker {ExternalActionHandlerDelegate} {
+}
+
+FAsynchronousFileWorker::~FAsynchronousFileWorker() {
+    ShutdownSource();
+}
+
+const TCHAR * FAsynchronousFileWorker::GetSourceName() const {
+    return FileActionSourceName;
+}
+
+// Buffers all actions of the configured file up front; stdin is read line by line on a dedicated thread.
+// Note: only the first render session of a process reads the file (the others stay idle)
+//
+bool FAsynchronousFileWorker::InitSource() {
+    if (0 != GetSessionSlot()) {
+        return true;
+    }
+    const FString & FilePath = FInternalSettings::GetActionFilePath();
+    if (StandardInputPath == FilePath) {
+        StandardInputFuture = Async(EAsyncExecution::Thread, [this]() {
+            ReadStandardInput();
+        });
+        return true;
+    }
+    const FString & FullPath = FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectDir(), FilePath) : FilePath;
+    TArray<FString> Lines;
+    if (! FFileHelper::LoadFileToStringArray(Lines, *FullPath)) {
+        UE_LOG(LogTemp, Error, ErrorReadingFileFormatted, *FullPath);
+        return false;
+    }
+    const double LoadedSeconds = FPlatformTime::Seconds();
+    for (const auto & Line: Lines) {
+        PushLine(Line, LoadedSeconds);
+    }
+    UE_LOG(LogTemp, Log, InfoFileLoadedFormatted, Lines.Num(), *FullPath);
+    return true;
+}
+
+// Joins the stdin reader; it only reads once a line is available, so it observes the stop request within
+// StandardInputWaitSeconds
+//
+void FAsynchronousFileWorker::ShutdownSource() {
+    StandardInputStopping = true;
+    if (StandardInputFuture.IsValid()) {
+        StandardInputFuture.Wait();
+    }
+    StandardInputFuture.Reset();
+}
+
+void FAsynchronousFileWorker::ReadStandardInput() {
+    std::string Line;
+    while ((! StandardInputStopping) && (! FGlobalState::IsAborting())) {
+        if (! WaitForStandardInput(StandardInputWaitSeconds)) {
+            continue;
+        }
+        if (! std::getline(std::cin, Line)) {
+            break;
+        }
+        PushLine(FString(UTF8_TO_TCHAR(Line.c_str())), FPlatformTime::Seconds());
+    }
+}
+
+void FAsynchronousFileWorker::PushLine(const FString & Line, const double ArrivedSeconds) {
+    const FString & TrimmedLine = Line.TrimStartAndEnd();
+    if (TrimmedLine.IsEmpty() || TrimmedLine.StartsWith(CommentPrefix)) {
+        return;
+    }
+    PushMessage(TrimmedLine, ArrivedSeconds);
+}
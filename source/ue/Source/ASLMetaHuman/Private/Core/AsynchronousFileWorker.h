@@ -0,0 +1,45 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents a file (or stdin) action source: reads newline-delimited JSON actions (the same payloads that are
+// published to SQS) and feeds them through the regular prioritization and gating. Useful without AWS access.
+//
+
+#include "AsynchronousBufferedActionWorker.h"
+
+namespace ASLMetaHuman::Core {
+
+class FAsynchronousFileWorker: public FAsynchronousBufferedActionWorker {
+public:
+    explicit FAsynchronousFileWorker(const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate);
+    virtual ~FAsynchronousFileWorker() override;
+
+protected:
+    virtual const TCHAR * GetSourceName() const override;
+    virtual bool InitSource() override;
+    virtual void ShutdownSource() override;
+
+private:
+    void PushLine(const FString & Line, const double ArrivedSeconds);
+    void ReadStandardInput();
+
+    TFuture<void> StandardInputFuture;
+    FThreadSafeBool StandardInputStopping {false};
+};
+}
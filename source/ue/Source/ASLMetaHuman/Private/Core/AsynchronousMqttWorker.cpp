@@ -0,0 +1,311 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents a MQTT action source: producers publish actions to topics and the broker pushes them to the renderer.
+//
+// Example (local broker stand-in, e.g. mosquitto on localhost:1883 with ActionSource = "MQTT"):
+//   mosquitto_pub -q 1 -t asl/actions/translation -m '{"Action":"ANIMATE_SENTENCE", ...}'
+//   mosquitto_sub -q 1 -t asl/actions/ack
+//
+// Note: the CRT client sends the protocol-level PUBACK when a QoS 1 message arrives. Completion of the action (after
+// dispatch to the action handler, or when the scheduler drops a superseded action) is confirmed with a QoS 1 publish
+// to MqttAckTopic.
+//
+
+#include "AsynchronousMqttWorker.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <aws/common/error.h>
+#include <aws/core/Globals.h>
+#include <aws/crt/io/SocketOptions.h>
+#include <Misc/SecureHash.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::EActionChannel;
+using ASLMetaHuman::Core::FActionMessage;
+using ASLMetaHuman::Core::FAsynchronousMqttWorker;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+constexpr auto & MqttActionSourceName = TEXT("MQTT");
+// For resiliency parameters
+//
+constexpr uint32_t ConnectTimeoutMs = 3 * 1000;
+constexpr uint16_t KeepAliveSeconds = 30;
+constexpr uint32_t ProtocolOperationTimeoutMs = 5 * 1000;
+constexpr double DisconnectTimeoutSeconds = 2.0;
+// Time between checks for shutdown while backing off
+//
+constexpr float BackoffWaitSeconds = 0.1f;
+// Number of recent payloads that are remembered to drop redeliveries
+//
+constexpr int32 RecentPayloadHashCount = 32;
+// Console status-related messages
+//
+constexpr auto & ErrorConnectFormatted = TEXT("Error: MQTT connection to %s:%d failed: %s");
+constexpr auto & ErrorPublishAckFormatted = TEXT("Error: MQTT ack publish failed: %s");
+constexpr auto & ErrorSubscribeFormatted = TEXT("Error: MQTT subscribe to %s failed");
+constexpr auto & ErrorTlsContext = TEXT("Error: MQTT TLS context could not be created");
+constexpr auto & InfoConnectedFormatted = TEXT("MQTT connected to %s:%d (session present: %d)");
+constexpr auto & InfoConnectionResumedFormatted = TEXT("MQTT connection resumed (session present: %d)");
+constexpr auto & InfoDuplicateDropped = TEXT("MQTT redelivered message dropped");
+constexpr auto & InfoRetryConnectFormatted = TEXT("MQTT connect retry in %.1f s");
+constexpr auto & InfoSubscribedFormatted = TEXT("MQTT subscribed to %s");
+constexpr auto & WarningConnectionInterruptedFormatted = TEXT("MQTT connection interrupted: %s (reconnecting)");
+constexpr auto & AckPayloadFormatted = TEXT("{\"status\":\"%s\",\"channel\":\"%s\",\"md5\":\"%s\",\"timestamp_ms\":%lld}");
+}
+
+FAsynchronousMqttWorker::FAsynchronousMqttWorker(
+        const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate):
+            FAsynchronousBufferedActionWorker {ExternalActionHandlerDelegate},
+            ConnectionCompletedEvent {FPlatformProcess::GetSynchEventFromPool(false)},
+            DisconnectedEvent {FPlatformProcess::GetSynchEventFromPool(false)} {
+}
+
+FAsynchronousMqttWorker::~FAsynchronousMqttWorker() {
+    ShutdownSource();
+    FPlatformProcess::ReturnSynchEventToPool(ConnectionCompletedEvent);
+    FPlatformProcess::ReturnSynchEventToPool(DisconnectedEvent);
+    ConnectionCompletedEvent = nullptr;
+    DisconnectedEvent = nullptr;
+}
+
+const TCHAR * FAsynchronousMqttWorker::GetSourceName() const {
+    return MqttActionSourceName;
+}
+
+// Connects to the broker, backing off exponentially (MqttReconnectMinSeconds..MqttReconnectMaxSeconds) until the
+// first connection succeeds. Later connection losses are recovered by the CRT client with the same backoff.
+//
+bool FAsynchronousMqttWorker::InitSource() {
+    if (! InitConnection()) {
+        return false;
+    }
+    const double MaxBackoffSeconds = FMath::Max(1, FInternalSettings::GetMqttReconnectMaxSeconds());
+    double BackoffSeconds = FMath::Clamp<double>(FInternalSettings::GetMqttReconnectMinSeconds(), 1.0, MaxBackoffSeconds);
+    while (! FGlobalState::IsAborting()) {
+        if (Connect()) {
+            return true;
+        }
+        UE_LOG(LogTemp, Log, InfoRetryConnectFormatted, BackoffSeconds);
+        const double RetryAtSeconds = FPlatformTime::Seconds() + BackoffSeconds;
+        while ((! FGlobalState::IsAborting()) && (FPlatformTime::Seconds() < RetryAtSeconds)) {
+            FPlatformProcess::Sleep(BackoffWaitSeconds);
+        }
+        BackoffSeconds = FMath::Min(BackoffSeconds * 2.0, MaxBackoffSeconds);
+    }
+    return false;
+}
+
+// Disconnects gracefully so that the broker keeps the (persistent) session for the next run
+//
+void FAsynchronousMqttWorker::ShutdownSource() {
+    if (nullptr != MqttConnection) {
+        if (IsConnected && MqttConnection->Disconnect()) {
+            DisconnectedEvent->Wait(FTimespan::FromSeconds(DisconnectTimeoutSeconds));
+        }
+        IsConnected = false;
+        MqttConnection.reset();
+    }
+    MqttClient.Reset();
+    TlsContext.Reset();
+}
+
+// Creates the client and the (not yet connected) connection, including the connection callbacks
+//
+bool FAsynchronousMqttWorker::InitConnection() {
+    const auto Bootstrap = Aws::GetDefaultClientBootstrap();
+    if (nullptr == Bootstrap) {
+        return false;
+    }
+    MqttClient = MakeUnique<Aws::Crt::Mqtt::MqttClient>(*Bootstrap);
+    if (! *MqttClient) {
+        return false;
+    }
+    Aws::Crt::Io::SocketOptions SocketOptions;
+    SocketOptions.SetSocketType(Aws::Crt::Io::SocketType::Stream);
+    SocketOptions.SetConnectTimeoutMs(ConnectTimeoutMs);
+    const Aws::String & Endpoint = UnrealAPI::FStringToAwsString(FInternalSettings::GetMqttEndpoint());
+    const uint16_t Port = static_cast<uint16_t>(FInternalSettings::GetMqttPort());
+    if (FInternalSettings::GetMqttUseTls()) {
+        const FString & CertificatePath = FInternalSettings::GetMqttCertificatePath();
+        const FString & PrivateKeyPath = FInternalSettings::GetMqttPrivateKeyPath();
+        const FString & CaFilePath = FInternalSettings::GetMqttCaFilePath();
+        auto TlsOptions = (CertificatePath.IsEmpty() || PrivateKeyPath.IsEmpty())
+                ? Aws::Crt::Io::TlsContextOptions::InitDefaultClient()
+                : Aws::Crt::Io::TlsContextOptions::InitClientWithMtls(
+                        TCHAR_TO_UTF8(*FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), CertificatePath)),
+                        TCHAR_TO_UTF8(*FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), PrivateKeyPath)));
+        if (! CaFilePath.IsEmpty()) {
+            TlsOptions.OverrideDefaultTrustStore(
+                    nullptr, TCHAR_TO_UTF8(*FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), CaFilePath)));
+        }
+        TlsContext = MakeUnique<Aws::Crt::Io::TlsContext>(TlsOptions, Aws::Crt::Io::TlsMode::CLIENT);
+        if (! *TlsContext) {
+            UE_LOG(LogTemp, Error, ErrorTlsContext);
+            return false;
+        }
+        MqttConnection = MqttClient->NewConnection(Endpoint.c_str(), Port, SocketOptions, *TlsContext);
+    } else {
+        MqttConnection = MqttClient->NewConnection(Endpoint.c_str(), Port, SocketOptions);
+    }
+    if ((nullptr == MqttConnection) || (! *MqttConnection)) {
+        return false;
+    }
+    MqttConnection->SetReconnectTimeout(FMath::Max(1, FInternalSettings::GetMqttReconnectMinSeconds()),
+            FMath::Max(1, FInternalSettings::GetMqttReconnectMaxSeconds()));
+
+    // Note: CRT callbacks run on an event loop thread
+    //
+    MqttConnection->OnConnectionCompleted = [this](Aws::Crt::Mqtt::MqttConnection &, int ErrorCode,
+            Aws::Crt::Mqtt::ReturnCode ReturnCode, bool SessionPresent) {
+        IsConnected = (AWS_ERROR_SUCCESS == ErrorCode) && (AWS_MQTT_CONNECT_ACCEPTED == ReturnCode);
+        if (IsConnected) {
+            UE_LOG(LogTemp, Log, InfoConnectedFormatted, *FInternalSettings::GetMqttEndpoint(),
+                    FInternalSettings::GetMqttPort(), static_cast<int>(SessionPresent));
+            // Re-subscribing to a persistent session is harmless; it also covers a broker that lost the session
+            //
+            Subscribe(FInternalSettings::GetMqttImmediateTopic(), EActionChannel::IMMEDIATE);
+            Subscribe(FInternalSettings::GetMqttTranslationTopic(), EActionChannel::TRANSLATION);
+        } else {
+            UE_LOG(LogTemp, Error, ErrorConnectFormatted, *FInternalSettings::GetMqttEndpoint(),
+                    FInternalSettings::GetMqttPort(),
+                    UTF8_TO_TCHAR(aws_error_debug_str(ErrorCode ? ErrorCode : AWS_ERROR_MQTT_PROTOCOL_ERROR)));
+        }
+        ConnectionCompletedEvent->Trigger();
+    };
+    MqttConnection->OnConnectionInterrupted = [this](Aws::Crt::Mqtt::MqttConnection &, int ErrorCode) {
+        IsConnected = false;
+        UE_LOG(LogTemp, Warning, WarningConnectionInterruptedFormatted, UTF8_TO_TCHAR(aws_error_debug_str(ErrorCode)));
+    };
+    MqttConnection->OnConnectionResumed = [this](Aws::Crt::Mqtt::MqttConnection &, Aws::Crt::Mqtt::ReturnCode,
+            bool SessionPresent) {
+        IsConnected = true;
+        UE_LOG(LogTemp, Log, InfoConnectionResumedFormatted, static_cast<int>(SessionPresent));
+        if (! SessionPresent) {
+            Subscribe(FInternalSettings::GetMqttImmediateTopic(), EActionChannel::IMMEDIATE);
+            Subscribe(FInternalSettings::GetMqttTranslationTopic(), EActionChannel::TRANSLATION);
+        }
+    };
+    MqttConnection->OnDisconnect = [this](Aws::Crt::Mqtt::MqttConnection &) {
+        DisconnectedEvent->Trigger();
+    };
+    return true;
+}
+
+// Performs one connection attempt (persistent session) and waits for its outcome
+//
+bool FAsynchronousMqttWorker::Connect() {
+    const Aws::String & ClientId = UnrealAPI::FStringToAwsString(ExpandSessionName(FInternalSettings::GetMqttClientId()));
+    ConnectionCompletedEvent->Reset();
+    if (! MqttConnection->Connect(ClientId.c_str(), false, KeepAliveSeconds, 0, ProtocolOperationTimeoutMs)) {
+        UE_LOG(LogTemp, Error, ErrorConnectFormatted, *FInternalSettings::GetMqttEndpoint(),
+                FInternalSettings::GetMqttPort(), UTF8_TO_TCHAR(aws_error_debug_str(MqttConnection->LastError())));
+        return false;
+    }
+    // Note: the socket connect timeout bounds this wait; the margin covers the CONNACK
+    //
+    ConnectionCompletedEvent->Wait(FTimespan::FromMilliseconds(ConnectTimeoutMs + ProtocolOperationTimeoutMs));
+    return IsConnected;
+}
+
+// Subscribes (QoS 1) to a topic whose messages are delivered on the given channel
+//
+void FAsynchronousMqttWorker::Subscribe(const FString & TopicName, const EActionChannel Channel) {
+    const FString & Topic = ExpandSessionName(TopicName);
+    if (Topic.IsEmpty()) {
+        return;
+    }
+    const Aws::String & TopicFilter = UnrealAPI::FStringToAwsString(Topic);
+    const auto PacketId = MqttConnection->Subscribe(TopicFilter.c_str(), AWS_MQTT_QOS_AT_LEAST_ONCE,
+            [this, Channel](Aws::Crt::Mqtt::MqttConnection &, const Aws::Crt::String &, const Aws::Crt::ByteBuf & Payload,
+                    bool Duplicate, Aws::Crt::Mqtt::QOS, bool) {
+                OnMessageReceived(Channel, Payload, Duplicate);
+            },
+            [Topic](Aws::Crt::Mqtt::MqttConnection &, uint16_t, const Aws::Crt::String &, Aws::Crt::Mqtt::QOS QoS,
+                    int ErrorCode) {
+                if ((AWS_ERROR_SUCCESS != ErrorCode) || (AWS_MQTT_QOS_FAILURE == QoS)) {
+                    UE_LOG(LogTemp, Error, ErrorSubscribeFormatted, *Topic);
+                } else {
+                    UE_LOG(LogTemp, Log, InfoSubscribedFormatted, *Topic);
+                }
+            });
+    if (0 == PacketId) {
+        UE_LOG(LogTemp, Error, ErrorSubscribeFormatted, *Topic);
+    }
+}
+
+// Buffers a pushed message on its channel; redeliveries of recently seen payloads are dropped
+//
+void FAsynchronousMqttWorker::OnMessageReceived(const EActionChannel Channel,
+        const Aws::Crt::ByteBuf & Payload,
+        const bool Duplicate) {
+    const double ArrivedSeconds = FPlatformTime::Seconds();
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR *>(Payload.buffer), static_cast<int32>(Payload.len));
+    const FString Body = FString(Converted.Length(), Converted.Get()).TrimStartAndEnd();
+    if (Body.IsEmpty()) {
+        return;
+    }
+    const uint32 PayloadHash = GetTypeHash(Body);
+    {
+        FScopeLock ScopeLock(&MutexRecentPayloadHashes);
+        if (Duplicate && RecentPayloadHashes.Contains(PayloadHash)) {
+            UE_LOG(LogTemp, Log, InfoDuplicateDropped);
+            return;
+        }
+        if (RecentPayloadHashes.Num() >= RecentPayloadHashCount) {
+            RecentPayloadHashes.RemoveAt(0, 1, false);
+        }
+        RecentPayloadHashes.Add(PayloadHash);
+    }
+    PushMessage(Channel, Body, ArrivedSeconds);
+}
+
+// Confirms (QoS 1) that an action was dispatched (or dropped); producers can correlate by the MD5 of the payload
+// they published
+//
+void FAsynchronousMqttWorker::OnMessageCompleted(const EActionChannel Channel,
+        const FActionMessage & Message,
+        const bool Dispatched) {
+    const FString & AckTopic = ExpandSessionName(FInternalSettings::GetMqttAckTopic());
+    if (AckTopic.IsEmpty() || (nullptr == MqttConnection)) {
+        return;
+    }
+    const int64 NowMs = (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds();
+    const FString & Ack = FString::Printf(AckPayloadFormatted, Dispatched ? TEXT("DISPATCHED") : TEXT("DROPPED"),
+            EActionChannel::IMMEDIATE == Channel ? TEXT("IMMEDIATE") : TEXT("TRANSLATION"),
+            *FMD5::HashAnsiString(*Message.Body), NowMs);
+    const Aws::String & AckPayload = UnrealAPI::FStringToAwsString(Ack);
+    const Aws::String & Topic = UnrealAPI::FStringToAwsString(AckTopic);
+    // Note: the payload is copied by the client before Publish() returns
+    //
+    const auto PacketId = MqttConnection->Publish(Topic.c_str(), AWS_MQTT_QOS_AT_LEAST_ONCE, false,
+            Aws::Crt::ByteBufFromArray(reinterpret_cast<const uint8_t *>(AckPayload.data()), AckPayload.size()),
+            [](Aws::Crt::Mqtt::MqttConnection &, uint16_t, int ErrorCode) {
+                if (AWS_ERROR_SUCCESS != ErrorCode) {
+                    UE_LOG(LogTemp, Warning, ErrorPublishAckFormatted, UTF8_TO_TCHAR(aws_error_debug_str(ErrorCode)));
+                }
+            });
+    if (0 == PacketId) {
+        UE_LOG(LogTemp, Warning, ErrorPublishAckFormatted,
+                UTF8_TO_TCHAR(aws_error_debug_str(MqttConnection->LastError())));
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents a MQTT action source: producers publish actions to topics and the broker pushes them to the renderer
+// (no polling). Each subscribed topic maps onto one of the action channels (immediate / translation).
+//
+
+#include "AsynchronousBufferedActionWorker.h"
+
+#include <aws/crt/io/TlsOptions.h>
+#include <aws/crt/mqtt/MqttClient.h>
+
+namespace ASLMetaHuman::Core {
+
+class FAsynchronousMqttWorker: public FAsynchronousBufferedActionWorker {
+public:
+    explicit FAsynchronousMqttWorker(const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate);
+    virtual ~FAsynchronousMqttWorker() override;
+
+protected:
+    virtual const TCHAR * GetSourceName() const override;
+    virtual bool InitSource() override;
+    virtual void ShutdownSource() override;
+    virtual void OnMessageCompleted(const EActionChannel Channel,
+            const FActionMessage & Message,
+            const bool Dispatched) override;
+
+private:
+    bool InitConnection();
+    bool Connect();
+    void Subscribe(const FString & TopicName, const EActionChannel Channel);
+    void OnMessageReceived(const EActionChannel Channel, const Aws::Crt::ByteBuf & Payload, const bool Duplicate);
+
+    TUniquePtr<Aws::Crt::Mqtt::MqttClient> MqttClient;
+    TUniquePtr<Aws::Crt::Io::TlsContext> TlsContext;
+    std::shared_ptr<Aws::Crt::Mqtt::MqttConnection> MqttConnection;
+
+    // Signaled from the CRT event loop when a connection attempt completes and when a disconnect finishes
+    //
+    FEvent * ConnectionCompletedEvent {nullptr};
+    FEvent * DisconnectedEvent {nullptr};
+    FThreadSafeBool IsConnected {false};
+
+    // QoS 1 is "at least once": hashes of recent payloads allow dropping broker redeliveries (DUP flag)
+    //
+    TArray<uint32> RecentPayloadHashes;
+    FCriticalSection MutexRecentPayloadHashes;
+};
+}
@@ -24,43 +24,61 @@
 #include "Config/InternalSettings.h"
 #include "Utilities/UnrealAPI.h"
 
-#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/sqs/model/ChangeMessageVisibilityRequest.h>
 #include <aws/sqs/model/DeleteMessageRequest.h>
 #include <aws/sqs/model/GetQueueUrlRequest.h>
 #include <aws/sqs/model/PurgeQueueRequest.h>
 #include <aws/sqs/model/ReceiveMessageRequest.h>
+#include <aws/sqs/model/SendMessageRequest.h>
 
 using ASLMetaHuman::Config::FGlobalState;
 using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::EActionChannel;
+using ASLMetaHuman::Core::EActionReceiveResult;
+using ASLMetaHuman::Core::FActionMessage;
 using ASLMetaHuman::Core::FAsynchronousSqsWorker;
+using ASLMetaHuman::Core::FSqsCircuitBreaker;
+using ASLMetaHuman::Core::FSqsRetryStrategy;
 using ASLMetaHuman::Utilities::UnrealAPI;
 
 namespace {
 constexpr unsigned int MaxMessagesToReceive = 1;
-// For resiliency parameters
+// Longest single sleep while the circuit is open (keeps shutdown responsive)
 //
-constexpr float RequestTimeoutMs = 2 * 1000.0f;
-constexpr int RequestRetries = 1;
+constexpr float MaxCircuitWaitSeconds = 0.1f;
+// Longest single wait for a hedged receive to complete (keeps shutdown responsive)
+//
+constexpr uint32 MaxHedgeWaitMs = 100;
+// Message attribute that producers set to address one session (multi-instance mode)
+//
+constexpr auto & SessionIdAttributeName = "SessionId";
+// Message attribute that marks messages sent by the action replayer
+//
+constexpr auto & ReplayedAttributeName = "Replayed";
 // Console status-related messages
 //
 constexpr auto & ErrorDeletingFromQueueFormatted = TEXT("Error: failed to delete message from queue: %s ");
-constexpr auto & ErrorInitializationFailed = TEXT("Init Async SQS worker failed");
+constexpr auto & ErrorHedgedReceiveAbandoned = "Receive abandoned (shutdown or no response within the retry budget)";
 constexpr auto & ErrorQueueUrlFormatted = TEXT("Failed to get SQS Queue Url: %s");
 constexpr auto & ErrorPurgingQueueFormatted = TEXT("Error failed to purge queue: %s ");
+constexpr auto & ErrorReplayWithoutEndpointOverride = TEXT(
+        "Refusing to replay into SQS queues without SQSEndpointOverride (use a local stand-in)");
+constexpr auto & ErrorSendingMessageFormatted = TEXT("Error sending message to queue: %s ");
 constexpr auto & ErrorReceivingMessageFormatted = TEXT("Error receiving message from queue: %s ");
+constexpr auto & InfoCircuitOpenedFormatted = TEXT("SQS unreachable after %d consecutive failures: polling paused for %.1f s");
+constexpr auto & InfoCircuitProbeFailedFormatted = TEXT("SQS recovery probe failed: next probe in %.1f s");
+constexpr auto & InfoCircuitRecoveredFormatted = TEXT("SQS reachable again after %d consecutive failures");
 constexpr auto & InfoMessageDeleted = TEXT("Message deleted");
-constexpr auto & InfoMessageReceivedFormatted = TEXT("Message received from SQS Queue: %s");
-constexpr auto & InfoNoMessageReceived = TEXT("No messages received from queue");
 constexpr auto & InfoQueuePurged = TEXT("Queue purged");
 constexpr auto & InfoQueueUrlFormatted = TEXT("Queue Url: %s");
-const FString & ChangeBackgroundMessage {"CHANGE_BACKGROUND"};
+constexpr auto & SQSActionSourceName = TEXT("SQS");
 }
 
 // Note: maintains an ActionHandler callback for received actions
 //
 FAsynchronousSqsWorker::FAsynchronousSqsWorker(
         const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate):
-            ActionHandlerDelegate {ExternalActionHandlerDelegate} {
+            FAsynchronousActionWorker {ExternalActionHandlerDelegate} {
 }
 
 // Aids basic shutdown - triggered from ASLMetaHumanDemo::Shutdown() / Reset()
@@ -72,31 +90,26 @@ FAsynchronousSqsWorker::~FAsynchronousSqsWorker() {
     }
 }
 
-// Main entry point / busy-wait work loop for this background SQS Worker - triggered via StartBackgroundTask()
-// Retrieves queued action requests, prioritizes them.
+void FAsynchronousSqsWorker::ShutdownSource() {
+    ClientStats->Log(SQSActionSourceName);
+}
+
+const TCHAR * FAsynchronousSqsWorker::GetSourceName() const {
+    return SQSActionSourceName;
+}
+
+bool FAsynchronousSqsWorker::InitSource() {
+    return InitAwsClient();
+}
+
+// SQS is polled: wait between receive requests. During an outage (open circuit) wait until the next recovery probe
 //
-void FAsynchronousSqsWorker::DoWork() {
-    if (! InitAwsClient()) {
-        UE_LOG(LogTemp, Log, ErrorInitializationFailed);
-        return;
-    }
-    if (FInternalSettings::GetPurgeQueuesOnStartup()) {
-        if (! ClearQueue(ImmediateActionQueueUrl) && ClearQueue(TranslationActionQueueUrl)) {
-            return;
-        }
-    }
-    while (! FGlobalState::IsAborting()) {
-        FPlatformProcess::Sleep(FInternalSettings::GetSQSSpinlockSeconds());
-        if (! FGlobalState::IsAborting()) {
-            // Prioritize queued actions that require immediate processing
-            //
-            RequestNextQueuedMessage(ImmediateActionQueueUrl, true);
-            if (IsReadyForNextTranslationMessage()) {
-                // Each queued translations is considered long-running (shouldn't interrupt)
-                //           
-                RequestNextQueuedMessage(TranslationActionQueueUrl);
-            }
-        }
+void FAsynchronousSqsWorker::WaitForMessages() {
+    FPlatformProcess::Sleep(FInternalSettings::GetSQSSpinlockSeconds());
+    double RemainingSeconds = CircuitBreaker.GetRemainingOpenSeconds();
+    while ((RemainingSeconds > 0.0) && (! FGlobalState::IsAborting())) {
+        FPlatformProcess::Sleep(FMath::Min(static_cast<float>(RemainingSeconds), MaxCircuitWaitSeconds));
+        RemainingSeconds = CircuitBreaker.GetRemainingOpenSeconds();
     }
 }
 
@@ -108,18 +121,28 @@ bool FAsynchronousSqsWorker::InitAwsClient() {
 
     // Resiliency parameters
     //
-    std::shared_ptr<Aws::Client::RetryStrategy> RetryStrategy;
-    RetryStrategy.reset(new Aws::Client::DefaultRetryStrategy(RequestRetries, 0));
-    ClientConfig.retryStrategy = RetryStrategy;
-    ClientConfig.connectTimeoutMs = RequestTimeoutMs;
-    ClientConfig.httpRequestTimeoutMs = RequestTimeoutMs;
-    ClientConfig.requestTimeoutMs = RequestTimeoutMs;
-    ClientConfig.tcpKeepAliveIntervalMs = RequestTimeoutMs;
+    ClientConfig.retryStrategy = std::make_shared<FSqsRetryStrategy>(FInternalSettings::GetSQSMaxAttempts(),
+            FInternalSettings::GetSQSRetryBaseDelayMs(), FInternalSettings::GetSQSRetryMaxDelayMs(), ClientStats);
+    ClientConfig.connectTimeoutMs = FInternalSettings::GetSQSConnectTimeoutMs();
+    ClientConfig.httpRequestTimeoutMs = FInternalSettings::GetSQSRequestTimeoutMs();
+    ClientConfig.requestTimeoutMs = FInternalSettings::GetSQSRequestTimeoutMs();
+    ClientConfig.tcpKeepAliveIntervalMs = FInternalSettings::GetSQSKeepAliveIntervalMs();
+    CircuitBreaker.Configure(FInternalSettings::GetSQSCircuitFailureThreshold(),
+            FInternalSettings::GetSQSCircuitOpenSeconds(), FInternalSettings::GetSQSCircuitMaxOpenSeconds());
+    // e.g. a local SQS stand-in for replays and CI
+    //
+    const FString & EndpointOverride = FInternalSettings::GetSQSEndpointOverride();
+    if (! EndpointOverride.IsEmpty()) {
+        ClientConfig.endpointOverride = UnrealAPI::FStringToAwsString(EndpointOverride);
+    }
 
     AwsSQSClient = MakeUnique<Aws::SQS::SQSClient>(ClientConfig);
 
-    return GetQueueUrl(UnrealAPI::FStringToAwsString(FInternalSettings::GetSQSActionQueueName()), ImmediateActionQueueUrl)
-            && GetQueueUrl(UnrealAPI::FStringToAwsString(FInternalSettings::GetSQSTranslationQueueName()),
+    // Note: queue names may be per session (e.g. a "{Session}" suffix on queues subscribed with an SNS filter policy)
+    //
+    return GetQueueUrl(UnrealAPI::FStringToAwsString(ExpandSessionName(FInternalSettings::GetSQSActionQueueName())),
+                   ImmediateActionQueueUrl)
+            && GetQueueUrl(UnrealAPI::FStringToAwsString(ExpandSessionName(FInternalSettings::GetSQSTranslationQueueName())),
                     TranslationActionQueueUrl);
 }
 
@@ -143,92 +166,267 @@ bool FAsynchronousSqsWorker::GetQueueUrl(const Aws::String & QueueName, Aws::Str
     return Outcome.IsSuccess();
 }
 
+// Maps a channel onto its configured SQS FIFO queue
+//
+const Aws::String & FAsynchronousSqsWorker::GetChannelQueueUrl(const EActionChannel Channel) const {
+    return EActionChannel::IMMEDIATE == Channel ? ImmediateActionQueueUrl : TranslationActionQueueUrl;
+}
 
-// Attempts to request the next (FIFO-based) queued message if one is available
-// Only one message is processed at a time; future messages are delayed until the current message is processed.
-// If there's an error before message processing, then the next message won't be delayed
-// Returns ture if retrieving the next message was successful; false otherwise
+// Attempts to receive the next (FIFO-based) queued message of a channel's queue if one is available.
+// The message stays in its queue (invisible) until it is acknowledged. Skipped while the circuit is open.
 //
-bool FAsynchronousSqsWorker::RequestNextQueuedMessage(const Aws::String & QueueUrl,
-        const bool WantOnDemandMessage) const {
-    // Note: the 'ready for next translate message' state will be re-enabled from outside of this class
-    // (i.e. only accept a new sentence to translate when the existing animation sequence finishes playing - determined outside)
-    // On-demand (non-translate) messages will always be handled without delay
-    //
-    if (! WantOnDemandMessage) {
-        SetReadyForNextTranslateMessage(false);
+EActionReceiveResult FAsynchronousSqsWorker::ReceiveMessage(const EActionChannel Channel, FActionMessage & Message) {
+    if (! CircuitBreaker.AllowRequest()) {
+        ClientStats->ShortCircuited++;
+        return EActionReceiveResult::FAILED;
     }
     Aws::SQS::Model::ReceiveMessageRequest MessageRequest;
-    MessageRequest.SetQueueUrl(QueueUrl);
+    MessageRequest.SetQueueUrl(GetChannelQueueUrl(Channel));
     MessageRequest.SetMaxNumberOfMessages(MaxMessagesToReceive);
+    MessageRequest.AddAttributeNames(Aws::SQS::Model::QueueAttributeName::SentTimestamp);
+    MessageRequest.AddMessageAttributeNames(SessionIdAttributeName);
+    MessageRequest.AddMessageAttributeNames(ReplayedAttributeName);
     // Note: messages can be sent via a lambda function response, triggered through various AWS services -
     // in order to reach this SQS FIFO queue.
     //
-    const Aws::SQS::Model::ReceiveMessageOutcome Outcome = AwsSQSClient->ReceiveMessage(MessageRequest);
-    if (Outcome.IsSuccess()) {
-        const Aws::Vector<Aws::SQS::Model::Message> & Messages = Outcome.GetResult().GetMessages();
-        if (! Messages.empty()) {
-            const Aws::SQS::Model::Message & NewMessage = Messages[0];
-            const auto & MessageBody = UnrealAPI::AwsStringToFString(NewMessage.GetBody());
-            UE_LOG(LogTemp, Log, InfoMessageReceivedFormatted, *MessageBody);
-            // Consider adding more specific message handling outside
-            //
-            if (MessageBody.Contains(ChangeBackgroundMessage)) {
-                if (IsReadyForNewBackgroundMessage()) {
-                    // Don't take the background image of another sentence until the current sentence finishes rendition
+    Message.RequestedSeconds = FPlatformTime::Seconds();
+    ClientStats->Requests++;
+    // Note: a recovery probe (half-open circuit) is never hedged - it must remain a single request
+    //
+    const bool Hedge = (FInternalSettings::GetSQSHedgeAfterMs() > 0)
+            && (FSqsCircuitBreaker::EState::CLOSED == CircuitBreaker.GetState());
+    const Aws::SQS::Model::ReceiveMessageOutcome Outcome = Hedge
+            ? ReceiveHedged(MessageRequest)
+            : AwsSQSClient->ReceiveMessage(MessageRequest);
+    Message.ReceivedSeconds = FPlatformTime::Seconds();
+    if (! Outcome.IsSuccess()) {
+        const auto & ErrorMessage = UnrealAPI::AwsStringToFString(Outcome.GetError().GetMessage());
+        OnRequestFailed(FString::Printf(ErrorReceivingMessageFormatted, *ErrorMessage));
+        return EActionReceiveResult::FAILED;
+    }
+    OnRequestSucceeded();
+    const Aws::Vector<Aws::SQS::Model::Message> & Messages = Outcome.GetResult().GetMessages();
+    if (Messages.empty()) {
+        ClientStats->Empty++;
+        return EActionReceiveResult::EMPTY;
+    }
+    const Aws::SQS::Model::Message & NewMessage = Messages[0];
+    if (! IsOwnSession(NewMessage)) {
+        ReleaseMessage(Channel, NewMessage);
+        return EActionReceiveResult::EMPTY;
+    }
+    ClientStats->Received++;
+    Message.Body = UnrealAPI::AwsStringToFString(NewMessage.GetBody());
+    Message.ReceiptHandle = UnrealAPI::AwsStringToFString(NewMessage.GetReceiptHandle());
+    const auto & Attributes = NewMessage.GetAttributes();
+    const auto SentTimestamp = Attributes.find(Aws::SQS::Model::MessageSystemAttributeName::SentTimestamp);
+    if (SentTimestamp != Attributes.end()) {
+        Message.SentTimestampMs = FCString::Atoi64(*UnrealAPI::AwsStringToFString(SentTimestamp->second));
+    }
+    Message.Replayed = NewMessage.GetMessageAttributes().count(ReplayedAttributeName) > 0;
+    return EActionReceiveResult::RECEIVED;
+}
+
+// Shared queues in multi-instance mode: messages that name another session (SessionId message attribute) belong to
+// another instance. Messages without a session are taken by whichever instance receives them first
+//
+bool FAsynchronousSqsWorker::IsOwnSession(const Aws::SQS::Model::Message & NewMessage) const {
+    const FString & SessionId = GetSessionId();
+    if (SessionId.IsEmpty()) {
+        return true;
+    }
+    const auto & Attributes = NewMessage.GetMessageAttributes();
+    const auto SessionAttribute = Attributes.find(SessionIdAttributeName);
+    return (SessionAttribute == Attributes.end())
+            || (UnrealAPI::AwsStringToFString(SessionAttribute->second.GetStringValue()) == SessionId);
+}
+
+// Makes a received message visible again right away (so that its owner can receive it)
+//
+void FAsynchronousSqsWorker::ReleaseMessage(const EActionChannel Channel, const Aws::SQS::Model::Message & NewMessage) {
+    Aws::SQS::Model::ChangeMessageVisibilityRequest VisibilityRequest;
+    VisibilityRequest.SetQueueUrl(GetChannelQueueUrl(Channel));
+    VisibilityRequest.SetReceiptHandle(NewMessage.GetReceiptHandle());
+    VisibilityRequest.SetVisibilityTimeout(0);
+    if (AwsSQSClient->ChangeMessageVisibility(VisibilityRequest).IsSuccess()) {
+        ClientStats->OtherSession++;
+    }
+}
+
+// Issues a second, identical receive if the first one hasn't completed after SQSHedgeAfterMs; the first successful
+// response wins. Messages delivered to the losing request are released right away (visibility timeout reset to 0)
+// so they are redelivered instead of staying invisible.
+// The wait is bounded by the client's retry budget and ends early on shutdown; an abandoned receive counts as completed,
+// so that late successes release their messages like losers.
+// Note: a FIFO queue won't hand out messages of a message group that is in flight, so hedging never reorders actions
+//
+Aws::SQS::Model::ReceiveMessageOutcome FAsynchronousSqsWorker::ReceiveHedged(
+        const Aws::SQS::Model::ReceiveMessageRequest & MessageRequest) {
+    struct FHedgedReceive {
+        FHedgedReceive():
+            CompletedEvent {FPlatformProcess::GetSynchEventFromPool(true)} {
+        }
+        ~FHedgedReceive() {
+            FPlatformProcess::ReturnSynchEventToPool(CompletedEvent);
+        }
+        FCriticalSection MutexReceive;
+        FEvent * CompletedEvent;
+        int32 Pending {0};
+        bool Completed {false};
+        int32 WinnerIndex {0};
+        Aws::SQS::Model::ReceiveMessageOutcome Outcome;
+    };
+    const auto Receive = MakeShared<FHedgedReceive, ESPMode::ThreadSafe>();
+    const auto Stats = ClientStats;
+    const auto Launch = [this, Receive, Stats, &MessageRequest](const int32 Index) {
+        {
+            FScopeLock ScopeLock(&Receive->MutexReceive);
+            Receive->Pending++;
+        }
+        AwsSQSClient->ReceiveMessageAsync(MessageRequest,
+                [Receive, Stats, Index](const Aws::SQS::SQSClient * Client,
+                        const Aws::SQS::Model::ReceiveMessageRequest & Request,
+                        const Aws::SQS::Model::ReceiveMessageOutcome & Outcome,
+                        const std::shared_ptr<const Aws::Client::AsyncCallerContext> &) {
+                    FScopeLock ScopeLock(&Receive->MutexReceive);
+                    Receive->Pending--;
+                    // First success wins; if every request failed, the last failure is reported
                     //
-                    SetIsReadyForNewBackgroundMessage(false);
-                    if (! DeleteQueuedMessage(QueueUrl, NewMessage.GetReceiptHandle())) {
-                        // The current expected background is still queued (it's the next item)
-                        //
-                        SetIsReadyForNewBackgroundMessage(true);
-                        return false;
+                    if ((! Receive->Completed) && (Outcome.IsSuccess() || (0 == Receive->Pending))) {
+                        Receive->Completed = true;
+                        Receive->WinnerIndex = Index;
+                        Receive->Outcome = Outcome;
+                        Receive->CompletedEvent->Trigger();
+                        return;
                     }
-                    ProcessMessage(MessageBody);
-                }
-            } else {
-                // Consider adding additional handling in case a message fails to remove from its queue
-                //
-                DeleteQueuedMessage(QueueUrl, NewMessage.GetReceiptHandle());
-                ProcessMessage(MessageBody);
-            }
-        } else {
-            UE_LOG(LogTemp, Log, InfoNoMessageReceived);
-            if (! WantOnDemandMessage) {
-                SetReadyForNextTranslateMessage(true);
+                    if (! Outcome.IsSuccess()) {
+                        return;
+                    }
+                    for (const auto & LostMessage: Outcome.GetResult().GetMessages()) {
+                        Aws::SQS::Model::ChangeMessageVisibilityRequest VisibilityRequest;
+                        VisibilityRequest.SetQueueUrl(Request.GetQueueUrl());
+                        VisibilityRequest.SetReceiptHandle(LostMessage.GetReceiptHandle());
+                        VisibilityRequest.SetVisibilityTimeout(0);
+                        if (Client->ChangeMessageVisibility(VisibilityRequest).IsSuccess()) {
+                            Stats->Released++;
+                        }
+                    }
+                });
+    };
+    Launch(0);
+    if (! Receive->CompletedEvent->Wait(FInternalSettings::GetSQSHedgeAfterMs())) {
+        ClientStats->Hedged++;
+        Launch(1);
+    }
+    const int32 Attempts = FMath::Max(1, FInternalSettings::GetSQSMaxAttempts());
+    const double GiveUpSeconds = FPlatformTime::Seconds()
+            + (Attempts * (FInternalSettings::GetSQSConnectTimeoutMs() + FInternalSettings::GetSQSRequestTimeoutMs())
+                      + (Attempts - 1) * FInternalSettings::GetSQSRetryMaxDelayMs())
+                    / 1000.0;
+    while (! Receive->CompletedEvent->Wait(MaxHedgeWaitMs)) {
+        if (FGlobalState::IsAborting() || (FPlatformTime::Seconds() > GiveUpSeconds)) {
+            FScopeLock ScopeLock(&Receive->MutexReceive);
+            if (Receive->Completed) {
+                break;
             }
+            Receive->Completed = true;
+            return Aws::SQS::Model::ReceiveMessageOutcome(Aws::SQS::SQSError(Aws::SQS::SQSErrors::REQUEST_TIMEOUT,
+                    "RequestTimeout", ErrorHedgedReceiveAbandoned, false));
         }
+    }
+    FScopeLock ScopeLock(&Receive->MutexReceive);
+    if (1 == Receive->WinnerIndex) {
+        ClientStats->HedgeWins++;
+    }
+    return Receive->Outcome;
+}
+
+// Reports the first failure of an outage at Error level and the rest at Verbose level (no error spam while a venue
+// network is flaky); opens the circuit once failures persist
+//
+void FAsynchronousSqsWorker::OnRequestFailed(const FString & Error) {
+    ClientStats->Failed++;
+    const auto PreviousState = CircuitBreaker.GetState();
+    const bool Opened = CircuitBreaker.RecordFailure();
+    if (1 == CircuitBreaker.GetConsecutiveFailures()) {
+        UE_LOG(LogTemp, Error, TEXT("%s"), *Error);
     } else {
-        const auto & ErrorMessage = UnrealAPI::AwsStringToFString(Outcome.GetError().GetMessage());
-        UE_LOG(LogTemp, Error, ErrorReceivingMessageFormatted, *ErrorMessage);
-        if (! WantOnDemandMessage) {
-            SetReadyForNextTranslateMessage(true);
-        }
+        UE_LOG(LogTemp, Verbose, TEXT("%s"), *Error);
     }
-    return Outcome.IsSuccess();
+    if (Opened) {
+        ClientStats->CircuitOpened++;
+        UE_LOG(LogTemp, Warning, InfoCircuitOpenedFormatted, CircuitBreaker.GetConsecutiveFailures(),
+                CircuitBreaker.GetRemainingOpenSeconds());
+    } else if (FSqsCircuitBreaker::EState::HALF_OPEN == PreviousState) {
+        UE_LOG(LogTemp, Log, InfoCircuitProbeFailedFormatted, CircuitBreaker.GetRemainingOpenSeconds());
+    }
+}
+
+void FAsynchronousSqsWorker::OnRequestSucceeded() {
+    const int32 Failures = CircuitBreaker.GetConsecutiveFailures();
+    if (CircuitBreaker.RecordSuccess()) {
+        UE_LOG(LogTemp, Warning, InfoCircuitRecoveredFormatted, Failures);
+    }
+}
+
+bool FAsynchronousSqsWorker::AcknowledgeMessage(const EActionChannel Channel, const FActionMessage & Message) {
+    return DeleteQueuedMessage(GetChannelQueueUrl(Channel), UnrealAPI::FStringToAwsString(Message.ReceiptHandle));
 }
 
-// High-level method to decode a raw incoming generic action request (which was parsed from a SQS message) and
-// then forward its decoded action to a handler that will invoke the logic for that requested action
+bool FAsynchronousSqsWorker::ClearChannel(const EActionChannel Channel) {
+    return ClearQueue(GetChannelQueueUrl(Channel));
+}
+
+// Sends a recorded message to a channel's queue, mirroring the cloud producers (one message group per action type).
+// Only permitted against an overridden endpoint so that a replay can never reach production queues.
+// Note: SQS stamps its own send time, so end-to-end latency is measured from the injection
 //
-void FAsynchronousSqsWorker::ProcessMessage(const FString & Message) const {
-    const auto & Action = ASLMetaHumanAction(Message);
-    ActionHandlerDelegate.ExecuteIfBound(Action);
+bool FAsynchronousSqsWorker::InjectMessage(const EActionChannel Channel,
+        const FString & MessageBody,
+        const int64 SentTimestampMs) {
+    if (FInternalSettings::GetSQSEndpointOverride().IsEmpty()) {
+        UE_LOG(LogTemp, Error, ErrorReplayWithoutEndpointOverride);
+        return false;
+    }
+    const auto ActionType = ASLMetaHumanAction(MessageBody).GetActionType();
+    Aws::SQS::Model::SendMessageRequest MessageRequest;
+    MessageRequest.SetQueueUrl(GetChannelQueueUrl(Channel));
+    MessageRequest.SetMessageBody(UnrealAPI::FStringToAwsString(MessageBody));
+    MessageRequest.SetMessageGroupId(UnrealAPI::FStringToAwsString(FString::FromInt(static_cast<int32>(ActionType))));
+    MessageRequest.SetMessageDeduplicationId(UnrealAPI::FStringToAwsString(FGuid::NewGuid().ToString()));
+    if (! GetSessionId().IsEmpty()) {
+        Aws::SQS::Model::MessageAttributeValue SessionAttribute;
+        SessionAttribute.SetDataType("String");
+        SessionAttribute.SetStringValue(UnrealAPI::FStringToAwsString(GetSessionId()));
+        MessageRequest.AddMessageAttributes(SessionIdAttributeName, SessionAttribute);
+    }
+    Aws::SQS::Model::MessageAttributeValue ReplayedAttribute;
+    ReplayedAttribute.SetDataType("String");
+    ReplayedAttribute.SetStringValue("true");
+    MessageRequest.AddMessageAttributes(ReplayedAttributeName, ReplayedAttribute);
+    const Aws::SQS::Model::SendMessageOutcome Outcome = AwsSQSClient->SendMessage(MessageRequest);
+    if (! Outcome.IsSuccess()) {
+        const auto & ErrorMessage = UnrealAPI::AwsStringToFString(Outcome.GetError().GetMessage());
+        UE_LOG(LogTemp, Error, ErrorSendingMessageFormatted, *ErrorMessage);
+    }
+    return Outcome.IsSuccess();
 }
 
 // Deletes a particular queued message (MessageReceiptHandle) from a queue and returns the success value of that operation.
 //
 bool FAsynchronousSqsWorker::DeleteQueuedMessage(const Aws::String & QueueUrl,
-        const Aws::String & MessageReceiptHandle) const {
+        const Aws::String & MessageReceiptHandle) {
     Aws::SQS::Model::DeleteMessageRequest MessageRequest;
     MessageRequest.SetQueueUrl(QueueUrl);
     MessageRequest.SetReceiptHandle(MessageReceiptHandle);
+    ClientStats->Requests++;
     const Aws::SQS::Model::DeleteMessageOutcome Outcome = AwsSQSClient->DeleteMessage(MessageRequest);
     if (Outcome.IsSuccess()) {
+        OnRequestSucceeded();
         UE_LOG(LogTemp, Log, InfoMessageDeleted);
     } else {
         const auto & ErrorMessage = UnrealAPI::AwsStringToFString(Outcome.GetError().GetMessage());
-        UE_LOG(LogTemp, Error, ErrorDeletingFromQueueFormatted, *ErrorMessage);
+        OnRequestFailed(FString::Printf(ErrorDeletingFromQueueFormatted, *ErrorMessage));
     }
     return Outcome.IsSuccess();
 }
@@ -20,73 +20,54 @@
 // Represents a SQS Background Worker (separate thread) that will accept requests for processing.
 //
 
-#include <ModelingTaskTypes.h>
+#include "AsynchronousActionWorker.h"
+#include "SQSResilience.h"
 
 #include <aws/core/Aws.h>
 #include <aws/sqs/SQSClient.h>
+#include <aws/sqs/model/ReceiveMessageRequest.h>
 
 namespace ASLMetaHuman::Core {
 
-class FAsynchronousSqsWorker: public UE::Geometry::FAbortableBackgroundTask {
+class FAsynchronousSqsWorker: public FAsynchronousActionWorker {
 
 public:
     explicit FAsynchronousSqsWorker(const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate);
-    ~FAsynchronousSqsWorker();
-
-    void DoWork();
+    virtual ~FAsynchronousSqsWorker() override;
 
     bool InitAwsClient();
 
-    FORCEINLINE TStatId GetStatId() const {
-        RETURN_QUICK_DECLARE_CYCLE_STAT(FAsynchronousSQSWorker, STATGROUP_ThreadPoolAsyncTasks);
-    }
-
-    static bool IsReadyForNextTranslationMessage() {
-        FScopeLock ScopeLock(&MutexReadyForNextTranslationMessage);
-        return ReadyForNextMessage;
-    }
-
-    static void SetReadyForNextTranslateMessage(const bool State) {
-        FScopeLock ScopeLock(&MutexReadyForNextTranslationMessage);
-        ReadyForNextMessage = State;
-        if (ReadyForNextMessage)
-        {
-            SetIsReadyForNewBackgroundMessage(true);
-        }
-    }
-
-    static bool IsReadyForNewBackgroundMessage() {
-        FScopeLock ScopeLock(&MutexReadyForNextBackgroundMessageMessage);
-        return ReadyForNextBackgroundMessage;
-    }
-
-    static void SetIsReadyForNewBackgroundMessage(const bool State) {
-        FScopeLock ScopeLock(&MutexReadyForNextBackgroundMessageMessage);
-        ReadyForNextBackgroundMessage = State;
-    }
-
+protected:
+    virtual const TCHAR * GetSourceName() const override;
+    virtual bool InitSource() override;
+    virtual void ShutdownSource() override;
+    virtual void WaitForMessages() override;
+    virtual EActionReceiveResult ReceiveMessage(const EActionChannel Channel, FActionMessage & Message) override;
+    virtual bool AcknowledgeMessage(const EActionChannel Channel, const FActionMessage & Message) override;
+    virtual bool ClearChannel(const EActionChannel Channel) override;
+    virtual bool InjectMessage(const EActionChannel Channel,
+            const FString & MessageBody,
+            const int64 SentTimestampMs) override;
 
 private:
     bool GetQueueUrl(const Aws::String & QueueName, Aws::String & QueueUrl) const;
-    bool RequestNextQueuedMessage(const Aws::String & QueueUrl, const bool WantOnDemandMessage = false) const;
+    const Aws::String & GetChannelQueueUrl(const EActionChannel Channel) const;
     bool ClearQueue(const Aws::String & QueueUrl) const;
-    bool DeleteQueuedMessage(const Aws::String & QueueUrl, const Aws::String & MessageReceiptHandle) const;
-    void ProcessMessage(const FString & Message) const;
+    bool DeleteQueuedMessage(const Aws::String & QueueUrl, const Aws::String & MessageReceiptHandle);
+    bool IsOwnSession(const Aws::SQS::Model::Message & NewMessage) const;
+    void ReleaseMessage(const EActionChannel Channel, const Aws::SQS::Model::Message & NewMessage);
+    Aws::SQS::Model::ReceiveMessageOutcome ReceiveHedged(const Aws::SQS::Model::ReceiveMessageRequest & MessageRequest);
+    void OnRequestFailed(const FString & Error);
+    void OnRequestSucceeded();
+
+    // Note: outlives the client (SDK executor threads may still complete a hedged receive during shutdown)
+    //
+    TSharedRef<FSqsClientStats, ESPMode::ThreadSafe> ClientStats {MakeShared<FSqsClientStats, ESPMode::ThreadSafe>()};
+    FSqsCircuitBreaker CircuitBreaker;
 
     TUniquePtr<Aws::SQS::SQSClient> AwsSQSClient;
 
     Aws::String ImmediateActionQueueUrl;
     Aws::String TranslationActionQueueUrl;
-    std::map<const Aws::String, const Aws::String> AvailableQueues;
-    TDelegate<void(const ASLMetaHumanAction &)> ActionHandlerDelegate;
-
-    // Tracks shutdown request state and message retrieval readiness
-    //
-    static inline bool AbortActive = false;
-    static inline bool ReadyForNextMessage = true;
-    static inline bool ReadyForNextBackgroundMessage = true;
-    static inline FCriticalSection MutexAbortActive;
-    static inline FCriticalSection MutexReadyForNextTranslationMessage;
-    static inline FCriticalSection MutexReadyForNextBackgroundMessageMessage;
 };
-}
\ No newline at end of file
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents a local socket action source: a producer on the same host connects over loopback TCP and writes
+// newline-delimited JSON actions (the same payloads that are published to SQS).
+//
+// Example (from the same host): echo {"Action":"STOP_ALL_ANIMATIONS"} | ncat 127.0.0.1 <ActionSocketPort>
+//
+
+#include "AsynchronousSocketWorker.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+
+#include <Async/Async.h>
+#include <SocketSubsystem.h>
+#include <Sockets.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FAsynchronousSocketWorker;
+
+namespace {
+constexpr auto & SocketActionSourceName = TEXT("Socket");
+constexpr auto & ListenSocketDescription = TEXT("ASLMetaHumanActionSource");
+// Only local producers are accepted
+//
+constexpr uint32 LoopbackAddress = 0x7F000001;
+constexpr int32 MaxPendingConnections = 8;
+constexpr int32 ReceiveBufferSize = 64 * 1024;
+// Time between checks for shutdown while waiting on connections or data
+//
+constexpr float SocketWaitSeconds = 0.1f;
+constexpr uint8 MessageDelimiter = '\n';
+// Console status-related messages
+//
+constexpr auto & ErrorSocketFormatted = TEXT("Error: failed to listen on 127.0.0.1:%d");
+constexpr auto & InfoConnectionAccepted = TEXT("Action source connection accepted");
+constexpr auto & InfoListeningFormatted = TEXT("Action source listening on 127.0.0.1:%d");
+}
+
+FAsynchronousSocketWorker::FAsynchronousSocketWorker(
+        const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate):
+            FAsynchronousBufferedActionWorker {ExternalActionHandlerDelegate} {
+}
+
+FAsynchronousSocketWorker::~FAsynchronousSocketWorker() {
+    ShutdownSource();
+}
+
+const TCHAR * FAsynchronousSocketWorker::GetSourceName() const {
+    return SocketActionSourceName;
+}
+
+// Binds a loopback listen socket and starts accepting producer connections on a dedicated thread
+//
+bool FAsynchronousSocketWorker::InitSource() {
+    auto SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (nullptr == SocketSubsystem) {
+        return false;
+    }
+    // Each render session of a process listens on its own port
+    //
+    const int32 Port = FInternalSettings::GetActionSocketPort() + GetSessionSlot();
+    const TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+    Address->SetIp(LoopbackAddress);
+    Address->SetPort(Port);
+    ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, ListenSocketDescription, Address->GetProtocolType());
+    if ((nullptr == ListenSocket) || (! ListenSocket->SetReuseAddr()) || (! ListenSocket->Bind(*Address))
+            || (! ListenSocket->Listen(MaxPendingConnections))) {
+        UE_LOG(LogTemp, Error, ErrorSocketFormatted, Port);
+        ShutdownSource();
+        return false;
+    }
+    ListenSocket->SetNoDelay(true);
+    UE_LOG(LogTemp, Log, InfoListeningFormatted, Port);
+    ListenFuture = Async(EAsyncExecution::Thread, [this]() {
+        AcceptConnections();
+    });
+    return true;
+}
+
+// Stops accepting (closing the listen socket wakes a pending accept) and waits for the connection threads
+//
+void FAsynchronousSocketWorker::ShutdownSource() {
+    if (nullptr == ListenSocket) {
+        return;
+    }
+    Stopping = true;
+    ListenSocket->Close();
+    if (ListenFuture.IsValid()) {
+        ListenFuture.Wait();
+    }
+    {
+        FScopeLock ScopeLock(&MutexConnections);
+        for (auto & ConnectionFuture: ConnectionFutures) {
+            ConnectionFuture.Wait();
+        }
+        ConnectionFutures.Reset();
+    }
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+    ListenSocket = nullptr;
+}
+
+// Accepts producer connections until shutdown; each connection is read on its own thread
+//
+void FAsynchronousSocketWorker::AcceptConnections() {
+    while ((! Stopping) && (! FGlobalState::IsAborting())) {
+        bool HasPendingConnection = false;
+        if (! ListenSocket->WaitForPendingConnection(HasPendingConnection, FTimespan::FromSeconds(SocketWaitSeconds))) {
+            // The listen socket was closed (shutdown) or failed: avoid spinning until the loop condition is checked
+            //
+            FPlatformProcess::Sleep(SocketWaitSeconds);
+            continue;
+        }
+        if (! HasPendingConnection) {
+            continue;
+        }
+        FSocket * ConnectionSocket = ListenSocket->Accept(ListenSocketDescription);
+        if (nullptr == ConnectionSocket) {
+            continue;
+        }
+        if (Stopping) {
+            ConnectionSocket->Close();
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ConnectionSocket);
+            break;
+        }
+        UE_LOG(LogTemp, Log, InfoConnectionAccepted);
+        ConnectionSocket->SetNoDelay(true);
+        FScopeLock ScopeLock(&MutexConnections);
+        // Forget connections that were closed by their producers
+        //
+        ConnectionFutures.RemoveAll([](const TFuture<void> & ConnectionFuture) {
+            return ConnectionFuture.IsReady();
+        });
+        ConnectionFutures.Add(Async(EAsyncExecution::Thread, [this, ConnectionSocket]() {
+            ReadConnection(ConnectionSocket);
+        }));
+    }
+}
+
+// Reads newline-delimited messages from one connection until it is closed or shutdown is requested
+//
+void FAsynchronousSocketWorker::ReadConnection(FSocket * ConnectionSocket) {
+    TArray<uint8> ReceiveBuffer;
+    ReceiveBuffer.SetNumUninitialized(ReceiveBufferSize);
+    TArray<uint8> PendingBytes;
+    while ((! Stopping) && (! FGlobalState::IsAborting())) {
+        if (! ConnectionSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(SocketWaitSeconds))) {
+            if (ESocketConnectionState::SCS_Connected != ConnectionSocket->GetConnectionState()) {
+                break;
+            }
+            continue;
+        }
+        int32 BytesRead = 0;
+        if ((! ConnectionSocket->Recv(ReceiveBuffer.GetData(), ReceiveBuffer.Num(), BytesRead)) || (0 == BytesRead)) {
+            break;
+        }
+        PendingBytes.Append(ReceiveBuffer.GetData(), BytesRead);
+        PushLines(PendingBytes, FPlatformTime::Seconds());
+    }
+    // A final message may not be newline-terminated
+    //
+    PendingBytes.Add(MessageDelimiter);
+    PushLines(PendingBytes, FPlatformTime::Seconds());
+    ConnectionSocket->Close();
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ConnectionSocket);
+}
+
+// Pushes every complete (newline-terminated) message and keeps any trailing partial message. ArrivedSeconds is the
+// time that the bytes completing these messages were read
+//
+void FAsynchronousSocketWorker::PushLines(TArray<uint8> & PendingBytes, const double ArrivedSeconds) {
+    int32 LineStart = 0;
+    for (int32 i = 0; i < PendingBytes.Num(); i++) {
+        if (MessageDelimiter != PendingBytes[i]) {
+            continue;
+        }
+        const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR *>(PendingBytes.GetData() + LineStart), i - LineStart);
+        const FString Line = FString(Converted.Length(), Converted.Get()).TrimStartAndEnd();
+        if (! Line.IsEmpty()) {
+            PushMessage(Line, ArrivedSeconds);
+        }
+        LineStart = i + 1;
+    }
+    PendingBytes.RemoveAt(0, LineStart, false);
+}
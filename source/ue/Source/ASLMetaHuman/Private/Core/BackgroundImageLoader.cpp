@@ -0,0 +1,323 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Downloads background images as raw bytes and decodes them on a worker thread (see FBackgroundImageLoader)
+//
+
+#include "BackgroundImageLoader.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+
+#include <Async/Async.h>
+#include <Containers/Ticker.h>
+#include <Engine/Texture2D.h>
+#include <HttpModule.h>
+#include <IImageWrapper.h>
+#include <IImageWrapperModule.h>
+#include <Interfaces/IHttpResponse.h>
+#include <UObject/GarbageCollection.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FBackgroundImageIngest;
+using ASLMetaHuman::Core::FBackgroundImageLoader;
+using ASLMetaHuman::Core::FBackgroundTextureCache;
+using ASLMetaHuman::Core::FCrtS3Download;
+using ASLMetaHuman::Core::FCrtS3Downloader;
+
+namespace {
+constexpr auto & ImageWrapperModuleName = TEXT("ImageWrapper");
+// Unused by unsigned requests, but required by the client
+//
+constexpr auto & DownloaderRegion = TEXT("us-east-1");
+constexpr uint64 BytesPerKB {1024};
+constexpr auto & HttpTransportName = TEXT("HTTP");
+constexpr auto & S3TransportName = TEXT("S3 ranged GETs");
+constexpr auto & WarningDownloadFailedFormatted = TEXT("Background image download failed (HTTP %d)");
+constexpr auto & WarningS3DownloadFailedFormatted = TEXT("Background image S3 download failed (%s): retrying over HTTP");
+constexpr auto & InfoDownloadCancelledFormatted = TEXT("Background image download cancelled (STOP, or no response within %.1f s)");
+constexpr auto & WarningDecodeFailedFormatted = TEXT("Background image could not be decoded (%lld bytes)");
+constexpr auto & InfoBackgroundLoadedFormatted =
+        TEXT("Background image: downloaded %.1f KB in %.1f ms (%s), decoded and ingested in %.1f ms (worker: %s), uploaded in %.2f ms (game thread); %.1f ms to texture");
+}
+
+// One background load, from the cache lookup to OnLoaded. The image file is the HTTP response's content or the S3
+// download's body
+//
+struct FBackgroundImageLoader::FLoad {
+    FLoad(const FString & InUrl,
+            const TSharedRef<FBackgroundTextureCache> & InCache,
+            const TSharedPtr<FCrtS3Downloader> & InDownloader,
+            const FBackgroundImageIngest::FOptions & InIngestOptions,
+            FOnLoaded && InOnLoaded):
+        Url {InUrl},
+        Cache {InCache},
+        Downloader {InDownloader},
+        IngestOptions {InIngestOptions},
+        OnLoaded {MoveTemp(InOnLoaded)},
+        StartSeconds {FPlatformTime::Seconds()} {
+    }
+
+    TArrayView64<const uint8> GetImageBytes() const {
+        if (Response.IsValid()) {
+            return Response->GetContent();
+        }
+        return Body;
+    }
+
+    const TCHAR * GetTransportName() const {
+        return Response.IsValid() ? HttpTransportName : S3TransportName;
+    }
+
+    const FString Url;
+    FString UrlKey;
+    const TSharedRef<FBackgroundTextureCache> Cache;
+    TSharedPtr<FCrtS3Downloader> Downloader;
+    const FBackgroundImageIngest::FOptions IngestOptions;
+    FBackgroundImageIngest::FStats IngestStats;
+    FOnLoaded OnLoaded;
+    IImageWrapperModule * ImageWrapperModule {nullptr};
+    const double StartSeconds;
+    double DownloadStartSeconds {0.0};
+    double DownloadMs {0.0};
+    FHttpResponsePtr Response;
+    TArray64<uint8> Body;
+};
+
+// Note: the cache lookups, the HTTP completion and OnLoaded run on the game thread; hashing, decoding and ingesting
+// run on the thread pool
+//
+void FBackgroundImageLoader::Load(const FString & Url,
+        const TSharedRef<FBackgroundTextureCache> & Cache,
+        const TSharedPtr<FCrtS3Downloader> & Downloader,
+        const FBackgroundImageIngest::FOptions & IngestOptions,
+        FOnLoaded && OnLoaded) {
+    const TSharedRef<FLoad> NewLoad = MakeShared<FLoad>(Url, Cache, Downloader, IngestOptions, MoveTemp(OnLoaded));
+    AsyncTask(ENamedThreads::GameThread, [NewLoad]() {
+        NewLoad->UrlKey = FBackgroundTextureCache::ToUrlKey(NewLoad->Url);
+        if (UTexture2D * CachedTexture = NewLoad->Cache->FindByUrl(NewLoad->UrlKey)) {
+            NewLoad->OnLoaded(CachedTexture);
+            return;
+        }
+        NewLoad->ImageWrapperModule = &GetImageWrapperModule();
+        if (NewLoad->Downloader.IsValid()) {
+            DownloadS3(NewLoad);
+        } else {
+            DownloadHttp(NewLoad);
+        }
+    });
+}
+
+TSharedPtr<FCrtS3Downloader> FBackgroundImageLoader::CreateDownloader() {
+    if (! FInternalSettings::GetBackgroundS3DownloadEnabled()) {
+        return nullptr;
+    }
+    FCrtS3Downloader::FOptions Options;
+    Options.Region = DownloaderRegion;
+    Options.PartSize = static_cast<uint64>(FMath::Max(1, FInternalSettings::GetBackgroundS3PartSizeKB())) * BytesPerKB;
+    Options.MaxConnections = static_cast<uint32>(FMath::Max(0, FInternalSettings::GetBackgroundS3MaxConnections()));
+    Options.SignRequests = false;
+    const auto Downloader = MakeShared<FCrtS3Downloader>(Options);
+    if (! Downloader->IsValid()) {
+        return nullptr;
+    }
+    return Downloader;
+}
+
+void FBackgroundImageLoader::DownloadHttp(const TSharedRef<FLoad> & Load) {
+    const auto Request = FHttpModule::Get().CreateRequest();
+    Request->SetVerb(TEXT("GET"));
+    Request->SetURL(Load->Url);
+    Request->SetTimeout(FInternalSettings::GetBackgroundDownloadTimeoutSeconds());
+    Request->OnProcessRequestComplete().BindLambda([Load](FHttpRequestPtr, FHttpResponsePtr Response, bool Succeeded) {
+        if (Succeeded && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode())) {
+            Load->DownloadMs = (FPlatformTime::Seconds() - Load->DownloadStartSeconds) * 1000.0;
+            Load->Response = Response;
+            DecodeAsync(Load);
+            return;
+        }
+        UE_LOG(LogTemp, Warning, WarningDownloadFailedFormatted, Response.IsValid() ? Response->GetResponseCode() : 0);
+        Load->OnLoaded(nullptr);
+    });
+    Load->DownloadStartSeconds = FPlatformTime::Seconds();
+    Request->ProcessRequest();
+}
+
+// The decode starts on the CRT thread that finished the download. A download still running after
+// BackgroundDownloadTimeoutSeconds is cancelled (like the ones in flight on STOP, see FCrtS3Downloader::CancelAll());
+// other failures are retried over HTTP
+//
+void FBackgroundImageLoader::DownloadS3(const TSharedRef<FLoad> & Load) {
+    // Note: the session owns the downloader (it must be destroyed on the game thread, not by a finishing load)
+    //
+    const TSharedPtr<FCrtS3Downloader> Downloader = MoveTemp(Load->Downloader);
+    Load->DownloadStartSeconds = FPlatformTime::Seconds();
+    const auto Download = Downloader->GetUrl(Load->Url, [Load](FCrtS3Download & FinishedDownload) {
+        if (FinishedDownload.Succeeded()) {
+            Load->DownloadMs = (FPlatformTime::Seconds() - Load->DownloadStartSeconds) * 1000.0;
+            Load->Body = MoveTemp(FinishedDownload.GetBody());
+            DecodeAsync(Load);
+            return;
+        }
+        const bool Cancelled = FinishedDownload.IsCancelled();
+        const FString Error = FinishedDownload.GetError();
+        AsyncTask(ENamedThreads::GameThread, [Load, Cancelled, Error]() {
+            if (Cancelled || FGlobalState::IsAborting()) {
+                UE_LOG(LogTemp, Log, InfoDownloadCancelledFormatted,
+                        FInternalSettings::GetBackgroundDownloadTimeoutSeconds());
+                Load->OnLoaded(nullptr);
+                return;
+            }
+            UE_LOG(LogTemp, Warning, WarningS3DownloadFailedFormatted, *Error);
+            DownloadHttp(Load);
+        });
+    });
+    if (nullptr == Download) {
+        DownloadHttp(Load);
+        return;
+    }
+    const TWeakPtr<FCrtS3Download> WeakDownload = Download;
+    const auto CancelOnTimeout = FTickerDelegate::CreateLambda([WeakDownload](float) {
+        if (const auto PendingDownload = WeakDownload.Pin()) {
+            PendingDownload->Cancel();
+        }
+        return false;
+    });
+    FTSTicker::GetCoreTicker().AddTicker(CancelOnTimeout, FInternalSettings::GetBackgroundDownloadTimeoutSeconds());
+}
+
+// Skips the decode if the image is cached already (under another URL)
+//
+void FBackgroundImageLoader::DecodeAsync(const TSharedRef<FLoad> & Load) {
+    Async(EAsyncExecution::ThreadPool, [Load]() {
+        const TArrayView64<const uint8> ImageBytes = Load->GetImageBytes();
+        const double StartSeconds = FPlatformTime::Seconds();
+        const uint64 ContentHash = FBackgroundTextureCache::HashContent(ImageBytes);
+        const bool Decoded = ! Load->Cache->ContainsContent(ContentHash);
+        UTexture2D * Texture = nullptr;
+        if (Decoded) {
+            Texture = Decode(*Load->ImageWrapperModule, ImageBytes, Load->IngestOptions, &Load->Cache.Get(),
+                    Load->IngestStats);
+        }
+        const double DecodeMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+        AsyncTask(ENamedThreads::GameThread, [Load, ContentHash, Decoded, Texture, DecodeMs]() {
+            FinishLoad(Load, ContentHash, Decoded, Texture, DecodeMs);
+        });
+    });
+}
+
+void FBackgroundImageLoader::FinishLoad(const TSharedRef<FLoad> & Load,
+        const uint64 ContentHash,
+        const bool Decoded,
+        UTexture2D * Texture,
+        const double DecodeMs) {
+    if (UTexture2D * CachedTexture = Load->Cache->FindByContent(ContentHash, Load->UrlKey)) {
+        if (nullptr != Texture) {
+            Load->Cache->Release(Texture);
+        }
+        Load->OnLoaded(CachedTexture);
+        return;
+    }
+    if (! Decoded) {
+        // Evicted since the decode was skipped
+        //
+        DecodeAsync(Load);
+        return;
+    }
+    const int64 DownloadedBytes = Load->GetImageBytes().Num();
+    if (nullptr == Texture) {
+        UE_LOG(LogTemp, Warning, WarningDecodeFailedFormatted, DownloadedBytes);
+        Load->OnLoaded(nullptr);
+        return;
+    }
+    if (FGlobalState::IsAborting()) {
+        Load->Cache->Release(Texture);
+        return;
+    }
+    const double UploadStartSeconds = FPlatformTime::Seconds();
+    Upload(*Texture);
+    const double UploadMs = (FPlatformTime::Seconds() - UploadStartSeconds) * 1000.0;
+    UE_LOG(LogTemp, Log, InfoBackgroundLoadedFormatted, DownloadedBytes / 1024.0, Load->DownloadMs,
+            Load->GetTransportName(), DecodeMs, *Load->IngestStats.ToString(), UploadMs,
+            (FPlatformTime::Seconds() - Load->StartSeconds) * 1000.0);
+    Load->OnLoaded(Load->Cache->Add(Load->UrlKey, ContentHash, Texture));
+}
+
+// Ingests into a pooled texture of the ingested image's resolution, format and mip count if there's one, otherwise
+// into a new texture
+//
+UTexture2D * FBackgroundImageLoader::Decode(IImageWrapperModule & ImageWrapperModule,
+        const TArrayView64<const uint8> ImageBytes,
+        const FBackgroundImageIngest::FOptions & IngestOptions,
+        FBackgroundTextureCache * Cache,
+        FBackgroundImageIngest::FStats & IngestStats) {
+    const EImageFormat Format = ImageWrapperModule.DetectImageFormat(ImageBytes.GetData(), ImageBytes.Num());
+    if (EImageFormat::Invalid == Format) {
+        return nullptr;
+    }
+    const TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(Format);
+    if ((! ImageWrapper.IsValid()) || (! ImageWrapper->SetCompressed(ImageBytes.GetData(), ImageBytes.Num()))) {
+        return nullptr;
+    }
+    TArray64<uint8> Pixels;
+    if (! ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Pixels)) {
+        return nullptr;
+    }
+    FBackgroundImageIngest::FImage Image;
+    FBackgroundImageIngest::Ingest(IngestOptions, MoveTemp(Pixels), static_cast<int32>(ImageWrapper->GetWidth()),
+            static_cast<int32>(ImageWrapper->GetHeight()), Image, IngestStats);
+    UTexture2D * Texture = nullptr;
+    if (nullptr != Cache) {
+        Texture = Cache->AcquirePooled(Image.Width, Image.Height, Image.Format, Image.Mips.Num());
+    }
+    if (nullptr == Texture) {
+        // The texture is created off the game thread: keep the garbage collector out until it's rooted
+        //
+        FGCScopeGuard GCScopeGuard;
+        Texture = UTexture2D::CreateTransient(Image.Width, Image.Height, Image.Format);
+        if (nullptr == Texture) {
+            return nullptr;
+        }
+        Texture->AddToRoot();
+        auto & Mips = Texture->GetPlatformData()->Mips;
+        for (int32 MipIndex = Mips.Num(); MipIndex < Image.Mips.Num(); MipIndex++) {
+            auto * Mip = new FTexture2DMipMap();
+            Mip->SizeX = FMath::Max(1, Image.Width >> MipIndex);
+            Mip->SizeY = FMath::Max(1, Image.Height >> MipIndex);
+            Mip->SizeZ = 1;
+            Mips.Add(Mip);
+        }
+    }
+    auto & Mips = Texture->GetPlatformData()->Mips;
+    for (int32 MipIndex = 0; MipIndex < Image.Mips.Num(); MipIndex++) {
+        const auto & MipBytes = Image.Mips[MipIndex];
+        auto & BulkData = Mips[MipIndex].BulkData;
+        BulkData.Lock(LOCK_READ_WRITE);
+        FMemory::Memcpy(BulkData.Realloc(MipBytes.Num()), MipBytes.GetData(), MipBytes.Num());
+        BulkData.Unlock();
+    }
+    return Texture;
+}
+
+void FBackgroundImageLoader::Upload(UTexture2D & Texture) {
+    Texture.UpdateResource();
+}
+
+IImageWrapperModule & FBackgroundImageLoader::GetImageWrapperModule() {
+    return FModuleManager::LoadModuleChecked<IImageWrapperModule>(ImageWrapperModuleName);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Loads background images without a GPU round trip: the image file is downloaded as raw bytes, decoded with
+// IImageWrapper on a worker thread straight into the CPU mip data of a transient texture, and the game thread only
+// updates the texture's resource (one upload). Nothing is read back from the GPU and the render thread isn't flushed,
+// so it also runs headless (-nullrhi, see the BackgroundDecode commandlet). Loads go through a background texture
+// cache (see FBackgroundTextureCache): a cached URL or image is neither downloaded nor decoded again. The decoded
+// image is resized to the plane's on-screen size and block-compressed on the same worker thread before it's uploaded
+// (see FBackgroundImageIngest).
+//
+// Images are downloaded with the CRT S3 client if a downloader is given (parallel ranged GETs over pooled connections,
+// see CreateDownloader()), otherwise as a single HTTP stream. Note: IImageWrapper only decodes whole files, so the
+// decode starts once the last part has landed - right on the CRT thread that received it, without a game thread hop.
+//
+
+#include <CoreMinimal.h>
+
+#include "BackgroundImageIngest.h"
+#include "BackgroundTextureCache.h"
+#include "CrtS3Downloader.h"
+
+class IImageWrapperModule;
+class UTexture2D;
+
+namespace ASLMetaHuman::Core {
+
+class FBackgroundImageLoader {
+public:
+    // Called on the game thread with the uploaded texture (owned by the cache), or nullptr if the image couldn't be
+    // downloaded or decoded (or its download was cancelled)
+    //
+    using FOnLoaded = TFunction<void(UTexture2D * Texture)>;
+
+    // Loads the image at Url (e.g. a presigned S3 URL) from the cache, or downloads it (through Downloader if it's
+    // set), decodes and ingests it (IngestOptions, see FBackgroundImageIngest::GetOptions()) on a worker thread (then
+    // caches it); then calls OnLoaded. The time from this call to the uploaded texture is logged
+    //
+    static void Load(const FString & Url,
+            const TSharedRef<FBackgroundTextureCache> & Cache,
+            const TSharedPtr<FCrtS3Downloader> & Downloader,
+            const FBackgroundImageIngest::FOptions & IngestOptions,
+            FOnLoaded && OnLoaded);
+
+    // Creates the background downloader: a CRT S3 client that doesn't sign its requests (presigned URLs carry their
+    // signature), with BackgroundS3PartSizeKB parts and BackgroundS3MaxConnections connections. Returns nullptr if
+    // BackgroundS3DownloadEnabled is off or the client couldn't be created (the AWS SDK must be initialized)
+    //
+    static TSharedPtr<FCrtS3Downloader> CreateDownloader();
+
+    // Decodes an image file (PNG, JPEG, BMP, ...) and ingests it (see FBackgroundImageIngest::Ingest()) into the mip
+    // data of a (rooted) transient texture: a pooled one of the cache (if given) or a new one. Its resource still has
+    // to be updated on the game thread (see Upload()). Safe on any thread once the image wrapper module is loaded (see
+    // GetImageWrapperModule()). Returns nullptr if the image couldn't be decoded
+    //
+    static UTexture2D * Decode(IImageWrapperModule & ImageWrapperModule,
+            const TArrayView64<const uint8> ImageBytes,
+            const FBackgroundImageIngest::FOptions & IngestOptions,
+            FBackgroundTextureCache * Cache,
+            FBackgroundImageIngest::FStats & IngestStats);
+
+    // Game thread: creates the texture's resource from its mip data
+    //
+    static void Upload(UTexture2D & Texture);
+
+    // Game thread: loads the image wrapper module if needed
+    //
+    static IImageWrapperModule & GetImageWrapperModule();
+
+private:
+    struct FLoad;
+
+    static void DownloadHttp(const TSharedRef<FLoad> & Load);
+    static void DownloadS3(const TSharedRef<FLoad> & Load);
+    static void DecodeAsync(const TSharedRef<FLoad> & Load);
+    static void FinishLoad(const TSharedRef<FLoad> & Load,
+            const uint64 ContentHash,
+            const bool Decoded,
+            UTexture2D * Texture,
+            const double DecodeMs);
+};
+}
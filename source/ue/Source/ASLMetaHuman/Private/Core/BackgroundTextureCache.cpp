@@ -0,0 +1,252 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Decoded background textures kept for reuse within a budget (see BackgroundTextureCache.h)
+//
+
+#include "BackgroundTextureCache.h"
+
+#include <Engine/Texture2D.h>
+#include <Hash/CityHash.h>
+#include <RenderUtils.h>
+
+using ASLMetaHuman::Core::FBackgroundTextureCache;
+
+namespace {
+constexpr double BytesPerMB {1024.0 * 1024.0};
+constexpr auto & InfoCacheStatsFormatted = TEXT("Background textures: %d cached (%.1f MB, peak %.1f MB of %.1f MB), %.1f MB pooled; %.1f%% hit rate (%llu URL hits, %llu content hits, %llu misses), %llu evictions, %llu pool reuses");
+}
+
+FBackgroundTextureCache::FBackgroundTextureCache(const int64 InBudgetBytes, const int32 InPoolSizePerResolution):
+    BudgetBytes(InBudgetBytes),
+    PoolSizePerResolution(InPoolSizePerResolution) {
+}
+
+FString FBackgroundTextureCache::ToUrlKey(const FString & Url) {
+    FString UrlKey;
+    if (! Url.Split(TEXT("?"), &UrlKey, nullptr)) {
+        UrlKey = Url;
+    }
+    return UrlKey;
+}
+
+uint64 FBackgroundTextureCache::HashContent(const TArrayView64<const uint8> ImageBytes) {
+    return CityHash64(reinterpret_cast<const char *>(ImageBytes.GetData()), static_cast<uint32>(ImageBytes.Num()));
+}
+
+UTexture2D * FBackgroundTextureCache::FindByUrl(const FString & UrlKey) {
+    FScopeLock ScopeLock(&MutexEntries);
+    const auto EntryPtr = Entries.Find(UrlKey);
+    if (nullptr == EntryPtr) {
+        Misses++;
+        return nullptr;
+    }
+    EntryPtr->LastUse = ++UseCounter;
+    UrlHits++;
+    return EntryPtr->Texture;
+}
+
+// Note: a content hit was counted as a URL miss first; it's only counted as a content hit
+//
+UTexture2D * FBackgroundTextureCache::FindByContent(const uint64 ContentHash, const FString & UrlKey) {
+    FScopeLock ScopeLock(&MutexEntries);
+    const auto UrlKeyPtr = ContentIndex.Find(ContentHash);
+    if (nullptr == UrlKeyPtr) {
+        return nullptr;
+    }
+    const FEntry Entry = Entries.FindChecked(*UrlKeyPtr);
+    // Another URL of the same image: shares the texture (its size is only counted once)
+    //
+    auto & Alias = Entries.FindOrAdd(UrlKey);
+    Alias.Texture = Entry.Texture;
+    Alias.ContentHash = ContentHash;
+    Alias.LastUse = ++UseCounter;
+    Misses--;
+    ContentHits++;
+    return Entry.Texture;
+}
+
+bool FBackgroundTextureCache::ContainsContent(const uint64 ContentHash) const {
+    FScopeLock ScopeLock(&MutexEntries);
+    return ContentIndex.Contains(ContentHash);
+}
+
+UTexture2D * FBackgroundTextureCache::AcquirePooled(const int32 Width,
+        const int32 Height,
+        const EPixelFormat Format,
+        const int32 NumMips) {
+    FScopeLock ScopeLock(&MutexEntries);
+    const auto TexturesPtr = Pool.Find({FIntPoint(Width, Height), Format, NumMips});
+    if ((nullptr == TexturesPtr) || TexturesPtr->IsEmpty()) {
+        return nullptr;
+    }
+    UTexture2D * Texture = TexturesPtr->Pop(false);
+    PooledBytes -= GetSizeBytes(*Texture);
+    PoolReuses++;
+    return Texture;
+}
+
+UTexture2D * FBackgroundTextureCache::Add(const FString & UrlKey, const uint64 ContentHash, UTexture2D * Texture) {
+    FScopeLock ScopeLock(&MutexEntries);
+    if (const auto EntryPtr = Entries.Find(UrlKey)) {
+        // Another load of the same URL finished first
+        //
+        EntryPtr->LastUse = ++UseCounter;
+        if (EntryPtr->Texture != Texture) {
+            ReleaseLocked(Texture);
+        }
+        return EntryPtr->Texture;
+    }
+    auto & Entry = Entries.Add(UrlKey);
+    Entry.Texture = Texture;
+    Entry.ContentHash = ContentHash;
+    Entry.SizeBytes = GetSizeBytes(*Texture);
+    Entry.LastUse = ++UseCounter;
+    CachedBytes += Entry.SizeBytes;
+    PeakBytes = FMath::Max(PeakBytes, CachedBytes);
+    if (0 != ContentHash) {
+        ContentIndex.Add(ContentHash, UrlKey);
+    }
+    TrimToBudget();
+    return Texture;
+}
+
+void FBackgroundTextureCache::Release(UTexture2D * Texture) {
+    FScopeLock ScopeLock(&MutexEntries);
+    ReleaseLocked(Texture);
+}
+
+void FBackgroundTextureCache::SetDisplayed(const UTexture2D * Texture) {
+    FScopeLock ScopeLock(&MutexEntries);
+    Displayed = Texture;
+}
+
+void FBackgroundTextureCache::Pin(const UTexture2D * Texture) {
+    FScopeLock ScopeLock(&MutexEntries);
+    PinCounts.FindOrAdd(Texture)++;
+}
+
+void FBackgroundTextureCache::Unpin(const UTexture2D * Texture) {
+    FScopeLock ScopeLock(&MutexEntries);
+    const auto PinCountPtr = PinCounts.Find(Texture);
+    if ((nullptr != PinCountPtr) && (0 == --*PinCountPtr)) {
+        PinCounts.Remove(Texture);
+    }
+}
+
+void FBackgroundTextureCache::Clear() {
+    FScopeLock ScopeLock(&MutexEntries);
+    TSet<UTexture2D *> Textures;
+    for (const auto & [UrlKey, Entry]: Entries) {
+        Textures.Add(Entry.Texture);
+    }
+    for (const auto & [PoolKey, PooledTextures]: Pool) {
+        Textures.Append(PooledTextures);
+    }
+    for (const auto Texture: Textures) {
+        Texture->RemoveFromRoot();
+    }
+    Entries.Empty();
+    ContentIndex.Empty();
+    Pool.Empty();
+    Displayed = nullptr;
+    PinCounts.Empty();
+    CachedBytes = 0;
+    PooledBytes = 0;
+}
+
+void FBackgroundTextureCache::LogStats() const {
+    FScopeLock ScopeLock(&MutexEntries);
+    const uint64 Lookups = UrlHits + ContentHits + Misses;
+    const double HitRate = 0 == Lookups ? 0.0 : 100.0 * (UrlHits + ContentHits) / Lookups;
+    UE_LOG(LogTemp, Log, InfoCacheStatsFormatted, Entries.Num(), CachedBytes / BytesPerMB, PeakBytes / BytesPerMB,
+            BudgetBytes / BytesPerMB, PooledBytes / BytesPerMB, HitRate, UrlHits, ContentHits, Misses, Evictions,
+            PoolReuses);
+}
+
+// Every mip, both the CPU copy (mip data) and the GPU copy
+//
+int64 FBackgroundTextureCache::GetSizeBytes(const UTexture2D & Texture) {
+    const FTexturePlatformData * PlatformData = Texture.GetPlatformData();
+    int64 SizeBytes = 0;
+    for (const auto & Mip: PlatformData->Mips) {
+        SizeBytes += CalculateImageBytes(Mip.SizeX, Mip.SizeY, 0, PlatformData->PixelFormat);
+    }
+    return 2 * SizeBytes;
+}
+
+FBackgroundTextureCache::FPoolKey FBackgroundTextureCache::GetPoolKey(const UTexture2D & Texture) {
+    return {FIntPoint(Texture.GetSizeX(), Texture.GetSizeY()), Texture.GetPixelFormat(), Texture.GetNumMips()};
+}
+
+// Pools the texture if its resolution (and format) has room; otherwise lets the garbage collector have it
+//
+void FBackgroundTextureCache::ReleaseLocked(UTexture2D * Texture) {
+    for (const auto & [UrlKey, Entry]: Entries) {
+        if (Entry.Texture == Texture) {
+            // Still cached under another URL
+            //
+            return;
+        }
+    }
+    auto & PooledTextures = Pool.FindOrAdd(GetPoolKey(*Texture));
+    if (PooledTextures.Num() < PoolSizePerResolution) {
+        PooledTextures.Add(Texture);
+        PooledBytes += GetSizeBytes(*Texture);
+        return;
+    }
+    Texture->RemoveFromRoot();
+}
+
+// Evicts the least recently used textures (with all their URLs) until the cache fits the budget. The displayed
+// background, the pinned (staged) ones and the most recently added one are kept even if they alone exceed the budget
+//
+void FBackgroundTextureCache::TrimToBudget() {
+    const UTexture2D * MostRecent = nullptr;
+    for (const auto & [UrlKey, Entry]: Entries) {
+        if (Entry.LastUse == UseCounter) {
+            MostRecent = Entry.Texture;
+        }
+    }
+    while (CachedBytes > BudgetBytes) {
+        const FString * OldestUrlKey = nullptr;
+        uint64 OldestUse = UseCounter;
+        for (const auto & [UrlKey, Entry]: Entries) {
+            if ((Entry.Texture != Displayed) && (Entry.Texture != MostRecent) && (! PinCounts.Contains(Entry.Texture))
+                    && (Entry.LastUse < OldestUse)) {
+                OldestUrlKey = &UrlKey;
+                OldestUse = Entry.LastUse;
+            }
+        }
+        if (nullptr == OldestUrlKey) {
+            return;
+        }
+        UTexture2D * Texture = Entries[*OldestUrlKey].Texture;
+        for (auto It = Entries.CreateIterator(); It; ++It) {
+            if (It.Value().Texture == Texture) {
+                CachedBytes -= It.Value().SizeBytes;
+                if (0 != It.Value().ContentHash) {
+                    ContentIndex.Remove(It.Value().ContentHash);
+                }
+                It.RemoveCurrent();
+            }
+        }
+        Evictions++;
+        ReleaseLocked(Texture);
+    }
+}
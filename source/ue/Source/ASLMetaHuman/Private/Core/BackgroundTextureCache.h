@@ -0,0 +1,136 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Keeps decoded background textures for reuse: a background that is shown again (e.g. the image generated for a
+// repeated sentence) is neither downloaded nor decoded again. Entries are found by URL without its query (presigned
+// URLs differ by their signature only) and by the hash of the image file (the same image under another URL skips the
+// decode). The least recently used entries are evicted to stay within a memory budget (neither the displayed background
+// nor the staged ones are evicted); evicted textures are pooled per resolution and the next backgrounds of that size
+// are decoded into them instead of into new textures. Note: an image overwritten under the same URL keeps its cached
+// texture until it's evicted.
+//
+// Note: cached and pooled textures are rooted by the cache; lookups and the pool are safe from any thread, adding and
+// releasing textures happens on the game thread
+//
+
+#include <CoreMinimal.h>
+#include <PixelFormat.h>
+
+class UTexture2D;
+
+namespace ASLMetaHuman::Core {
+
+class FBackgroundTextureCache {
+public:
+    FBackgroundTextureCache(const int64 InBudgetBytes, const int32 InPoolSizePerResolution);
+
+    // Cache key of a background URL: the URL without its query (i.e. without the presigned URL's signature)
+    //
+    static FString ToUrlKey(const FString & Url);
+    static uint64 HashContent(const TArrayView64<const uint8> ImageBytes);
+
+    // Returns the cached texture of a URL, or nullptr (a miss)
+    //
+    UTexture2D * FindByUrl(const FString & UrlKey);
+
+    // Returns the cached texture of an image file (by content hash) and indexes it under UrlKey too, or nullptr
+    //
+    UTexture2D * FindByContent(const uint64 ContentHash, const FString & UrlKey);
+    bool ContainsContent(const uint64 ContentHash) const;
+
+    // Takes a pooled texture of this resolution, pixel format and mip count to decode into (nullptr if there's none)
+    //
+    UTexture2D * AcquirePooled(const int32 Width, const int32 Height, const EPixelFormat Format, const int32 NumMips);
+
+    // Game thread: adds a decoded (rooted) texture and evicts down to the budget. ContentHash 0: unknown (URL only).
+    // Returns the texture to use: the cached one if another load of the same URL was added first (Texture is then
+    // released)
+    //
+    UTexture2D * Add(const FString & UrlKey, const uint64 ContentHash, UTexture2D * Texture);
+
+    // Game thread: returns a texture that isn't cached (e.g. decoded twice concurrently) to the pool, or unroots it
+    //
+    void Release(UTexture2D * Texture);
+
+    // The displayed background is never evicted
+    //
+    void SetDisplayed(const UTexture2D * Texture);
+
+    // A staged background (loaded ahead of its sentence) isn't evicted until it's unpinned; pins are counted
+    //
+    void Pin(const UTexture2D * Texture);
+    void Unpin(const UTexture2D * Texture);
+
+    // Unroots every cached and pooled texture (on shutdown)
+    //
+    void Clear();
+
+    void LogStats() const;
+
+private:
+    struct FEntry {
+        UTexture2D * Texture {nullptr};
+        uint64 ContentHash {0};
+        int64 SizeBytes {0};
+        uint64 LastUse {0};
+    };
+
+    // Pooled textures are interchangeable if their resolution, pixel format and mip count match
+    //
+    struct FPoolKey {
+        FIntPoint Size;
+        EPixelFormat Format;
+        int32 NumMips;
+
+        bool operator==(const FPoolKey & Other) const = default;
+
+        friend uint32 GetTypeHash(const FPoolKey & Key) {
+            return HashCombine(GetTypeHash(Key.Size), HashCombine(GetTypeHash(Key.Format), GetTypeHash(Key.NumMips)));
+        }
+    };
+
+    static int64 GetSizeBytes(const UTexture2D & Texture);
+    static FPoolKey GetPoolKey(const UTexture2D & Texture);
+    void ReleaseLocked(UTexture2D * Texture);
+    void TrimToBudget();
+
+    // Entries by URL key; ContentIndex maps content hashes to one of their URL keys
+    //
+    TMap<FString, FEntry> Entries;
+    TMap<uint64, FString> ContentIndex;
+    TMap<FPoolKey, TArray<UTexture2D *>> Pool;
+    const UTexture2D * Displayed {nullptr};
+    TMap<const UTexture2D *, int32> PinCounts;
+    mutable FCriticalSection MutexEntries;
+    const int64 BudgetBytes;
+    const int32 PoolSizePerResolution;
+    int64 CachedBytes {0};
+    int64 PooledBytes {0};
+    uint64 UseCounter {0};
+
+    // Statistics (reported on shutdown)
+    //
+    uint64 UrlHits {0};
+    uint64 ContentHits {0};
+    uint64 Misses {0};
+    uint64 Evictions {0};
+    uint64 PoolReuses {0};
+    int64 PeakBytes {0};
+};
+}
@@ -0,0 +1,384 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Downloads S3 objects with the CRT S3 client (see CrtS3Downloader.h)
+//
+
+#include "CrtS3Downloader.h"
+#include "Config/GlobalState.h"
+
+#include <aws/auth/signing_config.h>
+#include <aws/common/error.h>
+#include <aws/common/uri.h>
+#include <aws/core/Globals.h>
+#include <aws/crt/Allocator.h>
+#include <aws/crt/auth/Credentials.h>
+#include <aws/crt/io/Bootstrap.h>
+#include <aws/http/request_response.h>
+#include <aws/s3/s3_client.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Core::FCrtS3Download;
+using ASLMetaHuman::Core::FCrtS3Downloader;
+
+namespace {
+// Sizes the connection pool when MaxConnections is 0 (the CRT default for a single large download)
+//
+constexpr double ThroughputTargetGbps {10.0};
+constexpr float ClientShutdownTimeoutSeconds {5.0f};
+constexpr auto & VirtualHostFormatted = TEXT("%s.s3.%s.amazonaws.com");
+constexpr auto & ErrorNoBootstrap = TEXT("CRT S3 client: the AWS SDK isn't initialized");
+constexpr auto & ErrorNoCredentials = TEXT("CRT S3 client: no credentials provider");
+constexpr auto & ErrorEndpointFormatted = TEXT("CRT S3 client: invalid endpoint override %s");
+constexpr auto & ErrorUrlFormatted = TEXT("CRT S3 client: invalid URL %s");
+constexpr auto & ErrorClientFormatted = TEXT("CRT S3 client: creation failed (%s)");
+constexpr auto & ErrorRequestFormatted = TEXT("CRT S3 client: GET %s not started (%s)");
+constexpr auto & ErrorDownloadFormatted = TEXT("%s (HTTP %d)");
+constexpr auto & WarningClientShutdown = TEXT("CRT S3 client still shutting down");
+
+aws_byte_cursor ToCursor(const FTCHARToUTF8 & String) {
+    return aws_byte_cursor_from_array(String.Get(), String.Length());
+}
+
+FString ToString(const aws_byte_cursor & Cursor) {
+    const FUTF8ToTCHAR String(reinterpret_cast<const ANSICHAR *>(Cursor.ptr), static_cast<int32>(Cursor.len));
+    return FString(String.Length(), String.Get());
+}
+
+FString GetLastAwsError() {
+    return UTF8_TO_TCHAR(aws_error_str(aws_last_error()));
+}
+
+// URI-encodes an object key (keeps its '/' separators)
+//
+FString EncodeKey(const FString & Key) {
+    FString EncodedKey;
+    const FTCHARToUTF8 KeyUtf8(*Key);
+    for (int32 i = 0; i < KeyUtf8.Length(); i++) {
+        const ANSICHAR Character = KeyUtf8.Get()[i];
+        if (FChar::IsAlnum(Character) || (nullptr != FCStringAnsi::Strchr("-_.~/", Character))) {
+            EncodedKey.AppendChar(Character);
+        } else {
+            EncodedKey += FString::Printf(TEXT("%%%02X"), static_cast<uint8>(Character));
+        }
+    }
+    return EncodedKey;
+}
+}
+
+FCrtS3Download::FCrtS3Download(const FString & InKey, FOnFinished && InOnFinished):
+    Key {InKey},
+    OnFinished {MoveTemp(InOnFinished)},
+    FinishedEvent {FPlatformProcess::GetSynchEventFromPool(true)} {
+}
+
+FCrtS3Download::~FCrtS3Download() {
+    if (Endpoint.IsValid()) {
+        aws_uri_clean_up(Endpoint.Get());
+    }
+    FPlatformProcess::ReturnSynchEventToPool(FinishedEvent);
+    FinishedEvent = nullptr;
+}
+
+bool FCrtS3Download::Wait(const float TimeoutSeconds) {
+    if (! FinishedEvent->Wait(FTimespan::FromSeconds(TimeoutSeconds))) {
+        // Note: a cancelled meta request finishes right away
+        //
+        Cancel();
+        FinishedEvent->Wait();
+    }
+    return Succeeded();
+}
+
+void FCrtS3Download::Cancel() {
+    FScopeLock Lock(&Mutex);
+    if (nullptr != MetaRequest) {
+        Cancelled = true;
+        aws_s3_meta_request_cancel(MetaRequest);
+    }
+}
+
+FString FCrtS3Download::GetError() const {
+    if ((! Finished) || (0 == ErrorCode)) {
+        return FString();
+    }
+    return FString::Printf(ErrorDownloadFormatted, UTF8_TO_TCHAR(aws_error_str(ErrorCode)), ResponseStatus);
+}
+
+// Called once, with the first part's response headers: its Content-Length is the object size (the client rewrites the
+// headers of a split GET), so the body is allocated once instead of growing with each part
+//
+int FCrtS3Download::OnHeaders(const aws_http_headers & Headers, FCrtS3Download & Download) {
+    aws_byte_cursor ContentLength {};
+    uint64 Size = 0;
+    if ((AWS_OP_SUCCESS == aws_http_headers_get(&Headers, aws_byte_cursor_from_c_str("Content-Length"), &ContentLength))
+            && (AWS_OP_SUCCESS == aws_byte_cursor_utf8_parse_u64(ContentLength, &Size))) {
+        Download.ObjectSize = static_cast<int64>(Size);
+        Download.Body.SetNumUninitialized(static_cast<int64>(Size), false);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+// Parts arrive in order; RangeStart is their offset in the object. Aborting the demo cancels the download
+//
+int FCrtS3Download::OnBody(aws_s3_meta_request *, const void * Data, const uint64 Size, const uint64 RangeStart,
+        FCrtS3Download & Download) {
+    if (FGlobalState::IsAborting()) {
+        return aws_raise_error(AWS_ERROR_S3_CANCELED);
+    }
+    const int64 End = static_cast<int64>(RangeStart + Size);
+    if (Download.Body.Num() < End) {
+        Download.Body.SetNumUninitialized(End, false);
+    }
+    FMemory::Memcpy(Download.Body.GetData() + RangeStart, Data, Size);
+    Download.ReceivedBytes += static_cast<int64>(Size);
+    return AWS_OP_SUCCESS;
+}
+
+void FCrtS3Download::OnFinish(const aws_s3_meta_request_result & Result, FCrtS3Download & Download) {
+    FOnFinished Callback;
+    {
+        FScopeLock Lock(&Download.Mutex);
+        Download.ErrorCode = Result.error_code;
+        Download.ResponseStatus = Result.response_status;
+        if (0 != Download.ErrorCode) {
+            Download.Body.Empty();
+        }
+        // Note: the client holds its own reference until the meta request is cleaned up (then OnShutdown())
+        //
+        aws_s3_meta_request_release(Download.MetaRequest);
+        Download.MetaRequest = nullptr;
+        Download.Finished = true;
+        Download.FinishedEvent->Trigger();
+        // Note: the callback is dropped once called (it may hold a reference to the download)
+        //
+        Callback = MoveTemp(Download.OnFinished);
+        Download.OnFinished = nullptr;
+    }
+    if (Callback) {
+        Callback(Download);
+    }
+}
+
+// Last callback of a meta request: may delete the download
+//
+void FCrtS3Download::OnShutdown(FCrtS3Download & Download) {
+    Download.Self.Reset();
+}
+
+FCrtS3Downloader::FCrtS3Downloader(const FOptions & InOptions):
+    ClientShutdownEvent {FPlatformProcess::GetSynchEventFromPool(true)},
+    Region {TCHAR_TO_UTF8(*InOptions.Region)} {
+    const auto Bootstrap = Aws::GetDefaultClientBootstrap();
+    if (nullptr == Bootstrap) {
+        UE_LOG(LogTemp, Error, ErrorNoBootstrap);
+        return;
+    }
+    if (InOptions.SignRequests) {
+        Aws::Crt::Auth::CredentialsProviderChainDefaultConfig ProviderConfig;
+        ProviderConfig.Bootstrap = Bootstrap;
+        CredentialsProvider =
+                Aws::Crt::Auth::CredentialsProvider::CreateCredentialsProviderChainDefault(ProviderConfig);
+        if ((nullptr == CredentialsProvider) || (! CredentialsProvider->IsValid())) {
+            UE_LOG(LogTemp, Error, ErrorNoCredentials);
+            return;
+        }
+    }
+    bool UseTls = true;
+    if (! InOptions.EndpointOverride.IsEmpty()) {
+        Endpoint = MakeUnique<aws_uri>();
+        const FTCHARToUTF8 EndpointUtf8(*InOptions.EndpointOverride);
+        const aws_byte_cursor EndpointCursor = ToCursor(EndpointUtf8);
+        if (AWS_OP_SUCCESS != aws_uri_init_parse(Endpoint.Get(), Aws::Crt::ApiAllocator(), &EndpointCursor)) {
+            Endpoint.Reset();
+            UE_LOG(LogTemp, Error, ErrorEndpointFormatted, *InOptions.EndpointOverride);
+            return;
+        }
+        UseTls = ! aws_byte_cursor_eq_c_str_ignore_case(aws_uri_scheme(Endpoint.Get()), "http");
+        Host = ToString(*aws_uri_authority(Endpoint.Get()));
+    }
+    aws_signing_config_aws SigningConfig;
+    if (InOptions.SignRequests) {
+        aws_s3_init_default_signing_config(
+                &SigningConfig, aws_byte_cursor_from_c_str(Region.c_str()), CredentialsProvider->GetUnderlyingHandle());
+    }
+    aws_s3_client_config ClientConfig {};
+    ClientConfig.region = aws_byte_cursor_from_c_str(Region.c_str());
+    ClientConfig.client_bootstrap = Bootstrap->GetUnderlyingHandle();
+    ClientConfig.tls_mode = UseTls ? AWS_MR_TLS_ENABLED : AWS_MR_TLS_DISABLED;
+    ClientConfig.signing_config = InOptions.SignRequests ? &SigningConfig : nullptr;
+    ClientConfig.part_size = InOptions.PartSize;
+    ClientConfig.throughput_target_gbps = ThroughputTargetGbps;
+    ClientConfig.max_active_connections_override = InOptions.MaxConnections;
+    ClientConfig.connect_timeout_ms = InOptions.ConnectTimeoutMs;
+    ClientConfig.shutdown_callback = [](void * UserData) {
+        static_cast<FEvent *>(UserData)->Trigger();
+    };
+    ClientConfig.shutdown_callback_user_data = ClientShutdownEvent;
+    Client = aws_s3_client_new(Aws::Crt::ApiAllocator(), &ClientConfig);
+    if (nullptr == Client) {
+        UE_LOG(LogTemp, Error, ErrorClientFormatted, *GetLastAwsError());
+    }
+}
+
+// Note: downloads still in flight keep the client alive; they're expected to be finished (or cancelled) by now
+//
+FCrtS3Downloader::~FCrtS3Downloader() {
+    bool ShutDown = true;
+    if (nullptr != Client) {
+        aws_s3_client_release(Client);
+        Client = nullptr;
+        ShutDown = ClientShutdownEvent->Wait(FTimespan::FromSeconds(ClientShutdownTimeoutSeconds));
+        if (! ShutDown) {
+            UE_LOG(LogTemp, Warning, WarningClientShutdown);
+        }
+    }
+    if (Endpoint.IsValid()) {
+        aws_uri_clean_up(Endpoint.Get());
+    }
+    // Note: the event is leaked if the client may still signal it
+    //
+    if (ShutDown) {
+        FPlatformProcess::ReturnSynchEventToPool(ClientShutdownEvent);
+    }
+    ClientShutdownEvent = nullptr;
+}
+
+// The endpoint override is addressed path-style (/Bucket/Key); AWS virtual-hosted style (Bucket.s3.Region host)
+//
+TSharedPtr<FCrtS3Download> FCrtS3Downloader::Get(const FString & Bucket,
+        const FString & Key,
+        FCrtS3Download::FOnFinished && OnFinished) const {
+    if (nullptr == Client) {
+        return nullptr;
+    }
+    const FString & RequestHost = Endpoint.IsValid()
+            ? Host
+            : FString::Printf(VirtualHostFormatted, *Bucket, UTF8_TO_TCHAR(Region.c_str()));
+    const FString & RequestPath =
+            Endpoint.IsValid() ? TEXT("/") + Bucket + TEXT("/") + EncodeKey(Key) : TEXT("/") + EncodeKey(Key);
+    const FTCHARToUTF8 HostUtf8(*RequestHost);
+    const FTCHARToUTF8 PathUtf8(*RequestPath);
+    aws_http_message * Message = aws_http_message_new_request(Aws::Crt::ApiAllocator());
+    if (nullptr == Message) {
+        return nullptr;
+    }
+    aws_http_message_set_request_method(Message, aws_http_method_get);
+    aws_http_message_set_request_path(Message, ToCursor(PathUtf8));
+    aws_http_header HostHeader {};
+    HostHeader.name = aws_byte_cursor_from_c_str("Host");
+    HostHeader.value = ToCursor(HostUtf8);
+    aws_http_message_add_header(Message, HostHeader);
+    return MakeMetaRequest(*Message, Endpoint.Get(), MakeShareable(new FCrtS3Download(Key, MoveTemp(OnFinished))));
+}
+
+// The URL's path and query (i.e. its signature) are sent as-is to its host; its scheme selects TLS. Ranged part GETs
+// are fine for a presigned GET (the Range header isn't part of its signature)
+//
+TSharedPtr<FCrtS3Download> FCrtS3Downloader::GetUrl(const FString & Url,
+        FCrtS3Download::FOnFinished && OnFinished) const {
+    if (nullptr == Client) {
+        return nullptr;
+    }
+    FString Key;
+    if (! Url.Split(TEXT("?"), &Key, nullptr)) {
+        Key = Url;
+    }
+    const TSharedRef<FCrtS3Download> Download = MakeShareable(new FCrtS3Download(Key, MoveTemp(OnFinished)));
+    Download->Endpoint = MakeUnique<aws_uri>();
+    const FTCHARToUTF8 UrlUtf8(*Url);
+    const aws_byte_cursor UrlCursor = ToCursor(UrlUtf8);
+    if (AWS_OP_SUCCESS != aws_uri_init_parse(Download->Endpoint.Get(), Aws::Crt::ApiAllocator(), &UrlCursor)) {
+        Download->Endpoint.Reset();
+        UE_LOG(LogTemp, Error, ErrorUrlFormatted, *Key);
+        return nullptr;
+    }
+    aws_http_message * Message = aws_http_message_new_request(Aws::Crt::ApiAllocator());
+    if (nullptr == Message) {
+        return nullptr;
+    }
+    const aws_byte_cursor * PathAndQuery = aws_uri_path_and_query(Download->Endpoint.Get());
+    aws_http_message_set_request_method(Message, aws_http_method_get);
+    aws_http_message_set_request_path(
+            Message, 0 == PathAndQuery->len ? aws_byte_cursor_from_c_str("/") : *PathAndQuery);
+    aws_http_header HostHeader {};
+    HostHeader.name = aws_byte_cursor_from_c_str("Host");
+    HostHeader.value = *aws_uri_authority(Download->Endpoint.Get());
+    aws_http_message_add_header(Message, HostHeader);
+    return MakeMetaRequest(*Message, Download->Endpoint.Get(), Download);
+}
+
+void FCrtS3Downloader::CancelAll() const {
+    FScopeLock Lock(&MutexDownloads);
+    for (const auto & WeakDownload: Downloads) {
+        if (const auto Download = WeakDownload.Pin()) {
+            Download->Cancel();
+        }
+    }
+    Downloads.Empty();
+}
+
+// Starts the GET described by Message (released here); tracks the download for CancelAll()
+//
+TSharedPtr<FCrtS3Download> FCrtS3Downloader::MakeMetaRequest(aws_http_message & Message,
+        aws_uri * RequestEndpoint,
+        const TSharedRef<FCrtS3Download> & Download) const {
+    aws_s3_meta_request_options Options {};
+    Options.type = AWS_S3_META_REQUEST_TYPE_GET_OBJECT;
+    Options.message = &Message;
+    Options.endpoint = RequestEndpoint;
+    Options.user_data = &Download.Get();
+    Options.headers_callback = [](aws_s3_meta_request *, const aws_http_headers * Headers, int, void * UserData) {
+        return FCrtS3Download::OnHeaders(*Headers, *static_cast<FCrtS3Download *>(UserData));
+    };
+    Options.body_callback = [](aws_s3_meta_request * Request, const aws_byte_cursor * Body, const uint64_t RangeStart,
+                                    void * UserData) {
+        return FCrtS3Download::OnBody(
+                Request, Body->ptr, Body->len, RangeStart, *static_cast<FCrtS3Download *>(UserData));
+    };
+    Options.finish_callback = [](aws_s3_meta_request *, const aws_s3_meta_request_result * Result, void * UserData) {
+        FCrtS3Download::OnFinish(*Result, *static_cast<FCrtS3Download *>(UserData));
+    };
+    Options.shutdown_callback = [](void * UserData) {
+        FCrtS3Download::OnShutdown(*static_cast<FCrtS3Download *>(UserData));
+    };
+    Download->Self = Download;
+    aws_s3_meta_request * MetaRequest = nullptr;
+    {
+        // Note: the meta request may finish (and clear MetaRequest) as soon as the lock is released
+        //
+        FScopeLock Lock(&Download->Mutex);
+        MetaRequest = aws_s3_client_make_meta_request(Client, &Options);
+        Download->MetaRequest = MetaRequest;
+    }
+    // Note: the meta request holds its own reference to the message
+    //
+    aws_http_message_release(&Message);
+    if (nullptr == MetaRequest) {
+        UE_LOG(LogTemp, Error, ErrorRequestFormatted, *Download->GetKey(), *GetLastAwsError());
+        Download->Self.Reset();
+        return nullptr;
+    }
+    FScopeLock Lock(&MutexDownloads);
+    Downloads.RemoveAll([](const TWeakPtr<FCrtS3Download> & WeakDownload) {
+        const auto Download = WeakDownload.Pin();
+        return (! Download.IsValid()) || Download->IsFinished();
+    });
+    Downloads.Add(Download);
+    return Download;
+}
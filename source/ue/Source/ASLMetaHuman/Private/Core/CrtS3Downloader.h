@@ -0,0 +1,190 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Downloads S3 objects with the CRT S3 client (aws-c-s3): a GET is split into ranged part GETs (PartSize) that run in
+// parallel over a pool of connections shared by every download of the client, with failed parts retried. Works
+// against S3-compatible stand-ins (e.g. MinIO) through an endpoint override: path-style addressing, no TLS for
+// http:// endpoints. Credentials come from the default chain (environment, profile, instance metadata). Presigned URLs
+// are downloaded the same way by a client that doesn't sign its requests (see GetUrl()).
+//
+
+#include <CoreMinimal.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+struct aws_s3_client;
+struct aws_s3_meta_request;
+struct aws_s3_meta_request_result;
+struct aws_http_headers;
+struct aws_http_message;
+struct aws_uri;
+
+namespace Aws::Crt::Auth {
+class ICredentialsProvider;
+}
+
+namespace ASLMetaHuman::Core {
+
+// One GET in flight (or done). Callbacks run on the CRT event loop threads; the body is only read once finished
+//
+class FCrtS3Download {
+public:
+    // Called once the download finished (succeeded, failed or cancelled), on a CRT event loop thread
+    //
+    using FOnFinished = TFunction<void(FCrtS3Download & Download)>;
+
+    ~FCrtS3Download();
+
+    // Waits up to TimeoutSeconds for the download to finish; cancels it on timeout. Returns true if it succeeded
+    //
+    bool Wait(const float TimeoutSeconds);
+    void Cancel();
+
+    bool IsFinished() const {
+        return Finished;
+    }
+
+    bool Succeeded() const {
+        return Finished && (0 == ErrorCode);
+    }
+
+    // Whether Cancel() was called (e.g. on timeout) before the download finished
+    //
+    bool IsCancelled() const {
+        return Cancelled;
+    }
+
+    // Bytes received so far, and the object size once the first part's response arrived (0 before)
+    //
+    int64 GetReceivedBytes() const {
+        return ReceivedBytes;
+    }
+
+    int64 GetObjectSize() const {
+        return ObjectSize;
+    }
+
+    // HTTP status of the (failed) response; 0 if there was none
+    //
+    int32 GetResponseStatus() const {
+        return ResponseStatus;
+    }
+
+    FString GetError() const;
+
+    const FString & GetKey() const {
+        return Key;
+    }
+
+    // Note: only valid once finished
+    //
+    TArray64<uint8> & GetBody() {
+        return Body;
+    }
+
+private:
+    friend class FCrtS3Downloader;
+
+    FCrtS3Download(const FString & InKey, FOnFinished && InOnFinished);
+
+    static int OnHeaders(const aws_http_headers & Headers, FCrtS3Download & Download);
+    static int OnBody(aws_s3_meta_request * Request, const void * Data, const uint64 Size, const uint64 RangeStart,
+            FCrtS3Download & Download);
+    static void OnFinish(const aws_s3_meta_request_result & Result, FCrtS3Download & Download);
+    static void OnShutdown(FCrtS3Download & Download);
+
+    FString Key;
+    FOnFinished OnFinished;
+    FCriticalSection Mutex;
+    aws_s3_meta_request * MetaRequest {nullptr};
+    // Host of a presigned URL download (see FCrtS3Downloader::GetUrl())
+    //
+    TUniquePtr<aws_uri> Endpoint;
+    // Keeps the download alive until the meta request has shut down (its callbacks may outlive the caller's reference)
+    //
+    TSharedPtr<FCrtS3Download> Self;
+    TArray64<uint8> Body;
+    FEvent * FinishedEvent {nullptr};
+    std::atomic<bool> Finished {false};
+    std::atomic<bool> Cancelled {false};
+    std::atomic<int64> ReceivedBytes {0};
+    std::atomic<int64> ObjectSize {0};
+    int32 ErrorCode {0};
+    int32 ResponseStatus {0};
+};
+
+class FCrtS3Downloader {
+public:
+    struct FOptions {
+        FString Region;
+        // e.g. "http://localhost:9000" for a local stand-in; "" uses AWS
+        //
+        FString EndpointOverride;
+        uint64 PartSize {8 * 1024 * 1024};
+        // 0 lets the client size its connection pool from its throughput target
+        //
+        uint32 MaxConnections {0};
+        uint32 ConnectTimeoutMs {3000};
+        // false for presigned URLs (see GetUrl()): they carry their own signature, no credentials are needed
+        //
+        bool SignRequests {true};
+    };
+
+    explicit FCrtS3Downloader(const FOptions & InOptions);
+    ~FCrtS3Downloader();
+
+    // Returns false if the client couldn't be created (e.g. the AWS SDK isn't initialized or the endpoint is invalid)
+    //
+    bool IsValid() const {
+        return nullptr != Client;
+    }
+
+    // Starts downloading Bucket/Key. Returns nullptr if the request couldn't be started
+    //
+    TSharedPtr<FCrtS3Download> Get(const FString & Bucket,
+            const FString & Key,
+            FCrtS3Download::FOnFinished && OnFinished = nullptr) const;
+
+    // Starts downloading a presigned S3 URL (or any URL whose server accepts ranged GETs) as-is, from its own host.
+    // Needs a client that doesn't sign its requests (SignRequests false). Returns nullptr if the request couldn't be
+    // started
+    //
+    TSharedPtr<FCrtS3Download> GetUrl(const FString & Url, FCrtS3Download::FOnFinished && OnFinished = nullptr) const;
+
+    // Cancels every download of this client that is still in flight (e.g. on STOP)
+    //
+    void CancelAll() const;
+
+private:
+    TSharedPtr<FCrtS3Download> MakeMetaRequest(aws_http_message & Message,
+            aws_uri * RequestEndpoint,
+            const TSharedRef<FCrtS3Download> & Download) const;
+
+    aws_s3_client * Client {nullptr};
+    std::shared_ptr<Aws::Crt::Auth::ICredentialsProvider> CredentialsProvider;
+    TUniquePtr<aws_uri> Endpoint;
+    FEvent * ClientShutdownEvent {nullptr};
+    std::string Region;
+    FString Host;
+    mutable TArray<TWeakPtr<FCrtS3Download>> Downloads;
+    mutable FCriticalSection MutexDownloads;
+};
+}
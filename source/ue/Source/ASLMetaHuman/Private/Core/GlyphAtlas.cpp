@@ -0,0 +1,121 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Pre-rasterized glyphs for the fingerspelling overlay (see GlyphAtlas.h)
+//
+
+#include "GlyphAtlas.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Engine.h>
+#include <Engine/Canvas.h>
+#include <Engine/TextureRenderTarget2D.h>
+#include <Fonts/FontMeasure.h>
+#include <Framework/Application/SlateApplication.h>
+#include <Kismet/KismetRenderingLibrary.h>
+
+using ASLMetaHuman::Core::FGlyphAtlas;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+constexpr auto & InfoGlyphAtlasFormatted = TEXT("Glyph atlas: %d glyphs at %d pt in %dx%d, rasterized in %.1f ms");
+}
+
+// The glyphs are drawn white on black into a render target, which is read back once: its red channel becomes the
+// alpha of a white texture (a render target's alpha isn't reliable coverage after canvas text drawing)
+//
+TSharedPtr<const FGlyphAtlas> FGlyphAtlas::Create(const UFont * Font,
+        const int32 FontSize,
+        const FString & Characters) {
+    TWeakObjectPtr<UWorld> WorldPtr;
+    if ((nullptr == Font) || (! FSlateApplication::IsInitialized()) || (! UnrealAPI::GetWorld(WorldPtr))) {
+        return nullptr;
+    }
+    const double StartSeconds = FPlatformTime::Seconds();
+    const FSlateFontInfo FontInfo(Font, FontSize);
+    const auto FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+    const auto Atlas = MakeShared<FGlyphAtlas>();
+    Atlas->LineHeight = FontMeasure->GetMaxCharacterHeight(FontInfo);
+    Atlas->SpaceAdvance = FontMeasure->Measure(TEXT(" "), FontInfo).X;
+    TArray<TCHAR> Unique;
+    for (TCHAR Character = TEXT('A'); Character <= TEXT('Z'); Character++) {
+        Unique.AddUnique(Character);
+    }
+    for (const TCHAR Character: Characters) {
+        if ((! FChar::IsWhitespace(Character)) && (TEXT('_') != Character)) {
+            Unique.AddUnique(Character);
+        }
+    }
+    // Cells are laid out in rows of the atlas width
+    //
+    const FIntPoint PaddingOffset(Padding, Padding);
+    const int32 CellHeight = FMath::CeilToInt(Atlas->LineHeight) + 2 * Padding;
+    TArray<FIntPoint> Cells;
+    int32 X = 0;
+    int32 Y = 0;
+    for (const TCHAR Character: Unique) {
+        auto & Glyph = Atlas->Glyphs.Add(Character);
+        Glyph.Advance = FontMeasure->Measure(FString(1, &Character), FontInfo).X;
+        const int32 CellWidth = FMath::CeilToInt(Glyph.Advance) + 2 * Padding;
+        if (X + CellWidth > Width) {
+            X = 0;
+            Y += CellHeight;
+        }
+        Cells.Add(FIntPoint(X, Y));
+        Glyph.Brush.ImageSize = FVector2D(CellWidth - 2 * Padding, CellHeight - 2 * Padding);
+        X += CellWidth;
+    }
+    const int32 Height = static_cast<int32>(FMath::RoundUpToPowerOfTwo(Y + CellHeight));
+    auto RenderTarget = NewObject<UTextureRenderTarget2D>();
+    RenderTarget->RenderTargetFormat = RTF_RGBA8;
+    RenderTarget->ClearColor = FLinearColor::Black;
+    RenderTarget->InitAutoFormat(Width, Height);
+    RenderTarget->UpdateResourceImmediate(true);
+    UCanvas * Canvas;
+    FVector2D CanvasSize;
+    FDrawToRenderTargetContext Context;
+    UKismetRenderingLibrary::BeginDrawCanvasToRenderTarget(WorldPtr.Get(), RenderTarget, Canvas, CanvasSize, Context);
+    for (int32 i = 0; i < Unique.Num(); i++) {
+        FCanvasTextItem TextItem(FVector2D(Cells[i] + PaddingOffset), FText::FromString(FString(1, &Unique[i])),
+                FontInfo, FLinearColor::White);
+        Canvas->DrawItem(TextItem);
+    }
+    UKismetRenderingLibrary::EndDrawCanvasToRenderTarget(WorldPtr.Get(), Context);
+    TArray<FColor> Pixels;
+    if (! RenderTarget->GameThread_GetRenderTargetResource()->ReadPixels(Pixels)) {
+        return nullptr;
+    }
+    for (auto & Pixel: Pixels) {
+        Pixel = FColor(255, 255, 255, Pixel.R);
+    }
+    Atlas->Texture.Reset(UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8));
+    Atlas->Texture->LODGroup = TEXTUREGROUP_UI;
+    auto & Mip = Atlas->Texture->GetPlatformData()->Mips[0];
+    FMemory::Memcpy(Mip.BulkData.Lock(LOCK_READ_WRITE), Pixels.GetData(), Pixels.Num() * sizeof(FColor));
+    Mip.BulkData.Unlock();
+    Atlas->Texture->UpdateResource();
+    for (int32 i = 0; i < Unique.Num(); i++) {
+        auto & Brush = Atlas->Glyphs[Unique[i]].Brush;
+        const FVector2f Min = FVector2f(Cells[i] + PaddingOffset) / FVector2f(Width, Height);
+        Brush.SetResourceObject(Atlas->Texture.Get());
+        Brush.SetUVRegion(FBox2f(Min, Min + FVector2f(Brush.ImageSize) / FVector2f(Width, Height)));
+    }
+    UE_LOG(LogTemp, Log, InfoGlyphAtlasFormatted, Unique.Num(), FontSize, Width, Height,
+            (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    return Atlas;
+}
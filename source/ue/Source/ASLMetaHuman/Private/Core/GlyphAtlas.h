@@ -0,0 +1,72 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Pre-rasterized glyphs for the fingerspelling overlay (the HUD's letter slot): A-Z and the characters of the sign
+// labels are drawn once, at startup and at the overlay's font size, into one texture. The overlay then draws a label as
+// one textured quad per glyph (see SGlyphText), so switching letters costs no font shaping, rasterization or text
+// layout. The glyphs are white (coverage in alpha) and tinted when drawn; labels are drawn without kerning.
+//
+
+#include <CoreMinimal.h>
+#include <Styling/SlateBrush.h>
+#include <UObject/StrongObjectPtr.h>
+
+class UFont;
+class UTexture2D;
+
+namespace ASLMetaHuman::Core {
+
+class FGlyphAtlas {
+public:
+    struct FGlyph {
+        // The glyph's cell of the atlas texture (ImageSize is the cell's size)
+        //
+        FSlateBrush Brush;
+        float Advance {0.0f};
+    };
+
+    // Game thread: rasterizes A-Z and Characters (whitespace only advances) with Font at FontSize. Returns nullptr if
+    // it can't (e.g. no font, world or Slate renderer)
+    //
+    static TSharedPtr<const FGlyphAtlas> Create(const UFont * Font, const int32 FontSize, const FString & Characters);
+
+    // Returns nullptr if the atlas has no glyph for Character
+    //
+    const FGlyph * Find(const TCHAR Character) const {
+        return Glyphs.Find(Character);
+    }
+
+    float GetLineHeight() const {
+        return LineHeight;
+    }
+
+    float GetSpaceAdvance() const {
+        return SpaceAdvance;
+    }
+
+private:
+    static constexpr int32 Width = 2048;
+    static constexpr int32 Padding = 2;
+
+    TMap<TCHAR, FGlyph> Glyphs;
+    TStrongObjectPtr<UTexture2D> Texture;
+    float LineHeight {0.0f};
+    float SpaceAdvance {0.0f};
+};
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Retained-mode HUD of a session (see HudOverlay.h)
+//
+
+#include "HudOverlay.h"
+#include "Config/GlobalState.h"
+#include "SGlyphText.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Async/Async.h>
+#include <Engine.h>
+#include <SlateBasics.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Core::EHudSlot;
+using ASLMetaHuman::Core::FHudOverlay;
+using ASLMetaHuman::Core::FTimerWheel;
+using ASLMetaHuman::Core::SGlyphText;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+constexpr int32 HighZOrder = 9999;
+constexpr auto & InfoHudStatsFormatted = TEXT("Session %d HUD, sentence %llu: %u slot update(s) in %u frame(s), %u text change(s), %u glyph change(s), %u widget(s) created; %.3f ms on the game thread");
+}
+
+FHudOverlay::FHudOverlay(const UFont * InFont, const TStaticArray<int32, NumSlots> & InFontSizes):
+    Font(InFont),
+    FontSizes(InFontSizes),
+    ExpiryOwner(MakeShared<FExpiryOwner, ESPMode::ThreadSafe>()) {
+    for (auto & Sequence: Sequences) {
+        Sequence = 0;
+    }
+    ExpiryOwner->Hud = this;
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FHudOverlay::Tick));
+}
+
+// The widgets hold no reference to this object (their fonts are copies), so they can be removed after it's gone
+//
+FHudOverlay::~FHudOverlay() {
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    {
+        FScopeLock ScopeLock(&ExpiryOwner->Mutex);
+        ExpiryOwner->Hud = nullptr;
+    }
+    {
+        FScopeLock ScopeLock(&MutexPending);
+        for (auto & ExpiryTimer: ExpiryTimers) {
+            FTimerWheel::Cancel(ExpiryTimer);
+        }
+    }
+    if (nullptr == Overlay) {
+        return;
+    }
+    auto RemoveWidgets = [Client = ViewportClient, Player = LocalPlayer, Widget = Overlay.ToSharedRef()]() {
+        if ((nullptr != Client) && (nullptr != Player)) {
+            Client->RemoveViewportWidgetForPlayer(Player.Get(), Widget);
+        }
+    };
+    if (IsInGameThread()) {
+        RemoveWidgets();
+    } else {
+        AsyncTask(ENamedThreads::GameThread, MoveTemp(RemoveWidgets));
+    }
+}
+
+void FHudOverlay::Show(const EHudSlot Slot,
+        const FString & Text,
+        const FVector2D & Location,
+        const FColor & Color,
+        const float DurationSeconds) {
+    if (Text.IsEmpty() || (nullptr == Font) || FGlobalState::IsAborting()) {
+        return;
+    }
+    Queue(Slot, {true, Text, Location, FLinearColor(Color)}, DurationSeconds);
+}
+
+void FHudOverlay::Hide(const EHudSlot Slot) {
+    Queue(Slot, FUpdate());
+}
+
+void FHudOverlay::HideAll() {
+    for (int32 i = 0; i < NumSlots; i++) {
+        Hide(static_cast<EHudSlot>(i));
+    }
+}
+
+void FHudOverlay::LogStats(const int32 SessionIndex, const uint64 SentenceIndex) {
+    FScopeLock ScopeLock(&MutexStats);
+    UE_LOG(LogTemp, Log, InfoHudStatsFormatted, SessionIndex, SentenceIndex, Stats.Updates, Stats.Frames,
+            Stats.TextChanges, Stats.GlyphChanges, Stats.WidgetsCreated, Stats.GameThreadSeconds * 1000.0);
+    Stats = FStats();
+}
+
+// A later update of the slot (in the same frame) replaces this one, and cancels its expiry
+//
+void FHudOverlay::Queue(const EHudSlot Slot, FUpdate && Update, const float DurationSeconds) {
+    const int32 i = static_cast<int32>(Slot);
+    FScopeLock ScopeLock(&MutexPending);
+    Pending[i] = MoveTemp(Update);
+    const uint64 Sequence = ++Sequences[i];
+    FTimerWheel::Cancel(ExpiryTimers[i]);
+    if (FLT_MAX != DurationSeconds) {
+        ExpiryTimers[i] = FTimerWheel::Schedule(DurationSeconds, [Owner = ExpiryOwner, Slot, Sequence]() {
+            FScopeLock ScopeLock(&Owner->Mutex);
+            if (nullptr != Owner->Hud) {
+                Owner->Hud->Expire(Slot, Sequence);
+            }
+        });
+    }
+}
+
+// Game thread (timer wheel): hides the slot unless it was updated since
+//
+void FHudOverlay::Expire(const EHudSlot Slot, const uint64 Sequence) {
+    const int32 i = static_cast<int32>(Slot);
+    FScopeLock ScopeLock(&MutexPending);
+    if (Sequences[i] == Sequence) {
+        Pending[i] = FUpdate();
+        ExpiryTimers[i] = FTimerWheel::FHandle();
+    }
+}
+
+void FHudOverlay::SetGlyphAtlas(const EHudSlot Slot, const TSharedRef<const FGlyphAtlas> & Atlas) {
+    auto & SlotState = Slots[static_cast<int32>(Slot)];
+    SlotState.Atlas = Atlas;
+    if ((nullptr != Overlay) && (nullptr == SlotState.GlyphText)) {
+        AddGlyphText(SlotState);
+    }
+}
+
+// Game thread, every frame: applies the slots' latest updates. Updates wait while the viewport isn't there yet
+//
+bool FHudOverlay::Tick(float DeltaTime) {
+    const double StartSeconds = FPlatformTime::Seconds();
+    if ((nullptr == Overlay) && (! CreateWidgets())) {
+        return true;
+    }
+    TStaticArray<TOptional<FUpdate>, NumSlots> Updates;
+    {
+        FScopeLock ScopeLock(&MutexPending);
+        for (int32 i = 0; i < NumSlots; i++) {
+            Updates[i] = MoveTemp(Pending[i]);
+            Pending[i].Reset();
+        }
+    }
+    uint32 NumUpdates = 0;
+    uint32 NumTextChanges = 0;
+    uint32 NumGlyphChanges = 0;
+    for (int32 i = 0; i < NumSlots; i++) {
+        if (Updates[i].IsSet()) {
+            Apply(Slots[i], MoveTemp(Updates[i].GetValue()), NumTextChanges, NumGlyphChanges);
+            NumUpdates++;
+        }
+    }
+    if (0 != NumUpdates) {
+        FScopeLock ScopeLock(&MutexStats);
+        Stats.Frames++;
+        Stats.Updates += NumUpdates;
+        Stats.TextChanges += NumTextChanges;
+        Stats.GlyphChanges += NumGlyphChanges;
+        Stats.GameThreadSeconds += FPlatformTime::Seconds() - StartSeconds;
+    }
+    return true;
+}
+
+// Game thread: adds the slots' widgets to the viewport, hidden. Returns false if there's no viewport (yet)
+//
+bool FHudOverlay::CreateWidgets() {
+    TWeakObjectPtr<UWorld> WorldPtr;
+    if ((nullptr == Font) || (! UnrealAPI::GetWorld(WorldPtr))) {
+        return false;
+    }
+    const auto Client = WorldPtr->GetGameViewport();
+    if (nullptr == Client) {
+        return false;
+    }
+    SAssignNew(Overlay, SOverlay).Visibility(EVisibility::HitTestInvisible);
+    for (int32 i = 0; i < NumSlots; i++) {
+        Overlay->AddSlot().HAlign(HAlign_Left).VAlign(VAlign_Top)[SAssignNew(Slots[i].TextBlock, STextBlock)
+                        .Font(FSlateFontInfo(Font, FontSizes[i]))
+                        .ColorAndOpacity(FLinearColor::White)
+                        .Visibility(EVisibility::Collapsed)];
+        if (nullptr != Slots[i].Atlas) {
+            AddGlyphText(Slots[i]);
+        }
+    }
+    ViewportClient = Client;
+    LocalPlayer = WorldPtr->GetFirstLocalPlayerFromController();
+    Client->AddViewportWidgetForPlayer(LocalPlayer.Get(), Overlay.ToSharedRef(), HighZOrder);
+    FScopeLock ScopeLock(&MutexStats);
+    Stats.WidgetsCreated += NumSlots + 1;
+    return true;
+}
+
+// The glyph text starts hidden, with the slot's current color and location
+//
+void FHudOverlay::AddGlyphText(FSlotState & SlotState) {
+    Overlay->AddSlot().HAlign(HAlign_Left).VAlign(VAlign_Top)[SAssignNew(SlotState.GlyphText, SGlyphText,
+            SlotState.Atlas.ToSharedRef()).Visibility(EVisibility::Collapsed)];
+    SlotState.GlyphText->SetColor(SlotState.Applied.Color);
+    SlotState.GlyphText->SetRenderTransform(FSlateRenderTransform(FVector2f(SlotState.Applied.Location)));
+    FScopeLock ScopeLock(&MutexStats);
+    Stats.WidgetsCreated++;
+}
+
+// Changes only what differs from what the slot shows. Both of its widgets follow the color and location, so that
+// switching between them only changes their visibility
+//
+void FHudOverlay::Apply(FSlotState & SlotState, FUpdate && Update, uint32 & TextChanges, uint32 & GlyphChanges) {
+    auto & Applied = SlotState.Applied;
+    auto & TextBlock = *SlotState.TextBlock;
+    const auto & GlyphText = SlotState.GlyphText;
+    const TSharedRef<SWidget> Shown = SlotState.UseGlyphs ? GlyphText.ToSharedRef() : SlotState.TextBlock.ToSharedRef();
+    if (! Update.Visible) {
+        if (Applied.Visible) {
+            Shown->SetVisibility(EVisibility::Collapsed);
+            Applied.Visible = false;
+        }
+        return;
+    }
+    bool Switched = false;
+    if (! Applied.Text.Equals(Update.Text, ESearchCase::CaseSensitive)) {
+        const bool UseGlyphs = (nullptr != GlyphText) && GlyphText->SetText(Update.Text);
+        if (UseGlyphs) {
+            GlyphChanges++;
+        } else {
+            TextBlock.SetText(FText::FromString(Update.Text));
+            TextChanges++;
+        }
+        if (UseGlyphs != SlotState.UseGlyphs) {
+            Shown->SetVisibility(EVisibility::Collapsed);
+            SlotState.UseGlyphs = UseGlyphs;
+            Switched = true;
+        }
+        Applied.Text = MoveTemp(Update.Text);
+    }
+    if (Applied.Color != Update.Color) {
+        TextBlock.SetColorAndOpacity(FSlateColor(Update.Color));
+        if (nullptr != GlyphText) {
+            GlyphText->SetColor(Update.Color);
+        }
+        Applied.Color = Update.Color;
+    }
+    if (Applied.Location != Update.Location) {
+        const FSlateRenderTransform RenderTransform(FVector2f(Update.Location));
+        TextBlock.SetRenderTransform(RenderTransform);
+        if (nullptr != GlyphText) {
+            GlyphText->SetRenderTransform(RenderTransform);
+        }
+        Applied.Location = Update.Location;
+    }
+    if ((! Applied.Visible) || Switched) {
+        if (SlotState.UseGlyphs) {
+            GlyphText->SetVisibility(EVisibility::HitTestInvisible);
+        } else {
+            TextBlock.SetVisibility(EVisibility::HitTestInvisible);
+        }
+        Applied.Visible = true;
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Retained-mode HUD of a session: one persistent text widget per slot (sentence, ASL text, token, letter, sentiment,
+// status), built once with its font. Any thread can show or hide a slot; updates are queued and the game thread
+// applies them once per frame, in place (only the latest update of a slot, and SetText only when its text changed).
+// Timed messages expire through the timer wheel. Nothing is allocated per message and no thread waits for the HUD.
+// A slot can draw from a glyph atlas instead (see SGlyphText); texts with a character that the atlas lacks fall back to
+// the slot's text widget.
+//
+
+#include <Containers/StaticArray.h>
+#include <Containers/Ticker.h>
+#include <CoreMinimal.h>
+
+#include "GlyphAtlas.h"
+#include "TimerWheel.h"
+
+class SOverlay;
+class STextBlock;
+class UFont;
+class UGameViewportClient;
+class ULocalPlayer;
+
+namespace ASLMetaHuman::Core {
+
+class SGlyphText;
+
+enum class EHudSlot : uint8 {
+    Sentence,
+    ASLText,
+    Token,
+    Letter,
+    Sentiment,
+    Status,
+    Count
+};
+
+class FHudOverlay {
+public:
+    static constexpr int32 NumSlots = static_cast<int32>(EHudSlot::Count);
+
+    // FontSizes: one per slot (in EHudSlot order). No font: nothing is shown
+    //
+    FHudOverlay(const UFont * InFont, const TStaticArray<int32, NumSlots> & InFontSizes);
+    ~FHudOverlay();
+    FHudOverlay & operator=(const FHudOverlay &) = delete;
+    FHudOverlay(FHudOverlay const &) = delete;
+
+    // Any thread: shows Text in Slot at Location (viewport coordinates) for DurationSeconds (FLT_MAX: until it's hidden
+    // or replaced). Empty texts are ignored
+    //
+    void Show(const EHudSlot Slot,
+            const FString & Text,
+            const FVector2D & Location,
+            const FColor & Color,
+            const float DurationSeconds = FLT_MAX);
+    void Hide(const EHudSlot Slot);
+    void HideAll();
+
+    // Game thread: draws Slot's texts from Atlas from now on
+    //
+    void SetGlyphAtlas(const EHudSlot Slot, const TSharedRef<const FGlyphAtlas> & Atlas);
+
+    // Logs the HUD work since the last call (e.g. per sentence), then starts over
+    //
+    void LogStats(const int32 SessionIndex, const uint64 SentenceIndex);
+
+private:
+    struct FUpdate {
+        bool Visible {false};
+        FString Text;
+        FVector2D Location {0.0, 0.0};
+        FLinearColor Color {FLinearColor::White};
+    };
+
+    // What a slot's widget shows (game thread only)
+    //
+    struct FSlotState {
+        TSharedPtr<STextBlock> TextBlock;
+        TSharedPtr<const FGlyphAtlas> Atlas;
+        TSharedPtr<SGlyphText> GlyphText;
+        // Whether GlyphText shows the text (rather than TextBlock)
+        //
+        bool UseGlyphs {false};
+        FUpdate Applied;
+    };
+
+    struct FStats {
+        uint32 Frames {0};
+        uint32 Updates {0};
+        uint32 TextChanges {0};
+        uint32 GlyphChanges {0};
+        uint32 WidgetsCreated {0};
+        double GameThreadSeconds {0.0};
+    };
+
+    // Cancelling a timer doesn't stop an expiry that the timer wheel already took out to run: expiries reach this
+    // object through Hud, which the destructor clears under Mutex (i.e. not while an expiry runs)
+    //
+    struct FExpiryOwner {
+        FCriticalSection Mutex;
+        FHudOverlay * Hud {nullptr};
+    };
+
+    void Queue(const EHudSlot Slot, FUpdate && Update, const float DurationSeconds = FLT_MAX);
+    void Expire(const EHudSlot Slot, const uint64 Sequence);
+    bool Tick(float DeltaTime);
+    bool CreateWidgets();
+    void AddGlyphText(FSlotState & SlotState);
+    static void Apply(FSlotState & SlotState, FUpdate && Update, uint32 & TextChanges, uint32 & GlyphChanges);
+
+    const UFont * Font;
+    const TStaticArray<int32, NumSlots> FontSizes;
+    // Sequences counts each slot's updates, so that an expiry only hides the update that scheduled it
+    //
+    TStaticArray<TOptional<FUpdate>, NumSlots> Pending;
+    TStaticArray<uint64, NumSlots> Sequences;
+    TStaticArray<FTimerWheel::FHandle, NumSlots> ExpiryTimers;
+    FCriticalSection MutexPending;
+    const TSharedRef<FExpiryOwner, ESPMode::ThreadSafe> ExpiryOwner;
+    TStaticArray<FSlotState, NumSlots> Slots;
+    TSharedPtr<SOverlay> Overlay;
+    TWeakObjectPtr<UGameViewportClient> ViewportClient;
+    TWeakObjectPtr<ULocalPlayer> LocalPlayer;
+    FTSTicker::FDelegateHandle TickerHandle;
+    FStats Stats;
+    FCriticalSection MutexStats;
+};
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Read-copy-update publication of an immutable value: readers take a reference to the current value without locking
+// (a few atomic operations), writers publish a replacement built on the side. A replaced value is reclaimed once its
+// last reader drops its reference - readers keep it for as long as they use it (e.g. for a whole sentence).
+//
+// Readers announce themselves in one of two counters (chosen by the parity of the epoch) while they copy the current
+// reference; a writer swaps the value, flips the epoch and waits for the previous counter to drain (a grace period that
+// lasts a few instructions) before releasing its own reference to the replaced value.
+//
+
+#include <CoreMinimal.h>
+
+#include <atomic>
+
+namespace ASLMetaHuman::Core {
+
+template <typename T>
+class TRcuPointer {
+public:
+    TRcuPointer() = default;
+    TRcuPointer(const TRcuPointer &) = delete;
+    TRcuPointer & operator=(const TRcuPointer &) = delete;
+
+    ~TRcuPointer() {
+        delete Current.load();
+    }
+
+    // Returns the current value (nullptr before the first Publish())
+    //
+    TSharedPtr<const T> Get() const {
+        while (true) {
+            const uint32 Slot = Epoch.load() & 1;
+            Readers[Slot].fetch_add(1);
+            if ((Epoch.load() & 1) == Slot) {
+                TSharedPtr<const T> Value;
+                if (const FHolder * Holder = Current.load()) {
+                    Value = Holder->Value;
+                }
+                Readers[Slot].fetch_sub(1);
+                return Value;
+            }
+            // A writer flipped the epoch meanwhile: announce in the current counter instead
+            //
+            Readers[Slot].fetch_sub(1);
+        }
+    }
+
+    // Publishes NewValue to subsequent readers; readers holding the previous value keep it alive
+    //
+    void Publish(const TSharedRef<const T> & NewValue) {
+        FScopeLock Lock(&PublishMutex);
+        const FHolder * Previous = Current.exchange(new FHolder {NewValue});
+        const uint32 PreviousSlot = Epoch.fetch_add(1) & 1;
+        while (0 != Readers[PreviousSlot].load()) {
+            FPlatformProcess::Yield();
+        }
+        delete Previous;
+    }
+
+private:
+    struct FHolder {
+        TSharedRef<const T> Value;
+    };
+
+    std::atomic<const FHolder *> Current {nullptr};
+    std::atomic<uint32> Epoch {0};
+    mutable std::atomic<int32> Readers[2] {0, 0};
+    FCriticalSection PublishMutex;
+};
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Text drawn from a glyph atlas (see SGlyphText.h)
+//
+
+#include "SGlyphText.h"
+
+using ASLMetaHuman::Core::SGlyphText;
+
+void SGlyphText::Construct(const FArguments & InArgs, const TSharedRef<const FGlyphAtlas> & InAtlas) {
+    Atlas = InAtlas;
+}
+
+bool SGlyphText::SetText(const FString & Text) {
+    for (const TCHAR Character: Text) {
+        if ((! FChar::IsWhitespace(Character)) && (nullptr == Atlas->Find(Character))) {
+            return false;
+        }
+    }
+    Placed.Reset();
+    float X = 0.0f;
+    for (const TCHAR Character: Text) {
+        const auto Glyph = Atlas->Find(Character);
+        if (nullptr == Glyph) {
+            X += Atlas->GetSpaceAdvance();
+            continue;
+        }
+        Placed.Add({&Glyph->Brush, X});
+        X += Glyph->Advance;
+    }
+    Width = X;
+    Invalidate(EInvalidateWidgetReason::Layout);
+    return true;
+}
+
+void SGlyphText::SetColor(const FLinearColor & InColor) {
+    Color = InColor;
+    Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+int32 SGlyphText::OnPaint(const FPaintArgs & Args,
+        const FGeometry & AllottedGeometry,
+        const FSlateRect & MyCullingRect,
+        FSlateWindowElementList & OutDrawElements,
+        int32 LayerId,
+        const FWidgetStyle & InWidgetStyle,
+        bool bParentEnabled) const {
+    const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint() * Color;
+    for (const auto & Glyph: Placed) {
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+                AllottedGeometry.ToPaintGeometry(
+                        FVector2f(Glyph.Brush->ImageSize), FSlateLayoutTransform(FVector2f(Glyph.X, 0.0f))),
+                Glyph.Brush, ESlateDrawEffect::None, Tint);
+    }
+    return LayerId;
+}
+
+FVector2D SGlyphText::ComputeDesiredSize(float LayoutScaleMultiplier) const {
+    return FVector2D(Width, Atlas->GetLineHeight());
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Draws a single line of text from a glyph atlas (see FGlyphAtlas): one textured quad per glyph, all from the same
+// texture (so they batch into one draw). Changing the text only looks its glyphs up
+//
+
+#include <CoreMinimal.h>
+#include <Widgets/SLeafWidget.h>
+
+#include "GlyphAtlas.h"
+
+namespace ASLMetaHuman::Core {
+
+class SGlyphText : public SLeafWidget {
+public:
+    SLATE_BEGIN_ARGS(SGlyphText) {
+    }
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments & InArgs, const TSharedRef<const FGlyphAtlas> & InAtlas);
+
+    // Returns false (and keeps the current text) if the atlas has no glyph for a character of Text
+    //
+    bool SetText(const FString & Text);
+
+    // Tints the (white) glyphs
+    //
+    void SetColor(const FLinearColor & InColor);
+
+    virtual int32 OnPaint(const FPaintArgs & Args,
+            const FGeometry & AllottedGeometry,
+            const FSlateRect & MyCullingRect,
+            FSlateWindowElementList & OutDrawElements,
+            int32 LayerId,
+            const FWidgetStyle & InWidgetStyle,
+            bool bParentEnabled) const override;
+
+protected:
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+    struct FPlacedGlyph {
+        const FSlateBrush * Brush {nullptr};
+        float X {0.0f};
+    };
+
+    TSharedPtr<const FGlyphAtlas> Atlas;
+    TArray<FPlacedGlyph> Placed;
+    float Width {0.0f};
+    FLinearColor Color {FLinearColor::White};
+};
+}
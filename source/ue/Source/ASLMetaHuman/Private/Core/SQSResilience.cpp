@@ -0,0 +1,136 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Provides the resiliency building blocks of the SQS action source.
+//
+
+#include "SQSResilience.h"
+
+using ASLMetaHuman::Core::FSqsCircuitBreaker;
+using ASLMetaHuman::Core::FSqsClientStats;
+using ASLMetaHuman::Core::FSqsRetryStrategy;
+
+namespace {
+// Console status-related messages
+//
+constexpr auto & InfoClientStatsFormatted = TEXT(
+        "%s client: %llu requests | %llu received | %llu empty | %llu failed | %llu retries | %llu short-circuited | "
+        "circuit opened %llu times | %llu hedged (%llu won, %llu released) | %llu released to other sessions");
+}
+
+//*******************************************************************
+// Counters
+//*******************************************************************
+
+void FSqsClientStats::Log(const TCHAR * SourceName) const {
+    UE_LOG(LogTemp, Log, InfoClientStatsFormatted, SourceName, Requests.load(), Received.load(), Empty.load(),
+            Failed.load(), Retries.load(), ShortCircuited.load(), CircuitOpened.load(), Hedged.load(),
+            HedgeWins.load(), Released.load(), OtherSession.load());
+}
+
+//*******************************************************************
+// Retry strategy
+//*******************************************************************
+
+FSqsRetryStrategy::FSqsRetryStrategy(const long MaxAttempts,
+        const long BaseDelayMs,
+        const long MaxDelayMs,
+        const TSharedRef<FSqsClientStats, ESPMode::ThreadSafe> & Stats):
+            AdaptiveRetryStrategy {FMath::Max(1L, MaxAttempts)},
+            BaseDelayMs {FMath::Max(1L, BaseDelayMs)},
+            MaxDelayMs {FMath::Max(1L, MaxDelayMs)},
+            ClientStats {Stats} {
+}
+
+bool FSqsRetryStrategy::ShouldRetry(const Aws::Client::AWSError<Aws::Client::CoreErrors> & Error,
+        long AttemptedRetries) const {
+    const bool Retry = AdaptiveRetryStrategy::ShouldRetry(Error, AttemptedRetries);
+    if (Retry) {
+        ClientStats->Retries++;
+    }
+    return Retry;
+}
+
+long FSqsRetryStrategy::CalculateDelayBeforeNextRetry(const Aws::Client::AWSError<Aws::Client::CoreErrors> & Error,
+        long AttemptedRetries) const {
+    const double CeilingMs = FMath::Min(static_cast<double>(MaxDelayMs),
+            static_cast<double>(BaseDelayMs) * FMath::Pow(2.0, static_cast<double>(FMath::Min(AttemptedRetries, 30L))));
+    return static_cast<long>(FMath::FRandRange(0.0, CeilingMs));
+}
+
+//*******************************************************************
+// Circuit breaker
+//*******************************************************************
+
+void FSqsCircuitBreaker::Configure(const int32 NewFailureThreshold,
+        const double NewOpenSeconds,
+        const double NewMaxOpenSeconds) {
+    FailureThreshold = FMath::Max(1, NewFailureThreshold);
+    BaseOpenSeconds = FMath::Max(0.0, NewOpenSeconds);
+    MaxOpenSeconds = FMath::Max(BaseOpenSeconds, NewMaxOpenSeconds);
+    CurrentOpenSeconds = BaseOpenSeconds;
+}
+
+bool FSqsCircuitBreaker::AllowRequest() {
+    switch (State) {
+    case EState::OPEN:
+        if (FPlatformTime::Seconds() < OpenUntilSeconds) {
+            return false;
+        }
+        State = EState::HALF_OPEN;
+        return true;
+    case EState::HALF_OPEN:
+        return false;
+    case EState::CLOSED:
+    default:
+        return true;
+    }
+}
+
+bool FSqsCircuitBreaker::RecordSuccess() {
+    const bool Recovered = EState::CLOSED != State;
+    State = EState::CLOSED;
+    ConsecutiveFailures = 0;
+    CurrentOpenSeconds = BaseOpenSeconds;
+    return Recovered;
+}
+
+bool FSqsCircuitBreaker::RecordFailure() {
+    ConsecutiveFailures++;
+    if (EState::HALF_OPEN == State) {
+        // The recovery probe failed: stay away longer
+        //
+        Open(FMath::Min(CurrentOpenSeconds * 2.0, MaxOpenSeconds));
+        return false;
+    }
+    if ((EState::CLOSED == State) && (ConsecutiveFailures >= FailureThreshold)) {
+        Open(BaseOpenSeconds);
+        return true;
+    }
+    return false;
+}
+
+double FSqsCircuitBreaker::GetRemainingOpenSeconds() const {
+    return EState::OPEN == State ? FMath::Max(0.0, OpenUntilSeconds - FPlatformTime::Seconds()) : 0.0;
+}
+
+void FSqsCircuitBreaker::Open(const double Seconds) {
+    State = EState::OPEN;
+    CurrentOpenSeconds = Seconds;
+    OpenUntilSeconds = FPlatformTime::Seconds() + Seconds;
+}
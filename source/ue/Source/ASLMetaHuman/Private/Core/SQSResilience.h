@@ -0,0 +1,114 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Provides the resiliency building blocks of the SQS action source: a retry strategy with exponential full-jitter
+// backoff, a circuit breaker for outages and per-outcome request counters.
+//
+
+#include <aws/core/client/AdaptiveRetryStrategy.h>
+
+#include <atomic>
+
+namespace ASLMetaHuman::Core {
+
+// Per-outcome SQS request counters (updated from the worker thread and from SDK executor threads)
+//
+struct FSqsClientStats {
+    std::atomic<uint64> Requests {0};
+    std::atomic<uint64> Received {0};
+    std::atomic<uint64> Empty {0};
+    std::atomic<uint64> Failed {0};
+    std::atomic<uint64> Retries {0};
+    std::atomic<uint64> ShortCircuited {0};
+    std::atomic<uint64> CircuitOpened {0};
+    std::atomic<uint64> Hedged {0};
+    std::atomic<uint64> HedgeWins {0};
+    std::atomic<uint64> Released {0};
+    std::atomic<uint64> OtherSession {0};
+
+    void Log(const TCHAR * SourceName) const;
+};
+
+// Adaptive (client-side rate limited on throttling) retries, but with exponential full-jitter delays:
+// random(0, min(MaxDelay, BaseDelay * 2^attempt)) so that many renderers don't retry in lock step
+//
+class FSqsRetryStrategy: public Aws::Client::AdaptiveRetryStrategy {
+public:
+    FSqsRetryStrategy(const long MaxAttempts,
+            const long BaseDelayMs,
+            const long MaxDelayMs,
+            const TSharedRef<FSqsClientStats, ESPMode::ThreadSafe> & Stats);
+
+    virtual bool ShouldRetry(const Aws::Client::AWSError<Aws::Client::CoreErrors> & Error,
+            long AttemptedRetries) const override;
+    virtual long CalculateDelayBeforeNextRetry(const Aws::Client::AWSError<Aws::Client::CoreErrors> & Error,
+            long AttemptedRetries) const override;
+
+private:
+    long BaseDelayMs;
+    long MaxDelayMs;
+    TSharedRef<FSqsClientStats, ESPMode::ThreadSafe> ClientStats;
+};
+
+// Stops polling after consecutive failures (OPEN), lets a single probe through once the open time elapsed
+// (HALF_OPEN) and closes again on success. The open time doubles (up to a maximum) while probes keep failing.
+// Note: not thread-safe - owned by the worker thread
+//
+class FSqsCircuitBreaker {
+public:
+    enum class EState : uint8 {
+        CLOSED,
+        OPEN,
+        HALF_OPEN
+    };
+
+    void Configure(const int32 FailureThreshold, const double OpenSeconds, const double MaxOpenSeconds);
+    // Returns false while requests should be skipped. The request that moves the circuit to HALF_OPEN is the recovery
+    // probe; every other request is skipped until its outcome is recorded
+    //
+    bool AllowRequest();
+    // Returns true if this success ended an outage
+    //
+    bool RecordSuccess();
+    // Returns true if this failure opened the circuit
+    //
+    bool RecordFailure();
+
+    EState GetState() const {
+        return State;
+    }
+    int32 GetConsecutiveFailures() const {
+        return ConsecutiveFailures;
+    }
+    // Time left until the next probe (0 unless OPEN)
+    //
+    double GetRemainingOpenSeconds() const;
+
+private:
+    void Open(const double Seconds);
+
+    EState State {EState::CLOSED};
+    int32 ConsecutiveFailures {0};
+    int32 FailureThreshold {5};
+    double BaseOpenSeconds {2.0};
+    double MaxOpenSeconds {60.0};
+    double CurrentOpenSeconds {2.0};
+    double OpenUntilSeconds {0.0};
+};
+}
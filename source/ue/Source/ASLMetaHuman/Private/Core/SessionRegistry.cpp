@@ -0,0 +1,219 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Represents this renderer instance's claim on a session when several instances share the action queues.
+//
+
+#include "SessionRegistry.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Async/Async.h>
+#include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/PutObjectRequest.h>
+#include <aws/s3/S3ClientConfiguration.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FSessionRegistry;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+// Time to wait before re-reading a written claim (lets a concurrent claimer's write land first)
+//
+constexpr float ClaimSettleSeconds = 2.0f;
+constexpr auto & ClaimKeyPrefix = TEXT("sessions/");
+constexpr auto & ClaimKeySuffix = TEXT(".json");
+constexpr auto & ClaimContentType = "application/json";
+constexpr auto & InstanceIdField = TEXT("InstanceId");
+constexpr auto & HostField = TEXT("Host");
+constexpr auto & HeartbeatField = TEXT("HeartbeatUtcMs");
+// Console status-related messages
+//
+constexpr auto & ErrorClaimWriteFormatted = TEXT("Failed to write session claim %s: %s");
+constexpr auto & ErrorLeaseLostFormatted = TEXT(
+        "Session %s was taken over by instance %s: no longer consuming its actions");
+constexpr auto & ErrorNoFreeSession = TEXT("No free session to claim (all sessions are held by live instances)");
+constexpr auto & InfoSessionClaimedFormatted = TEXT("Instance %s claimed session %s");
+constexpr auto & InfoSessionHeldFormatted = TEXT("Session %s is held by live instance %s");
+
+int64 GetUtcNowMs() {
+    return static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+}
+}
+
+FSessionRegistry::FSessionRegistry():
+    Bucket {FInternalSettings::GetSessionRegistryBucket()},
+    InstanceId {FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower)},
+    StopHeartbeatEvent {FPlatformProcess::GetSynchEventFromPool(true)} {
+}
+
+// Stops heartbeats and releases the claim so that another instance can take the session over right away
+//
+FSessionRegistry::~FSessionRegistry() {
+    StopHeartbeatEvent->Trigger();
+    if (HeartbeatFuture.IsValid()) {
+        HeartbeatFuture.Wait();
+        ReleaseClaim();
+    }
+    FPlatformProcess::ReturnSynchEventToPool(StopHeartbeatEvent);
+    StopHeartbeatEvent = nullptr;
+}
+
+bool FSessionRegistry::Claim(const TArray<FString> & Candidates) {
+    if (Candidates.IsEmpty()) {
+        return false;
+    }
+    if (Bucket.IsEmpty()) {
+        SessionId = Candidates[0];
+        UE_LOG(LogTemp, Log, InfoSessionClaimedFormatted, *InstanceId, *SessionId);
+        return true;
+    }
+    CreateClient();
+    const int64 LeaseMs = static_cast<int64>(FInternalSettings::GetSessionLeaseSeconds() * 1000.0f);
+    for (const auto & Candidate: Candidates) {
+        if (FGlobalState::IsAborting()) {
+            return false;
+        }
+        FString OwnerInstanceId;
+        int64 HeartbeatUtcMs = 0;
+        if (ReadClaim(Candidate, OwnerInstanceId, HeartbeatUtcMs) && (OwnerInstanceId != InstanceId)
+                && (GetUtcNowMs() - HeartbeatUtcMs < LeaseMs)) {
+            UE_LOG(LogTemp, Log, InfoSessionHeldFormatted, *Candidate, *OwnerInstanceId);
+            continue;
+        }
+        if (! WriteClaim(Candidate)) {
+            continue;
+        }
+        FPlatformProcess::Sleep(ClaimSettleSeconds);
+        if (ReadClaim(Candidate, OwnerInstanceId, HeartbeatUtcMs) && (OwnerInstanceId == InstanceId)) {
+            SessionId = Candidate;
+            UE_LOG(LogTemp, Log, InfoSessionClaimedFormatted, *InstanceId, *SessionId);
+            HeartbeatFuture = Async(EAsyncExecution::Thread, [this]() {
+                RunHeartbeat();
+            });
+            return true;
+        }
+        UE_LOG(LogTemp, Log, InfoSessionHeldFormatted, *Candidate, *OwnerInstanceId);
+    }
+    UE_LOG(LogTemp, Error, ErrorNoFreeSession);
+    return false;
+}
+
+// The registry client uses the configured region and endpoint (e.g. an S3-compatible stand-in, addressed path-style)
+// and the same connection budget as the SQS action source
+//
+void FSessionRegistry::CreateClient() {
+    Aws::S3::S3ClientConfiguration ClientConfig;
+    const FString & Region = FInternalSettings::GetSessionRegistryRegion();
+    if (! Region.IsEmpty()) {
+        ClientConfig.region = UnrealAPI::FStringToAwsString(Region);
+    }
+    const FString & EndpointOverride = FInternalSettings::GetSessionRegistryEndpointOverride();
+    if (! EndpointOverride.IsEmpty()) {
+        ClientConfig.endpointOverride = UnrealAPI::FStringToAwsString(EndpointOverride);
+        ClientConfig.useVirtualAddressing = false;
+    }
+    ClientConfig.connectTimeoutMs = FInternalSettings::GetSQSConnectTimeoutMs();
+    ClientConfig.requestTimeoutMs = FInternalSettings::GetSQSRequestTimeoutMs();
+    ClientConfig.httpRequestTimeoutMs = FInternalSettings::GetSQSRequestTimeoutMs();
+    S3Client = MakeUnique<Aws::S3::S3Client>(ClientConfig);
+}
+
+// Renews the claim every SessionHeartbeatSeconds. Stops once another instance took the session over: the action
+// source observes IsLeaseLost() and stops consuming, so that both instances never act on the same session
+//
+void FSessionRegistry::RunHeartbeat() {
+    const uint32 HeartbeatMs = static_cast<uint32>(FMath::Max(1.0f, FInternalSettings::GetSessionHeartbeatSeconds()) * 1000.0f);
+    while ((! StopHeartbeatEvent->Wait(HeartbeatMs)) && (! FGlobalState::IsAborting())) {
+        FString OwnerInstanceId;
+        int64 HeartbeatUtcMs = 0;
+        if (ReadClaim(SessionId, OwnerInstanceId, HeartbeatUtcMs) && (OwnerInstanceId != InstanceId)) {
+            UE_LOG(LogTemp, Error, ErrorLeaseLostFormatted, *SessionId, *OwnerInstanceId);
+            LeaseLost = true;
+            return;
+        }
+        WriteClaim(SessionId);
+    }
+}
+
+bool FSessionRegistry::ReadClaim(const FString & CandidateId, FString & OwnerInstanceId, int64 & HeartbeatUtcMs) const {
+    Aws::S3::Model::GetObjectRequest ObjectRequest;
+    ObjectRequest.SetBucket(UnrealAPI::FStringToAwsString(Bucket));
+    ObjectRequest.SetKey(GetClaimKey(CandidateId));
+    auto Outcome = S3Client->GetObject(ObjectRequest);
+    if (! Outcome.IsSuccess()) {
+        return false;
+    }
+    std::stringstream ClaimStream;
+    ClaimStream << Outcome.GetResult().GetBody().rdbuf();
+    TSharedPtr<FJsonObject> ClaimObject;
+    const auto & Reader = TJsonReaderFactory<>::Create(UTF8_TO_TCHAR(ClaimStream.str().c_str()));
+    if ((! FJsonSerializer::Deserialize(Reader, ClaimObject)) || (! ClaimObject.IsValid())) {
+        return false;
+    }
+    OwnerInstanceId = ClaimObject->GetStringField(InstanceIdField);
+    HeartbeatUtcMs = FCString::Atoi64(*ClaimObject->GetStringField(HeartbeatField));
+    return true;
+}
+
+bool FSessionRegistry::WriteClaim(const FString & CandidateId) const {
+    const auto ClaimObject = MakeShared<FJsonObject>();
+    ClaimObject->SetStringField(InstanceIdField, InstanceId);
+    ClaimObject->SetStringField(HostField, FPlatformProcess::ComputerName());
+    ClaimObject->SetStringField(HeartbeatField, FString::Printf(TEXT("%lld"), GetUtcNowMs()));
+    FString ClaimBody;
+    FJsonSerializer::Serialize(ClaimObject, TJsonWriterFactory<>::Create(&ClaimBody));
+
+    Aws::S3::Model::PutObjectRequest ObjectRequest;
+    ObjectRequest.SetBucket(UnrealAPI::FStringToAwsString(Bucket));
+    ObjectRequest.SetKey(GetClaimKey(CandidateId));
+    ObjectRequest.SetContentType(ClaimContentType);
+    const auto ClaimStream = Aws::MakeShared<Aws::StringStream>("SessionClaim");
+    *ClaimStream << UnrealAPI::FStringToAwsString(ClaimBody);
+    ObjectRequest.SetBody(ClaimStream);
+    const auto Outcome = S3Client->PutObject(ObjectRequest);
+    if (! Outcome.IsSuccess()) {
+        const auto & ErrorMessage = UnrealAPI::AwsStringToFString(Outcome.GetError().GetMessage());
+        UE_LOG(LogTemp, Error, ErrorClaimWriteFormatted, *CandidateId, *ErrorMessage);
+    }
+    return Outcome.IsSuccess();
+}
+
+// Only releases a claim that this instance still holds
+//
+void FSessionRegistry::ReleaseClaim() const {
+    FString OwnerInstanceId;
+    int64 HeartbeatUtcMs = 0;
+    if (SessionId.IsEmpty() || (nullptr == S3Client) || (! ReadClaim(SessionId, OwnerInstanceId, HeartbeatUtcMs))
+            || (OwnerInstanceId != InstanceId)) {
+        return;
+    }
+    Aws::S3::Model::DeleteObjectRequest ObjectRequest;
+    ObjectRequest.SetBucket(UnrealAPI::FStringToAwsString(Bucket));
+    ObjectRequest.SetKey(GetClaimKey(SessionId));
+    S3Client->DeleteObject(ObjectRequest);
+}
+
+Aws::String FSessionRegistry::GetClaimKey(const FString & CandidateId) const {
+    return UnrealAPI::FStringToAwsString(FString(ClaimKeyPrefix) + CandidateId + ClaimKeySuffix);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Represents this renderer instance's claim on a session (e.g. one kiosk) when several instances share the action
+// queues. Claims are S3 objects (sessions/<SessionId>.json holding the owner instance and its last heartbeat); a claim
+// whose heartbeat is older than the lease is considered abandoned and can be taken over.
+//
+// Note: on shared queues an instance hands the messages of other sessions back (visibility reset to 0), and SQS counts
+// each of those as a receive: deploy the stack with the number of sessions per queue (-c sessionsPerQueue=<count>) so
+// that the redrive policy doesn't dead-letter them before their session receives them.
+//
+// Note: S3 offers no conditional writes in this SDK version; a claim is confirmed by re-reading it after a short
+// settle time (last writer wins), which is sufficient for instances that start a few seconds apart
+//
+
+#include <aws/s3/S3Client.h>
+
+namespace ASLMetaHuman::Core {
+
+class FSessionRegistry {
+public:
+    FSessionRegistry();
+    ~FSessionRegistry();
+
+    // Claims the first session of Candidates that no other live instance holds and keeps it alive with heartbeats.
+    // Without a registry bucket the first candidate is used as-is. Returns false if every candidate is taken
+    //
+    bool Claim(const TArray<FString> & Candidates);
+
+    const FString & GetSessionId() const {
+        return SessionId;
+    }
+    // True once another instance took the claimed session over (final: the claim isn't renewed afterwards)
+    //
+    bool IsLeaseLost() const {
+        return LeaseLost;
+    }
+
+private:
+    bool ReadClaim(const FString & CandidateId, FString & OwnerInstanceId, int64 & HeartbeatUtcMs) const;
+    bool WriteClaim(const FString & CandidateId) const;
+    void ReleaseClaim() const;
+    void RunHeartbeat();
+    void CreateClient();
+    Aws::String GetClaimKey(const FString & CandidateId) const;
+
+    TUniquePtr<Aws::S3::S3Client> S3Client;
+    FString Bucket;
+    FString InstanceId;
+    FString SessionId;
+    TFuture<void> HeartbeatFuture;
+    FEvent * StopHeartbeatEvent {nullptr};
+    FThreadSafeBool LeaseLost {false};
+};
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Live tuning of the pipeline knobs (see SettingsTuning.h)
+//
+
+#include "SettingsTuning.h"
+#include "Config/InternalSettings.h"
+#include "Config/UserSettings.h"
+
+#include <Async/Async.h>
+#include <HAL/IConsoleManager.h>
+
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Config::FSettingsPublication;
+using ASLMetaHuman::Config::FUserSettings;
+using ASLMetaHuman::Core::FSettingsTuning;
+
+namespace {
+// A tunable setting: exactly one of InternalField and UserField is set. Values outside [MinValue, MaxValue] are
+// rejected (e.g. a spinlock of 0 would never advance a wait loop)
+//
+struct FKnob {
+    const TCHAR * Name;
+    float MinValue;
+    float MaxValue;
+    float FInternalSettings::FSnapshot::*InternalField;
+    float FUserSettings::FSnapshot::*UserField;
+    const TCHAR * Help;
+};
+
+const FKnob Knobs[] = {
+        {TEXT("AnimationSpinlockSeconds"), 0.005f, 1.0f, &FInternalSettings::FSnapshot::AnimationSpinlockSeconds,
+                nullptr, TEXT("Polling period of the animation wait loops (seconds)")},
+        {TEXT("PlayEndOffset"), 0.0f, 5.0f, nullptr, &FUserSettings::FSnapshot::PlayEndOffset,
+                TEXT("Time cut from the end of each sign (seconds)")},
+        {TEXT("PlayStartOffset"), 0.0f, 5.0f, nullptr, &FUserSettings::FSnapshot::PlayStartOffset,
+                TEXT("Time cut from the start of each fingerspelled letter but the first (seconds)")},
+        {TEXT("SQSSpinlockSeconds"), 0.01f, 10.0f, &FInternalSettings::FSnapshot::SQSSpinlockSeconds, nullptr,
+                TEXT("Polling period of the SQS action source (seconds)")},
+        {TEXT("WordTransitionDelay"), 0.0f, 10.0f, nullptr, &FUserSettings::FSnapshot::WordTransitionDelaySeconds,
+                TEXT("Pause before each sign (seconds)")},
+};
+
+constexpr auto & ConsoleVariablePrefix = TEXT("asl.");
+
+const FKnob * FindKnob(const FString & Name) {
+    for (const auto & Knob: Knobs) {
+        if (Name.Equals(Knob.Name, ESearchCase::IgnoreCase)) {
+            return &Knob;
+        }
+    }
+    return nullptr;
+}
+
+float GetValue(const FKnob & Knob,
+        const FInternalSettings::FSnapshot & Internal,
+        const FUserSettings::FSnapshot & User) {
+    return nullptr != Knob.InternalField ? Internal.*Knob.InternalField : User.*Knob.UserField;
+}
+
+// Logging
+//
+constexpr auto & ErrorNoSettings = TEXT("no settings given");
+constexpr auto & ErrorUnknownSettingFormatted = TEXT("unknown setting %s");
+constexpr auto & ErrorInvalidValueFormatted = TEXT("%s: '%s' isn't a number");
+constexpr auto & ErrorOutOfRangeFormatted = TEXT("%s: %g is outside [%g, %g]");
+constexpr auto & InfoSettingsChangedFormatted = TEXT("Settings changed (effective from each session's next sentence): %s");
+constexpr auto & WarningSettingsRejectedFormatted = TEXT("Settings change rejected: %s");
+}
+
+void FSettingsTuning::RegisterConsoleVariables() {
+    if (! ConsoleVariables.IsEmpty()) {
+        return;
+    }
+    const auto & Internal = FInternalSettings::Get();
+    const auto & User = FUserSettings::Get();
+    for (const auto & Knob: Knobs) {
+        IConsoleVariable * Variable = IConsoleManager::Get().RegisterConsoleVariable(
+                *(FString(ConsoleVariablePrefix) + Knob.Name), GetValue(Knob, Internal, User), Knob.Help, ECVF_Default);
+        Variable->SetOnChangedCallback(
+                FConsoleVariableDelegate::CreateStatic(&FSettingsTuning::OnConsoleVariableChanged));
+        ConsoleVariables.Add(Variable);
+    }
+}
+
+void FSettingsTuning::UnregisterConsoleVariables() {
+    for (IConsoleVariable * Variable: ConsoleVariables) {
+        IConsoleManager::Get().UnregisterConsoleObject(Variable, false);
+    }
+    ConsoleVariables.Reset();
+}
+
+bool FSettingsTuning::Apply(const TMap<FString, FString> & Values, FString & Acknowledgement) {
+    if (Values.IsEmpty()) {
+        Acknowledgement = ErrorNoSettings;
+        UE_LOG(LogTemp, Warning, WarningSettingsRejectedFormatted, *Acknowledgement);
+        return false;
+    }
+    // Validate the whole change before anything is applied
+    //
+    TArray<TPair<const FKnob *, float>> Changes;
+    for (const auto & [Name, Text]: Values) {
+        const FKnob * Knob = FindKnob(Name);
+        const FString & TrimmedText = Text.TrimStartAndEnd();
+        if (nullptr == Knob) {
+            Acknowledgement = FString::Printf(ErrorUnknownSettingFormatted, *Name);
+        } else if (TrimmedText.IsEmpty() || (! TrimmedText.IsNumeric())) {
+            Acknowledgement = FString::Printf(ErrorInvalidValueFormatted, Knob->Name, *Text);
+        } else {
+            const float Value = FCString::Atof(*TrimmedText);
+            if ((Value >= Knob->MinValue) && (Value <= Knob->MaxValue)) {
+                Changes.Emplace(Knob, Value);
+                continue;
+            }
+            Acknowledgement =
+                    FString::Printf(ErrorOutOfRangeFormatted, Knob->Name, Value, Knob->MinValue, Knob->MaxValue);
+        }
+        UE_LOG(LogTemp, Warning, WarningSettingsRejectedFormatted, *Acknowledgement);
+        return false;
+    }
+    FSettingsPublication::Publish([&Changes, &Acknowledgement]() {
+        FInternalSettings::FSnapshot Internal = FInternalSettings::Get();
+        FUserSettings::FSnapshot User = FUserSettings::Get();
+        for (const auto & [Knob, Value]: Changes) {
+            if (nullptr != Knob->InternalField) {
+                Internal.*Knob->InternalField = Value;
+            } else {
+                User.*Knob->UserField = Value;
+            }
+        }
+        FInternalSettings::Publish(MoveTemp(Internal));
+        FUserSettings::Publish(MoveTemp(User));
+        Acknowledgement = GetEffectiveValues();
+    });
+    UE_LOG(LogTemp, Display, InfoSettingsChangedFormatted, *Acknowledgement);
+    AsyncTask(ENamedThreads::GameThread, []() {
+        SyncConsoleVariables();
+    });
+    return true;
+}
+
+FString FSettingsTuning::GetEffectiveValues() {
+    const auto & Internal = FInternalSettings::Get();
+    const auto & User = FUserSettings::Get();
+    TArray<FString> Values;
+    for (const auto & Knob: Knobs) {
+        Values.Add(FString::Printf(TEXT("%s=%g"), Knob.Name, GetValue(Knob, Internal, User)));
+    }
+    return FString::Join(Values, TEXT(" "));
+}
+
+// Game thread: a console variable was set (from the console, a config or the command line)
+//
+void FSettingsTuning::OnConsoleVariableChanged(IConsoleVariable * Variable) {
+    if (SyncingConsoleVariables) {
+        return;
+    }
+    const int32 Index = ConsoleVariables.Find(Variable);
+    if (INDEX_NONE == Index) {
+        return;
+    }
+    TMap<FString, FString> Values;
+    Values.Add(Knobs[Index].Name, Variable->GetString());
+    FString Acknowledgement;
+    if (! Apply(Values, Acknowledgement)) {
+        // Show the effective value again
+        //
+        AsyncTask(ENamedThreads::GameThread, []() {
+            SyncConsoleVariables();
+        });
+    }
+}
+
+// Game thread: makes the console variables show the effective values (e.g. after a CHANGE_SETTINGS action).
+// Note: set with console priority, which any later change (from the console too) may override
+//
+void FSettingsTuning::SyncConsoleVariables() {
+    const auto & Internal = FInternalSettings::Get();
+    const auto & User = FUserSettings::Get();
+    TGuardValue<bool> SyncingGuard(SyncingConsoleVariables, true);
+    for (int32 i = 0; i < ConsoleVariables.Num(); i++) {
+        const float Value = GetValue(Knobs[i], Internal, User);
+        if (ConsoleVariables[i]->GetFloat() != Value) {
+            ConsoleVariables[i]->Set(Value, ECVF_SetByConsole);
+        }
+    }
+}
\ No newline at end of file
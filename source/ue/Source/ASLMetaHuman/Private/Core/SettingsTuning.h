@@ -0,0 +1,59 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Live tuning of the pipeline knobs (no ini edit or restart): a CHANGE_SETTINGS action (kwargs: knob name -> value) or
+// the matching asl.<Knob> console variables. A change is validated as a whole (an unknown knob or an unparsable or
+// out-of-range value rejects it) and published as new settings snapshots. Sentences in progress keep the snapshot they
+// started with, so the change takes effect at each session's next sentence boundary. It is acknowledged (logged) with
+// the effective values of all knobs. Note: an edit of ASLMetaHuman.ini (see SettingsReloadIntervalSeconds) sets the
+// knobs back to the file's values.
+//
+// Example: {"Action": "CHANGE_SETTINGS", "Data": "", "kwargs": {"WordTransitionDelay": "0.8", "PlayEndOffset": "0.6"}}
+// or, from the console: asl.WordTransitionDelay 0.8
+//
+
+#include <CoreMinimal.h>
+
+struct IConsoleVariable;
+
+namespace ASLMetaHuman::Core {
+
+class FSettingsTuning {
+public:
+    // Game thread: registers the console variables (starting at the current settings) / removes them
+    //
+    static void RegisterConsoleVariables();
+    static void UnregisterConsoleVariables();
+
+    // Any thread: validates and applies Values (knob name -> value). Returns false if the change was rejected (nothing
+    // is applied; Acknowledgement holds the reason); Acknowledgement lists the effective values otherwise
+    //
+    static bool Apply(const TMap<FString, FString> & Values, FString & Acknowledgement);
+
+private:
+    static FString GetEffectiveValues();
+    static void OnConsoleVariableChanged(IConsoleVariable * Variable);
+    static void SyncConsoleVariables();
+
+    // One console variable per knob (same order), game thread only
+    //
+    static inline TArray<IConsoleVariable *> ConsoleVariables;
+    static inline bool SyncingConsoleVariables {false};
+};
+}
\ No newline at end of file
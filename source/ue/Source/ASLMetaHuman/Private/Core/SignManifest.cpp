@@ -0,0 +1,172 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Writes and indexes the prebuilt ASL sign manifest (see SignManifest.h)
+//
+
+#include "SignManifest.h"
+
+#include <Async/MappedFileHandle.h>
+#include <HAL/PlatformFileManager.h>
+#include <Hash/CityHash.h>
+#include <Misc/FileHelper.h>
+
+using ASLMetaHuman::Core::FSignManifest;
+using ASLMetaHuman::Core::FSignManifestHeader;
+using ASLMetaHuman::Core::FSignManifestRecord;
+
+namespace {
+constexpr uint32 ManifestMagic {0x4D4C5341};    // "ASLM"
+constexpr uint32 ManifestVersion {1};
+constexpr auto & ErrorManifestInvalidFormatted = TEXT("Sign manifest %s is invalid or out of date (rebuild it with -run=SignManifest)");
+
+uint64 HashContents(const uint8 * Data, const int64 Size) {
+    return CityHash64(reinterpret_cast<const char *>(Data), static_cast<uint32>(Size));
+}
+}
+
+FSignManifest::FSignManifest() = default;
+
+FSignManifest::~FSignManifest() {
+    // Note: the region must be released before its file
+    //
+    MappedRegion.Reset();
+    MappedFile.Reset();
+}
+
+uint64 FSignManifest::Write(const FString & FilePath, TArray<FEntry> Entries) {
+    Entries.Sort([](const FEntry & A, const FEntry & B) {
+        return A.SignName < B.SignName;
+    });
+    TArray<FSignManifestRecord> RecordList;
+    RecordList.Reserve(Entries.Num());
+    TArray<uint8> StringPool;
+    const auto AppendString = [&StringPool](const FString & String, uint32 & Offset, uint32 & Length) {
+        const FTCHARToUTF8 Utf8String(*String);
+        Offset = static_cast<uint32>(StringPool.Num());
+        Length = static_cast<uint32>(Utf8String.Length());
+        StringPool.Append(reinterpret_cast<const uint8 *>(Utf8String.Get()), Utf8String.Length());
+    };
+    for (const auto & Entry: Entries) {
+        FSignManifestRecord Record;
+        AppendString(Entry.SignName, Record.NameOffset, Record.NameLength);
+        AppendString(Entry.ObjectPath, Record.PathOffset, Record.PathLength);
+        Record.PlayLength = Entry.PlayLength;
+        Record.WordCount = Entry.WordCount;
+        RecordList.Add(Record);
+    }
+    TArray<uint8> Contents;
+    Contents.Append(
+            reinterpret_cast<const uint8 *>(RecordList.GetData()), RecordList.Num() * sizeof(FSignManifestRecord));
+    Contents.Append(StringPool);
+    FSignManifestHeader ManifestHeader;
+    ManifestHeader.Magic = ManifestMagic;
+    ManifestHeader.Version = ManifestVersion;
+    ManifestHeader.SignCount = static_cast<uint32>(RecordList.Num());
+    ManifestHeader.StringsSize = static_cast<uint32>(StringPool.Num());
+    ManifestHeader.DictionaryHash = HashContents(Contents.GetData(), Contents.Num());
+    TArray<uint8> FileContents;
+    FileContents.Append(reinterpret_cast<const uint8 *>(&ManifestHeader), sizeof(FSignManifestHeader));
+    FileContents.Append(Contents);
+    if (! FFileHelper::SaveArrayToFile(FileContents, *FilePath)) {
+        return 0;
+    }
+    return ManifestHeader.DictionaryHash;
+}
+
+bool FSignManifest::Open(const FString & FilePath) {
+    auto & PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (! PlatformFile.FileExists(*FilePath)) {
+        return false;
+    }
+    MappedFile.Reset(PlatformFile.OpenMapped(*FilePath));
+    if (nullptr != MappedFile) {
+        MappedRegion.Reset(MappedFile->MapRegion());
+    }
+    bool Indexed;
+    if (nullptr != MappedRegion) {
+        Indexed = IndexContents(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+    } else {
+        Indexed = FFileHelper::LoadFileToArray(FileData, *FilePath)
+                && IndexContents(FileData.GetData(), FileData.Num());
+    }
+    if (! Indexed) {
+        UE_LOG(LogTemp, Warning, ErrorManifestInvalidFormatted, *FilePath);
+    }
+    return Indexed;
+}
+
+// Validates the layout and hash; points Header/Records/Strings into the file
+//
+bool FSignManifest::IndexContents(const uint8 * Data, const int64 Size) {
+    Header = nullptr;
+    if ((nullptr == Data) || (Size < static_cast<int64>(sizeof(FSignManifestHeader)))) {
+        return false;
+    }
+    const auto FileHeader = reinterpret_cast<const FSignManifestHeader *>(Data);
+    const int64 RecordsSize = static_cast<int64>(FileHeader->SignCount) * sizeof(FSignManifestRecord);
+    if ((ManifestMagic != FileHeader->Magic) || (ManifestVersion != FileHeader->Version)
+            || (Size != static_cast<int64>(sizeof(FSignManifestHeader)) + RecordsSize + FileHeader->StringsSize)) {
+        return false;
+    }
+    const uint8 * Contents = Data + sizeof(FSignManifestHeader);
+    if (FileHeader->DictionaryHash != HashContents(Contents, RecordsSize + FileHeader->StringsSize)) {
+        return false;
+    }
+    Records = reinterpret_cast<const FSignManifestRecord *>(Contents);
+    Strings = reinterpret_cast<const UTF8CHAR *>(Contents + RecordsSize);
+    for (uint32 i = 0; i < FileHeader->SignCount; i++) {
+        const auto & Record = Records[i];
+        if ((static_cast<uint64>(Record.NameOffset) + Record.NameLength > FileHeader->StringsSize)
+                || (static_cast<uint64>(Record.PathOffset) + Record.PathLength > FileHeader->StringsSize)) {
+            return false;
+        }
+    }
+    Header = FileHeader;
+    return true;
+}
+
+FString FSignManifest::GetString(const uint32 Offset, const uint32 Length) const {
+    return FString(FUtf8StringView(Strings + Offset, Length));
+}
+
+FString FSignManifest::GetSignName(const int32 Index) const {
+    return GetString(Records[Index].NameOffset, Records[Index].NameLength);
+}
+
+FString FSignManifest::GetObjectPath(const int32 Index) const {
+    return GetString(Records[Index].PathOffset, Records[Index].PathLength);
+}
+
+int32 FSignManifest::Find(const FString & SignName) const {
+    int32 Low = 0;
+    int32 High = Num() - 1;
+    while (Low <= High) {
+        const int32 Middle = Low + (High - Low) / 2;
+        const FString & MiddleName = GetSignName(Middle);
+        if (MiddleName == SignName) {
+            return Middle;
+        }
+        if (MiddleName < SignName) {
+            Low = Middle + 1;
+        } else {
+            High = Middle - 1;
+        }
+    }
+    return INDEX_NONE;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Prebuilt ASL sign manifest: the sign vocabulary (sign name, animation object path, play length, word count) written
+// ahead of cooking by the SignManifest commandlet, so that startup can index signs without scanning the asset registry.
+//
+// Layout (little endian): FSignManifestHeader | FSignManifestRecord[SignCount] (sorted by sign name) | UTF-8 strings.
+// The dictionary hash covers the records and strings (detects truncated or mismatched files).
+//
+
+#include <CoreMinimal.h>
+
+struct IMappedFileHandle;
+struct IMappedFileRegion;
+
+namespace ASLMetaHuman::Core {
+
+struct FSignManifestHeader {
+    uint32 Magic;
+    uint32 Version;
+    uint32 SignCount;
+    uint32 StringsSize;
+    uint64 DictionaryHash;
+};
+
+struct FSignManifestRecord {
+    uint32 NameOffset;
+    uint32 NameLength;
+    uint32 PathOffset;
+    uint32 PathLength;
+    float PlayLength;
+    uint32 WordCount;
+};
+
+class FSignManifest {
+public:
+    struct FEntry {
+        FString SignName;
+        FString ObjectPath;
+        float PlayLength {0.0f};
+        uint32 WordCount {0};
+    };
+
+    FSignManifest();
+    ~FSignManifest();
+
+    // Writes Entries (in any order) to FilePath. Returns the dictionary hash, or 0 if the file couldn't be written
+    //
+    static uint64 Write(const FString & FilePath, TArray<FEntry> Entries);
+
+    // Maps the manifest into memory (falls back to reading it, e.g. from a pak file). Returns false if the file is
+    // missing or invalid
+    //
+    bool Open(const FString & FilePath);
+
+    int32 Num() const {
+        return nullptr == Header ? 0 : static_cast<int32>(Header->SignCount);
+    }
+
+    uint64 GetDictionaryHash() const {
+        return nullptr == Header ? 0 : Header->DictionaryHash;
+    }
+
+    FString GetSignName(const int32 Index) const;
+    FString GetObjectPath(const int32 Index) const;
+
+    float GetPlayLength(const int32 Index) const {
+        return Records[Index].PlayLength;
+    }
+
+    uint32 GetWordCount(const int32 Index) const {
+        return Records[Index].WordCount;
+    }
+
+    // Returns the index of a sign (binary search), or INDEX_NONE
+    //
+    int32 Find(const FString & SignName) const;
+
+private:
+    bool IndexContents(const uint8 * Data, const int64 Size);
+    FString GetString(const uint32 Offset, const uint32 Length) const;
+
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TArray<uint8> FileData;
+    const FSignManifestHeader * Header {nullptr};
+    const FSignManifestRecord * Records {nullptr};
+    const UTF8CHAR * Strings {nullptr};
+};
+}
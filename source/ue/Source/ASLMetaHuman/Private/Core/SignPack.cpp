@@ -0,0 +1,280 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Writes and maps sign packs (see SignPack.h)
+//
+
+#include "SignPack.h"
+#include "SignPoseCache.h"
+
+#include <Async/MappedFileHandle.h>
+#include <HAL/PlatformFileManager.h>
+#include <Hash/CityHash.h>
+#include <Misc/FileHelper.h>
+#include <ReferenceSkeleton.h>
+
+using ASLMetaHuman::Codec::FRawSignTracks;
+using ASLMetaHuman::Core::FSignPack;
+using ASLMetaHuman::Core::FSignPackBone;
+using ASLMetaHuman::Core::FSignPackClip;
+using ASLMetaHuman::Core::FSignPackHeader;
+using ASLMetaHuman::Core::FSignPackRecord;
+using ASLMetaHuman::Core::FSignPoseTracks;
+
+namespace {
+constexpr uint32 PackMagic {0x504C5341};    // "ASLP"
+constexpr uint32 PackVersion {1};
+// Clips start on a cache line (the decoder needs 4-byte alignment)
+//
+constexpr uint64 ClipAlignment {64};
+constexpr auto & ErrorPackInvalidFormatted = TEXT("Sign pack %s is invalid or out of date (rebuild it with -run=SignPack)");
+constexpr auto & ErrorClipInvalidFormatted = TEXT("Sign pack: tracks of %s are invalid");
+
+static_assert(static_cast<int32>(ASLMetaHuman::Codec::CHANNEL_COUNT) == FSignPoseTracks::CHANNEL_COUNT,
+        "The codec and the pose cache must share their channel layout");
+
+uint64 HashContents(const uint8 * Data, const int64 Size) {
+    return CityHash64(reinterpret_cast<const char *>(Data), static_cast<uint32>(Size));
+}
+}
+
+FSignPack::FSignPack() = default;
+
+FSignPack::~FSignPack() {
+    // Note: the region must be released before its file
+    //
+    MappedRegion.Reset();
+    MappedFile.Reset();
+}
+
+// Key frames are sampled at their exact times, so the tracks hold the decompressed keys themselves
+//
+bool FSignPack::ExtractTracks(const UAnimSequence & Sequence, FRawSignTracks & Tracks) {
+    const auto PoseTracks = FSignPoseTracks::Build(Sequence);
+    if (! PoseTracks.IsValid()) {
+        return false;
+    }
+    Tracks.BoneCount = static_cast<uint32_t>(PoseTracks->GetBoneCount());
+    Tracks.FrameCount = static_cast<uint32_t>(PoseTracks->GetFrameCount());
+    Tracks.FrameRate = PoseTracks->GetFrameRate();
+    const size_t FrameValueCount = static_cast<size_t>(FSignPoseTracks::CHANNEL_COUNT) * Tracks.BoneCount;
+    Tracks.Values.resize(Tracks.FrameCount * FrameValueCount);
+    const int32 PaddedBoneCount = PoseTracks->GetPaddedBoneCount();
+    TArray<float, TAlignedHeapAllocator<32>> Pose;
+    Pose.SetNumUninitialized(FSignPoseTracks::CHANNEL_COUNT * PaddedBoneCount);
+    for (uint32_t Frame = 0; Frame < Tracks.FrameCount; Frame++) {
+        PoseTracks->Sample(static_cast<float>(Frame) / Tracks.FrameRate, Pose.GetData());
+        float * FrameValues = &Tracks.Values[Frame * FrameValueCount];
+        for (int32 Channel = 0; Channel < FSignPoseTracks::CHANNEL_COUNT; Channel++) {
+            FMemory::Memcpy(FrameValues + Channel * Tracks.BoneCount, Pose.GetData() + Channel * PaddedBoneCount,
+                    Tracks.BoneCount * sizeof(float));
+        }
+    }
+    return true;
+}
+
+uint64 FSignPack::Write(const FString & FilePath, const TArray<FName> & BoneNames, TArray<FEntry> Entries) {
+    Entries.Sort([](const FEntry & A, const FEntry & B) {
+        return A.SignName < B.SignName;
+    });
+    TArray<uint8> StringPool;
+    const auto AppendString = [&StringPool](const FString & String, uint32 & Offset, uint32 & Length) {
+        const FTCHARToUTF8 Utf8String(*String);
+        Offset = static_cast<uint32>(StringPool.Num());
+        Length = static_cast<uint32>(Utf8String.Length());
+        StringPool.Append(reinterpret_cast<const uint8 *>(Utf8String.Get()), Utf8String.Length());
+    };
+    TArray<FSignPackBone> BoneList;
+    BoneList.Reserve(BoneNames.Num());
+    for (const FName & BoneName: BoneNames) {
+        FSignPackBone Bone;
+        AppendString(BoneName.ToString(), Bone.NameOffset, Bone.NameLength);
+        BoneList.Add(Bone);
+    }
+    const uint64 IndexSize = sizeof(FSignPackHeader) + Entries.Num() * sizeof(FSignPackRecord)
+            + BoneList.Num() * sizeof(FSignPackBone);
+    // Strings are sized last: the clips follow them, aligned
+    //
+    TArray<FSignPackRecord> RecordList;
+    RecordList.Reserve(Entries.Num());
+    for (const auto & Entry: Entries) {
+        FSignPackRecord Record;
+        AppendString(Entry.SignName, Record.NameOffset, Record.NameLength);
+        Record.WordCount = Entry.WordCount;
+        Record.PlayLength = Entry.PlayLength;
+        Record.ClipSize = Entry.Clip.size();
+        RecordList.Add(Record);
+    }
+    const uint64 ClipsOffset = Align(IndexSize + StringPool.Num(), ClipAlignment);
+    uint64 ClipOffset = ClipsOffset;
+    for (auto & Record: RecordList) {
+        Record.ClipOffset = ClipOffset;
+        ClipOffset = Align(ClipOffset + Record.ClipSize, ClipAlignment);
+    }
+    TArray<uint8> Contents;
+    Contents.Append(
+            reinterpret_cast<const uint8 *>(RecordList.GetData()), RecordList.Num() * sizeof(FSignPackRecord));
+    Contents.Append(reinterpret_cast<const uint8 *>(BoneList.GetData()), BoneList.Num() * sizeof(FSignPackBone));
+    Contents.Append(StringPool);
+    FSignPackHeader PackHeader;
+    PackHeader.Magic = PackMagic;
+    PackHeader.Version = PackVersion;
+    PackHeader.SignCount = static_cast<uint32>(RecordList.Num());
+    PackHeader.BoneCount = static_cast<uint32>(BoneList.Num());
+    PackHeader.StringsSize = static_cast<uint32>(StringPool.Num());
+    PackHeader.Reserved = 0;
+    PackHeader.ClipsOffset = ClipsOffset;
+    PackHeader.ClipsSize = ClipOffset - ClipsOffset;
+    PackHeader.DictionaryHash = HashContents(Contents.GetData(), Contents.Num());
+    TArray64<uint8> FileContents;
+    FileContents.Reserve(ClipOffset);
+    FileContents.Append(reinterpret_cast<const uint8 *>(&PackHeader), sizeof(FSignPackHeader));
+    FileContents.Append(Contents);
+    for (int32 i = 0; i < Entries.Num(); i++) {
+        FileContents.SetNumZeroed(RecordList[i].ClipOffset);
+        FileContents.Append(Entries[i].Clip.data(), Entries[i].Clip.size());
+    }
+    FileContents.SetNumZeroed(ClipOffset);
+    if (! FFileHelper::SaveArrayToFile(FileContents, *FilePath)) {
+        return 0;
+    }
+    return PackHeader.DictionaryHash;
+}
+
+bool FSignPack::Open(const FString & FilePath) {
+    auto & PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (! PlatformFile.FileExists(*FilePath)) {
+        return false;
+    }
+    MappedFile.Reset(PlatformFile.OpenMapped(*FilePath));
+    if (nullptr != MappedFile) {
+        MappedRegion.Reset(MappedFile->MapRegion());
+    }
+    bool Indexed;
+    if (nullptr != MappedRegion) {
+        Indexed = IndexContents(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+    } else {
+        Indexed = FFileHelper::LoadFileToArray(FileData, *FilePath)
+                && IndexContents(FileData.GetData(), FileData.Num());
+    }
+    if (! Indexed) {
+        UE_LOG(LogTemp, Warning, ErrorPackInvalidFormatted, *FilePath);
+    }
+    return Indexed;
+}
+
+// Validates the layout and hash of the index (only its pages are touched); points Header/Records/Bones/Strings into
+// the file
+//
+bool FSignPack::IndexContents(const uint8 * InData, const int64 Size) {
+    Header = nullptr;
+    if ((nullptr == InData) || (Size < static_cast<int64>(sizeof(FSignPackHeader)))) {
+        return false;
+    }
+    const auto FileHeader = reinterpret_cast<const FSignPackHeader *>(InData);
+    const int64 RecordsSize = static_cast<int64>(FileHeader->SignCount) * sizeof(FSignPackRecord);
+    const int64 BonesSize = static_cast<int64>(FileHeader->BoneCount) * sizeof(FSignPackBone);
+    const int64 IndexSize =
+            static_cast<int64>(sizeof(FSignPackHeader)) + RecordsSize + BonesSize + FileHeader->StringsSize;
+    if ((PackMagic != FileHeader->Magic) || (PackVersion != FileHeader->Version) || (IndexSize > Size)
+            || (FileHeader->ClipsOffset < static_cast<uint64>(IndexSize))
+            || (FileHeader->ClipsOffset + FileHeader->ClipsSize != static_cast<uint64>(Size))) {
+        return false;
+    }
+    const uint8 * Contents = InData + sizeof(FSignPackHeader);
+    if (FileHeader->DictionaryHash != HashContents(Contents, RecordsSize + BonesSize + FileHeader->StringsSize)) {
+        return false;
+    }
+    Records = reinterpret_cast<const FSignPackRecord *>(Contents);
+    Bones = reinterpret_cast<const FSignPackBone *>(Contents + RecordsSize);
+    Strings = reinterpret_cast<const UTF8CHAR *>(Contents + RecordsSize + BonesSize);
+    for (uint32 i = 0; i < FileHeader->SignCount; i++) {
+        const auto & Record = Records[i];
+        if ((static_cast<uint64>(Record.NameOffset) + Record.NameLength > FileHeader->StringsSize)
+                || (Record.ClipOffset < FileHeader->ClipsOffset)
+                || (Record.ClipOffset + Record.ClipSize > static_cast<uint64>(Size))
+                || (0 != Record.ClipOffset % ClipAlignment)) {
+            return false;
+        }
+    }
+    for (uint32 i = 0; i < FileHeader->BoneCount; i++) {
+        if (static_cast<uint64>(Bones[i].NameOffset) + Bones[i].NameLength > FileHeader->StringsSize) {
+            return false;
+        }
+    }
+    Data = InData;
+    Header = FileHeader;
+    return true;
+}
+
+FString FSignPack::GetString(const uint32 Offset, const uint32 Length) const {
+    return FString(FUtf8StringView(Strings + Offset, Length));
+}
+
+FString FSignPack::GetSignName(const int32 Index) const {
+    return GetString(Records[Index].NameOffset, Records[Index].NameLength);
+}
+
+int32 FSignPack::Find(const FString & SignName) const {
+    int32 Low = 0;
+    int32 High = Num() - 1;
+    while (Low <= High) {
+        const int32 Middle = Low + (High - Low) / 2;
+        const FString & MiddleName = GetSignName(Middle);
+        if (MiddleName == SignName) {
+            return Middle;
+        }
+        if (MiddleName < SignName) {
+            Low = Middle + 1;
+        } else {
+            High = Middle - 1;
+        }
+    }
+    return INDEX_NONE;
+}
+
+TArray<int32> FSignPack::MapBones(const FReferenceSkeleton & Skeleton) const {
+    TMap<FName, int32> PackBones;
+    const int32 BoneCount = nullptr == Header ? 0 : static_cast<int32>(Header->BoneCount);
+    PackBones.Reserve(BoneCount);
+    for (int32 i = 0; i < BoneCount; i++) {
+        PackBones.Add(FName(GetString(Bones[i].NameOffset, Bones[i].NameLength)), i);
+    }
+    TArray<int32> BoneMap;
+    BoneMap.Init(INDEX_NONE, Skeleton.GetNum());
+    for (int32 i = 0; i < Skeleton.GetNum(); i++) {
+        if (const int32 * PackBone = PackBones.Find(Skeleton.GetBoneName(i))) {
+            BoneMap[i] = *PackBone;
+        }
+    }
+    return BoneMap;
+}
+
+// Note: opening the decoder reads the clip's header and static tracks - the first page fault of a sign happens here
+//
+TSharedPtr<const FSignPackClip> FSignPackClip::Create(const TSharedRef<const FSignPack> & InPack, const int32 InIndex) {
+    if ((0 > InIndex) || (InIndex >= InPack->Num())) {
+        return nullptr;
+    }
+    TSharedPtr<FSignPackClip> Clip(new FSignPackClip(InPack));
+    if (! Clip->Decoder.Open(InPack->GetClipData(InIndex), InPack->GetClipSize(InIndex))) {
+        UE_LOG(LogTemp, Warning, ErrorClipInvalidFormatted, *InPack->GetSignName(InIndex));
+        return nullptr;
+    }
+    return Clip;
+}
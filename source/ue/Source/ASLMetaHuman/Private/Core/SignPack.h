@@ -0,0 +1,188 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Sign pack: ASL signs shipped as one data file instead of cooked animation sequences - the sign index, the sign
+// metadata and the compressed pose tracks (see Codec/SignTrackCodec.h), written by the SignPack commandlet. The file is
+// memory-mapped and used in place (no deserialization): opening it validates the index, and a sign's tracks are paged
+// in when it's first played.
+//
+// Layout (little endian): FSignPackHeader | FSignPackRecord[SignCount] (sorted by sign name) | FSignPackBone[BoneCount]
+// | UTF-8 strings | clips (each ClipAlignment-aligned). Tracks are indexed by the bones of the pack (matched to a
+// skeleton by name). The dictionary hash covers the records, bones and strings (not the clips, which are only read on
+// demand).
+//
+
+#include <CoreMinimal.h>
+
+#include "Codec/SignTrackCodec.h"
+
+#include <vector>
+
+struct IMappedFileHandle;
+struct IMappedFileRegion;
+struct FReferenceSkeleton;
+class UAnimSequence;
+
+namespace ASLMetaHuman::Core {
+
+struct FSignPackHeader {
+    uint32 Magic;
+    uint32 Version;
+    uint32 SignCount;
+    uint32 BoneCount;
+    uint32 StringsSize;
+    uint32 Reserved;
+    uint64 ClipsOffset;
+    uint64 ClipsSize;
+    uint64 DictionaryHash;
+};
+
+struct FSignPackRecord {
+    uint32 NameOffset;
+    uint32 NameLength;
+    uint32 WordCount;
+    float PlayLength;
+    uint64 ClipOffset;
+    uint64 ClipSize;
+};
+
+struct FSignPackBone {
+    uint32 NameOffset;
+    uint32 NameLength;
+};
+
+class FSignPack {
+public:
+    struct FEntry {
+        FString SignName;
+        uint32 WordCount {0};
+        float PlayLength {0.0f};
+        std::vector<uint8_t> Clip;
+    };
+
+    FSignPack();
+    ~FSignPack();
+
+    // Decompresses the key frames of Sequence (all bones of its skeleton, in skeleton order) as input for the codec.
+    // Returns false if it has no skeleton or keys
+    //
+    static bool ExtractTracks(const UAnimSequence & Sequence, ASLMetaHuman::Codec::FRawSignTracks & Tracks);
+
+    // Writes Entries (in any order, encoded against BoneNames) to FilePath. Returns the dictionary hash, or 0 if the
+    // file couldn't be written
+    //
+    static uint64 Write(const FString & FilePath, const TArray<FName> & BoneNames, TArray<FEntry> Entries);
+
+    // Maps the pack into memory (falls back to reading it, e.g. from a pak file). Returns false if the file is missing
+    // or invalid
+    //
+    bool Open(const FString & FilePath);
+
+    int32 Num() const {
+        return nullptr == Header ? 0 : static_cast<int32>(Header->SignCount);
+    }
+
+    FString GetSignName(const int32 Index) const;
+
+    uint32 GetWordCount(const int32 Index) const {
+        return Records[Index].WordCount;
+    }
+
+    float GetPlayLength(const int32 Index) const {
+        return Records[Index].PlayLength;
+    }
+
+    // Returns the index of a sign (binary search), or INDEX_NONE
+    //
+    int32 Find(const FString & SignName) const;
+
+    // Maps each bone of Skeleton to its pack bone (INDEX_NONE if the pack has no such bone)
+    //
+    TArray<int32> MapBones(const FReferenceSkeleton & Skeleton) const;
+
+    // Compressed tracks of a sign (within the mapped file)
+    //
+    const uint8 * GetClipData(const int32 Index) const {
+        return Data + Records[Index].ClipOffset;
+    }
+
+    uint64 GetClipSize(const int32 Index) const {
+        return Records[Index].ClipSize;
+    }
+
+    // Layout of the file (see FSignPackManifest, which splits it into chunks): the index, then the clips in sign order
+    //
+    const uint8 * GetFileData() const {
+        return Data;
+    }
+
+    uint64 GetFileSize() const {
+        return nullptr == Header ? 0 : Header->ClipsOffset + Header->ClipsSize;
+    }
+
+    uint64 GetClipsOffset() const {
+        return nullptr == Header ? 0 : Header->ClipsOffset;
+    }
+
+    uint64 GetClipOffset(const int32 Index) const {
+        return Records[Index].ClipOffset;
+    }
+
+private:
+    bool IndexContents(const uint8 * InData, const int64 Size);
+    FString GetString(const uint32 Offset, const uint32 Length) const;
+
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TArray64<uint8> FileData;
+    const uint8 * Data {nullptr};
+    const FSignPackHeader * Header {nullptr};
+    const FSignPackRecord * Records {nullptr};
+    const FSignPackBone * Bones {nullptr};
+    const UTF8CHAR * Strings {nullptr};
+};
+
+// A playable sign of a pack: decodes its tracks in place (keeps the pack mapped while in use)
+//
+class FSignPackClip {
+public:
+    // Returns nullptr if the sign's tracks are invalid
+    //
+    static TSharedPtr<const FSignPackClip> Create(const TSharedRef<const FSignPack> & InPack, const int32 InIndex);
+
+    const FSignPack & GetPack() const {
+        return *Pack;
+    }
+
+    const ASLMetaHuman::Codec::FSignTrackDecoder & GetDecoder() const {
+        return Decoder;
+    }
+
+    float GetPlayLength() const {
+        return Decoder.GetPlayLength();
+    }
+
+private:
+    FSignPackClip(const TSharedRef<const FSignPack> & InPack): Pack(InPack) {
+    }
+
+    TSharedRef<const FSignPack> Pack;
+    ASLMetaHuman::Codec::FSignTrackDecoder Decoder;
+};
+}
@@ -0,0 +1,439 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Publishes sign packs as content-addressed chunks and syncs them from S3 (see SignPackSync.h)
+//
+
+#include "SignPackSync.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+#include "SignPack.h"
+
+#include <Async/Async.h>
+#include <Hash/Blake3.h>
+#include <Hash/CityHash.h>
+#include <Misc/FileHelper.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FCrtS3Download;
+using ASLMetaHuman::Core::FCrtS3Downloader;
+using ASLMetaHuman::Core::FSignPack;
+using ASLMetaHuman::Core::FSignPackManifest;
+using ASLMetaHuman::Core::FSignPackSync;
+
+namespace {
+constexpr int32 ManifestVersion {1};
+// Content-defined chunking: a chunk of clips ends after a clip whose hash is a multiple of ClipsPerChunk (i.e. about
+// ClipsPerChunk clips per chunk), or once it reaches MaxChunkSize
+//
+constexpr uint64 ClipsPerChunk {16};
+constexpr uint64 MaxChunkSize {4 * 1024 * 1024};
+// Larger chunks (e.g. the index of a big vocabulary) are fetched as parallel ranged GETs of this size
+//
+constexpr uint64 PartSize {1024 * 1024};
+// Chunk downloads in flight (the CRT client spreads them over its connection pool)
+//
+constexpr int32 MaxChunksInFlight {32};
+constexpr auto & ManifestFileName = TEXT("SignPack.json");
+constexpr auto & ChunksDirName = TEXT("chunks");
+constexpr auto & PacksDirName = TEXT("packs");
+constexpr auto & CacheDirName = TEXT("SignPackCache");
+constexpr auto & PackFileExtension = TEXT(".signpack");
+constexpr auto & PartialFileSuffix = TEXT(".partial");
+constexpr auto & VersionField = TEXT("Version");
+constexpr auto & ChunksField = TEXT("Chunks");
+constexpr auto & HashField = TEXT("Hash");
+constexpr auto & SizeField = TEXT("Size");
+// Chunk hashes are BLAKE3 hashes as lowercase hex (see GetHash)
+//
+constexpr int32 HashLength {2 * sizeof(FBlake3Hash::ByteArray)};
+// Logging
+//
+constexpr auto & ErrorManifestDownloadFormatted = TEXT("Sign pack sync: manifest %s not downloaded: %s");
+constexpr auto & ErrorManifestInvalidFormatted = TEXT("Sign pack sync: manifest %s is invalid");
+constexpr auto & ErrorChunkDownloadFormatted = TEXT("Sign pack sync: chunk %s not downloaded: %s");
+constexpr auto & ErrorChunkHashFormatted = TEXT("Sign pack sync: chunk %s doesn't match its hash");
+constexpr auto & ErrorChunkWriteFormatted = TEXT("Sign pack sync: failed to write %s");
+constexpr auto & ErrorAssembleFormatted = TEXT("Sign pack sync: failed to assemble %s");
+constexpr auto & InfoPackSyncedFormatted = TEXT("Sign pack sync: pack %s installed: %d of %d chunks downloaded (%.1f of %.1f MB) in %.1f ms");
+constexpr auto & InfoCachedPackFormatted = TEXT("Sign pack sync: cached pack %s installed");
+constexpr auto & InfoPackPublishedFormatted = TEXT("Published %s as %d chunks to %s (manifest %s)");
+
+FString GetHash(const uint8 * Data, const int64 Size) {
+    return LexToString(FBlake3::HashBuffer(Data, Size));
+}
+
+// A chunk hash from a manifest names files in the cache and S3 keys: anything but a hash (e.g. a path) is
+// rejected
+//
+bool IsValidHash(const FString & Hash) {
+    if (HashLength != Hash.Len()) {
+        return false;
+    }
+    for (const TCHAR Character: Hash) {
+        if (! (((TEXT('0') <= Character) && (Character <= TEXT('9')))
+                || ((TEXT('a') <= Character) && (Character <= TEXT('f'))))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes through a partial file, so that a file in the cache is always complete
+//
+bool SaveFile(const TArrayView64<const uint8> & Contents, const FString & FilePath) {
+    const FString & PartialPath = FilePath + PartialFileSuffix;
+    return FFileHelper::SaveArrayToFile(Contents, *PartialPath) && IFileManager::Get().Move(*FilePath, *PartialPath);
+}
+}
+
+int64 FSignPackManifest::GetPackSize() const {
+    int64 PackSize = 0;
+    for (const auto & Chunk: Chunks) {
+        PackSize += Chunk.Size;
+    }
+    return PackSize;
+}
+
+FString FSignPackManifest::GetId() const {
+    FString ChunkList;
+    for (const auto & Chunk: Chunks) {
+        ChunkList += FString::Printf(TEXT("%s:%lld\n"), *Chunk.Hash, Chunk.Size);
+    }
+    const FTCHARToUTF8 ChunkListUtf8(*ChunkList);
+    return GetHash(reinterpret_cast<const uint8 *>(ChunkListUtf8.Get()), ChunkListUtf8.Length());
+}
+
+FString FSignPackManifest::ToJson() const {
+    const auto ManifestObject = MakeShared<FJsonObject>();
+    ManifestObject->SetNumberField(VersionField, ManifestVersion);
+    TArray<TSharedPtr<FJsonValue>> ChunkValues;
+    for (const auto & Chunk: Chunks) {
+        const auto ChunkObject = MakeShared<FJsonObject>();
+        ChunkObject->SetStringField(HashField, Chunk.Hash);
+        ChunkObject->SetNumberField(SizeField, static_cast<double>(Chunk.Size));
+        ChunkValues.Add(MakeShared<FJsonValueObject>(ChunkObject));
+    }
+    ManifestObject->SetArrayField(ChunksField, ChunkValues);
+    FString Json;
+    const auto Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(ManifestObject, Writer);
+    return Json;
+}
+
+bool FSignPackManifest::FromJson(const FString & Json, FSignPackManifest & Manifest) {
+    TSharedPtr<FJsonObject> ManifestObject;
+    const auto & Reader = TJsonReaderFactory<>::Create(Json);
+    if ((! FJsonSerializer::Deserialize(Reader, ManifestObject)) || (! ManifestObject.IsValid())
+            || (ManifestVersion != ManifestObject->GetIntegerField(VersionField))) {
+        return false;
+    }
+    const TArray<TSharedPtr<FJsonValue>> * ChunkValues = nullptr;
+    if (! ManifestObject->TryGetArrayField(ChunksField, ChunkValues)) {
+        return false;
+    }
+    Manifest.Chunks.Reset();
+    for (const auto & ChunkValue: *ChunkValues) {
+        const TSharedPtr<FJsonObject> * ChunkObject = nullptr;
+        FChunk Chunk;
+        if ((! ChunkValue->TryGetObject(ChunkObject)) || (! (*ChunkObject)->TryGetStringField(HashField, Chunk.Hash))
+                || (! IsValidHash(Chunk.Hash)) || (! (*ChunkObject)->TryGetNumberField(SizeField, Chunk.Size))
+                || (Chunk.Size <= 0)) {
+            return false;
+        }
+        Manifest.Chunks.Add(Chunk);
+    }
+    return ! Manifest.Chunks.IsEmpty();
+}
+
+// The index is one chunk; clips (with their alignment padding, so they don't depend on their position in the file)
+// are grouped into content-defined chunks
+//
+bool FSignPackManifest::Publish(const FString & PackPath, const FString & OutputDir, FSignPackManifest & Manifest) {
+    FSignPack SignPack;
+    if (! SignPack.Open(PackPath)) {
+        return false;
+    }
+    Manifest.Chunks.Reset();
+    const uint8 * Data = SignPack.GetFileData();
+    const auto AddChunk = [&Manifest, &OutputDir, Data](const uint64 Start, const uint64 End) {
+        FChunk Chunk;
+        Chunk.Size = static_cast<int64>(End - Start);
+        Chunk.Hash = GetHash(Data + Start, Chunk.Size);
+        Manifest.Chunks.Add(Chunk);
+        return SaveFile(TArrayView64<const uint8>(Data + Start, Chunk.Size),
+                FPaths::Combine(OutputDir, ChunksDirName, Chunk.Hash));
+    };
+    if (! AddChunk(0, SignPack.GetClipsOffset())) {
+        return false;
+    }
+    uint64 ChunkStart = SignPack.GetClipsOffset();
+    for (int32 i = 0; i < SignPack.Num(); i++) {
+        const uint64 ClipEnd = i + 1 < SignPack.Num() ? SignPack.GetClipOffset(i + 1) : SignPack.GetFileSize();
+        const uint64 ClipHash = CityHash64(
+                reinterpret_cast<const char *>(SignPack.GetClipData(i)), static_cast<uint32>(SignPack.GetClipSize(i)));
+        if ((0 == ClipHash % ClipsPerChunk) || (ClipEnd - ChunkStart >= MaxChunkSize) || (i + 1 == SignPack.Num())) {
+            if (! AddChunk(ChunkStart, ClipEnd)) {
+                return false;
+            }
+            ChunkStart = ClipEnd;
+        }
+    }
+    const FString & ManifestPath = FPaths::Combine(OutputDir, ManifestFileName);
+    if (! FFileHelper::SaveStringToFile(Manifest.ToJson(), *ManifestPath)) {
+        return false;
+    }
+    UE_LOG(LogTemp, Display, InfoPackPublishedFormatted, *PackPath, Manifest.Chunks.Num(), *OutputDir,
+            *Manifest.GetId());
+    return true;
+}
+
+FSignPackSync::FSignPackSync(const TFunction<void(const TSharedRef<const FSignPack> &)> & InOnPackSynced):
+    OnPackSynced {InOnPackSynced},
+    Bucket {FInternalSettings::GetSignPackSyncBucket()},
+    Prefix {FInternalSettings::GetSignPackSyncPrefix()},
+    CacheDir {FPaths::Combine(FPaths::ProjectSavedDir(), CacheDirName)},
+    StopSyncEvent {FPlatformProcess::GetSynchEventFromPool(true)} {
+    if ((! Prefix.IsEmpty()) && (! Prefix.EndsWith(TEXT("/")))) {
+        Prefix += TEXT("/");
+    }
+}
+
+FSignPackSync::~FSignPackSync() {
+    StopSyncEvent->Trigger();
+    if (SyncFuture.IsValid()) {
+        SyncFuture.Wait();
+    }
+    Downloader.Reset();
+    FPlatformProcess::ReturnSynchEventToPool(StopSyncEvent);
+    StopSyncEvent = nullptr;
+}
+
+// Note: the cached pack makes new signs available offline and before the first sync completes
+//
+void FSignPackSync::Start() {
+    InstallCachedPack();
+    FCrtS3Downloader::FOptions Options;
+    Options.Region = FInternalSettings::GetSignPackSyncRegion();
+    Options.EndpointOverride = FInternalSettings::GetSignPackSyncEndpointOverride();
+    Options.PartSize = PartSize;
+    Downloader = MakeUnique<FCrtS3Downloader>(Options);
+    if (! Downloader->IsValid()) {
+        return;
+    }
+    SyncFuture = Async(EAsyncExecution::Thread, [this]() {
+        RunSync();
+    });
+}
+
+void FSignPackSync::RunSync() {
+    const float IntervalSeconds = FInternalSettings::GetSignPackSyncIntervalSeconds();
+    do {
+        Sync();
+    } while ((IntervalSeconds > 0.0f) && (! StopSyncEvent->Wait(FTimespan::FromSeconds(IntervalSeconds)))
+            && (! FGlobalState::IsAborting()));
+}
+
+bool FSignPackSync::Sync() {
+    const double StartSeconds = FPlatformTime::Seconds();
+    FString ManifestJson;
+    if (! DownloadManifest(ManifestJson)) {
+        return false;
+    }
+    FSignPackManifest Manifest;
+    if (! FSignPackManifest::FromJson(ManifestJson, Manifest)) {
+        UE_LOG(LogTemp, Error, ErrorManifestInvalidFormatted, *(Prefix + ManifestFileName));
+        return false;
+    }
+    const FString & ManifestId = Manifest.GetId();
+    if (ManifestId == InstalledManifestId) {
+        return true;
+    }
+    int64 MissingBytes = 0;
+    int32 MissingChunks = 0;
+    for (const auto & Chunk: Manifest.Chunks) {
+        if (! FPaths::FileExists(GetChunkPath(Chunk.Hash))) {
+            MissingBytes += Chunk.Size;
+            MissingChunks++;
+        }
+    }
+    const FString & PackFilePath = GetPackPath(ManifestId);
+    if ((! FPaths::FileExists(PackFilePath))
+            && ((! DownloadChunks(Manifest)) || (! AssemblePack(Manifest, PackFilePath)))) {
+        return false;
+    }
+    if (! InstallPack(PackFilePath)) {
+        return false;
+    }
+    InstalledManifestId = ManifestId;
+    FFileHelper::SaveStringToFile(ManifestJson, *FPaths::Combine(CacheDir, ManifestFileName));
+    PruneCache(Manifest);
+    UE_LOG(LogTemp, Log, InfoPackSyncedFormatted, *ManifestId, MissingChunks, Manifest.Chunks.Num(),
+            MissingBytes / (1024.0 * 1024.0), Manifest.GetPackSize() / (1024.0 * 1024.0),
+            (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    return true;
+}
+
+bool FSignPackSync::InstallCachedPack() {
+    FString ManifestJson;
+    FSignPackManifest Manifest;
+    if ((! FFileHelper::LoadFileToString(ManifestJson, *FPaths::Combine(CacheDir, ManifestFileName)))
+            || (! FSignPackManifest::FromJson(ManifestJson, Manifest))) {
+        return false;
+    }
+    const FString & ManifestId = Manifest.GetId();
+    const FString & PackFilePath = GetPackPath(ManifestId);
+    if ((! FPaths::FileExists(PackFilePath)) || (! InstallPack(PackFilePath))) {
+        return false;
+    }
+    InstalledManifestId = ManifestId;
+    UE_LOG(LogTemp, Log, InfoCachedPackFormatted, *ManifestId);
+    return true;
+}
+
+bool FSignPackSync::DownloadManifest(FString & ManifestJson) const {
+    const FString & ManifestKey = Prefix + ManifestFileName;
+    const auto Download = Downloader->Get(Bucket, ManifestKey);
+    if (nullptr == Download) {
+        return false;
+    }
+    if (! Download->Wait(FInternalSettings::GetSignPackSyncTimeoutSeconds())) {
+        UE_LOG(LogTemp, Error, ErrorManifestDownloadFormatted, *ManifestKey, *Download->GetError());
+        return false;
+    }
+    const auto & Body = Download->GetBody();
+    FFileHelper::BufferToString(ManifestJson, Body.GetData(), static_cast<int32>(Body.Num()));
+    return true;
+}
+
+// Downloads the chunks missing from the cache, up to MaxChunksInFlight at a time. Chunks are verified against their
+// hash before they enter the cache
+//
+bool FSignPackSync::DownloadChunks(const FSignPackManifest & Manifest) const {
+    TArray<FString> MissingHashes;
+    for (const auto & Chunk: Manifest.Chunks) {
+        if ((! MissingHashes.Contains(Chunk.Hash)) && (! FPaths::FileExists(GetChunkPath(Chunk.Hash)))) {
+            MissingHashes.Add(Chunk.Hash);
+        }
+    }
+    TArray<TSharedPtr<FCrtS3Download>> Downloads;
+    int32 NextHash = 0;
+    bool Succeeded = true;
+    while (Succeeded && ((NextHash < MissingHashes.Num()) || (! Downloads.IsEmpty()))) {
+        while ((NextHash < MissingHashes.Num()) && (Downloads.Num() < MaxChunksInFlight)) {
+            const auto Download = Downloader->Get(Bucket, Prefix + ChunksDirName + TEXT("/") + MissingHashes[NextHash]);
+            if (nullptr == Download) {
+                Succeeded = false;
+                break;
+            }
+            Downloads.Add(Download);
+            NextHash++;
+        }
+        if (Downloads.IsEmpty()) {
+            break;
+        }
+        const auto Download = Downloads[0];
+        Downloads.RemoveAt(0);
+        const FString & Hash = FPaths::GetCleanFilename(Download->GetKey());
+        if (! Download->Wait(FInternalSettings::GetSignPackSyncTimeoutSeconds())) {
+            UE_LOG(LogTemp, Error, ErrorChunkDownloadFormatted, *Hash, *Download->GetError());
+            Succeeded = false;
+        } else if (GetHash(Download->GetBody().GetData(), Download->GetBody().Num()) != Hash) {
+            UE_LOG(LogTemp, Error, ErrorChunkHashFormatted, *Hash);
+            Succeeded = false;
+        } else if (! SaveFile(Download->GetBody(), GetChunkPath(Hash))) {
+            UE_LOG(LogTemp, Error, ErrorChunkWriteFormatted, *GetChunkPath(Hash));
+            Succeeded = false;
+        }
+    }
+    for (const auto & Download: Downloads) {
+        Download->Cancel();
+    }
+    return Succeeded;
+}
+
+bool FSignPackSync::AssemblePack(const FSignPackManifest & Manifest, const FString & PackFilePath) const {
+    const FString & PartialPath = PackFilePath + PartialFileSuffix;
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*PartialPath));
+    bool Succeeded = nullptr != Writer;
+    TArray64<uint8> Chunk;
+    for (int32 i = 0; Succeeded && (i < Manifest.Chunks.Num()); i++) {
+        Succeeded = FFileHelper::LoadFileToArray(Chunk, *GetChunkPath(Manifest.Chunks[i].Hash))
+                && (Chunk.Num() == Manifest.Chunks[i].Size);
+        if (Succeeded) {
+            Writer->Serialize(Chunk.GetData(), Chunk.Num());
+        }
+    }
+    if (nullptr != Writer) {
+        Succeeded = Writer->Close() && Succeeded;
+        Writer.Reset();
+    }
+    if ((! Succeeded) || (! IFileManager::Get().Move(*PackFilePath, *PartialPath))) {
+        IFileManager::Get().Delete(*PartialPath);
+        UE_LOG(LogTemp, Error, ErrorAssembleFormatted, *PackFilePath);
+        return false;
+    }
+    return true;
+}
+
+bool FSignPackSync::InstallPack(const FString & PackFilePath) {
+    const auto SignPack = MakeShared<FSignPack>();
+    if (! SignPack->Open(PackFilePath)) {
+        // Note: reassembled from the chunks on the next sync
+        //
+        IFileManager::Get().Delete(*PackFilePath);
+        return false;
+    }
+    OnPackSynced(SignPack);
+    return true;
+}
+
+// Keeps the chunks and the pack of Manifest. Note: a previous pack that is still mapped (clips still playing) may not
+// be deletable yet; it's retried on the next sync
+//
+void FSignPackSync::PruneCache(const FSignPackManifest & Manifest) const {
+    TSet<FString> ChunkHashes;
+    for (const auto & Chunk: Manifest.Chunks) {
+        ChunkHashes.Add(Chunk.Hash);
+    }
+    TArray<FString> FileNames;
+    IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(CacheDir, ChunksDirName, TEXT("*")), true, false);
+    for (const auto & FileName: FileNames) {
+        if (! ChunkHashes.Contains(FileName)) {
+            IFileManager::Get().Delete(*FPaths::Combine(CacheDir, ChunksDirName, FileName));
+        }
+    }
+    const FString & PackFileName = FPaths::GetCleanFilename(GetPackPath(InstalledManifestId));
+    IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(CacheDir, PacksDirName, TEXT("*")), true, false);
+    for (const auto & FileName: FileNames) {
+        if (FileName != PackFileName) {
+            IFileManager::Get().Delete(*FPaths::Combine(CacheDir, PacksDirName, FileName), false, false, true);
+        }
+    }
+}
+
+FString FSignPackSync::GetChunkPath(const FString & Hash) const {
+    return FPaths::Combine(CacheDir, ChunksDirName, Hash);
+}
+
+FString FSignPackSync::GetPackPath(const FString & ManifestId) const {
+    return FPaths::Combine(CacheDir, PacksDirName, ManifestId + PackFileExtension);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Sign pack sync: new signs without recooking. A published sign pack is split into content-addressed chunks - its
+// index, then runs of clips, cut after a clip whose hash says so (content-defined: adding or changing a sign only
+// changes the index and the chunk holding its clip) - stored in S3 as <Prefix>chunks/<BLAKE3 hash>, with a manifest
+// (<Prefix>SignPack.json) listing the chunks in order. The sync downloads the manifest, fetches the chunks missing from
+// the local cache (Saved/SignPackCache/chunks) with parallel ranged GETs (see FCrtS3Downloader), reassembles the pack
+// and swaps it into the dictionary.
+//
+
+#include <CoreMinimal.h>
+
+#include "CrtS3Downloader.h"
+
+namespace ASLMetaHuman::Core {
+
+class FSignPack;
+
+struct FSignPackManifest {
+    struct FChunk {
+        FString Hash;
+        int64 Size {0};
+    };
+
+    TArray<FChunk> Chunks;
+
+    int64 GetPackSize() const;
+
+    // Identifies the pack contents (hash of the chunk list)
+    //
+    FString GetId() const;
+
+    FString ToJson() const;
+    static bool FromJson(const FString & Json, FSignPackManifest & Manifest);
+
+    // Splits the sign pack at PackPath into chunks: writes OutputDir/chunks/<hash> and the manifest
+    // OutputDir/SignPack.json (upload OutputDir as-is under SignPackSyncPrefix). Returns false if the pack is invalid or
+    // a file couldn't be written
+    //
+    static bool Publish(const FString & PackPath, const FString & OutputDir, FSignPackManifest & Manifest);
+};
+
+class FSignPackSync {
+public:
+    // OnPackSynced is called (on the sync thread) with each newly assembled pack
+    //
+    explicit FSignPackSync(const TFunction<void(const TSharedRef<const FSignPack> &)> & InOnPackSynced);
+    ~FSignPackSync();
+
+    // Installs the last synced pack from the cache (if any), then syncs in the background: now, then every
+    // SignPackSyncIntervalSeconds
+    //
+    void Start();
+
+    // Downloads the manifest and its missing chunks; installs the pack if it changed. Returns false on failure (the
+    // current pack is kept)
+    //
+    bool Sync();
+
+private:
+    void RunSync();
+    bool InstallCachedPack();
+    bool DownloadManifest(FString & ManifestJson) const;
+    bool DownloadChunks(const FSignPackManifest & Manifest) const;
+    bool AssemblePack(const FSignPackManifest & Manifest, const FString & PackFilePath) const;
+    bool InstallPack(const FString & PackFilePath);
+    void PruneCache(const FSignPackManifest & Manifest) const;
+    FString GetChunkPath(const FString & Hash) const;
+    FString GetPackPath(const FString & ManifestId) const;
+
+    TFunction<void(const TSharedRef<const FSignPack> &)> OnPackSynced;
+    TUniquePtr<FCrtS3Downloader> Downloader;
+    FString Bucket;
+    FString Prefix;
+    FString CacheDir;
+    FString InstalledManifestId;
+    TFuture<void> SyncFuture;
+    FEvent * StopSyncEvent {nullptr};
+};
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Sign playback through the pose cache and the sign pack (see SignPoseAnimInstance.h)
+//
+
+#include "SignPoseAnimInstance.h"
+#include "Utilities/UnrealAPI.h"
+
+#include <Animation/AnimationPoseData.h>
+
+using ASLMetaHuman::Core::FSignPackClip;
+using ASLMetaHuman::Core::FSignPoseCache;
+using ASLMetaHuman::Core::FSignPoseTracks;
+using ASLMetaHuman::Utilities::UnrealAPI;
+
+namespace {
+// Transform of one bone from sampled channels (CHANNEL_COUNT arrays of Stride floats)
+//
+FTransform GetChannelsTransform(const float * Channels, const int32 Stride, const int32 Bone) {
+    const auto Channel = [Channels, Stride, Bone](const FSignPoseTracks::EChannel Index) {
+        return Channels[Index * Stride + Bone];
+    };
+    return FTransform(
+            FQuat(Channel(FSignPoseTracks::ROTATION_X), Channel(FSignPoseTracks::ROTATION_Y),
+                    Channel(FSignPoseTracks::ROTATION_Z), Channel(FSignPoseTracks::ROTATION_W)),
+            FVector(Channel(FSignPoseTracks::TRANSLATION_X), Channel(FSignPoseTracks::TRANSLATION_Y),
+                    Channel(FSignPoseTracks::TRANSLATION_Z)),
+            FVector(Channel(FSignPoseTracks::SCALE_X), Channel(FSignPoseTracks::SCALE_Y),
+                    Channel(FSignPoseTracks::SCALE_Z)));
+}
+}
+
+void FAnimNode_SignPose::Play(const UAnimSequence * InSequence,
+        const TSharedPtr<const FSignPoseTracks> & InTracks,
+        const float InRate,
+        const float InStartPosition) {
+    Sequence = InSequence;
+    Tracks = InTracks;
+    Clip.Reset();
+    Rate = InRate;
+    Time = InStartPosition;
+    PlayLength = nullptr == InSequence ? 0.0f : InSequence->GetPlayLength();
+}
+
+void FAnimNode_SignPose::Play(const TSharedPtr<const FSignPackClip> & InClip,
+        const float InRate,
+        const float InStartPosition) {
+    Sequence = nullptr;
+    Tracks.Reset();
+    Clip = InClip;
+    Rate = InRate;
+    Time = InStartPosition;
+    PlayLength = InClip.IsValid() ? InClip->GetPlayLength() : 0.0f;
+}
+
+void FAnimNode_SignPose::Update_AnyThread(const FAnimationUpdateContext & Context) {
+    Time = FMath::Clamp(Time + Context.GetDeltaTime() * Rate, 0.0f, PlayLength);
+}
+
+void FAnimNode_SignPose::Evaluate_AnyThread(FPoseContext & Output) {
+    if (Clip.IsValid()) {
+        EvaluatePacked(Output);
+        return;
+    }
+    if (nullptr == Sequence) {
+        Output.ResetToRefPose();
+        return;
+    }
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    // Note: tracks are in the bone space of the sequence's skeleton - a mesh on another (compatible) skeleton is
+    // retargeted by the regular decompression path
+    //
+    const bool Cached =
+            Tracks.IsValid() && (Tracks->GetSkeleton() == Output.Pose.GetBoneContainer().GetSkeletonAsset());
+    if (Cached) {
+        EvaluateCached(Output);
+    } else {
+        FAnimationPoseData PoseData(Output);
+        Sequence->GetAnimationPose(PoseData, FAnimExtractContext(static_cast<double>(Time)));
+    }
+    FSignPoseCache::RecordEvaluation(Cached, FPlatformTime::Cycles64() - StartCycles);
+}
+
+// Samples all bones in one pass, then scatters the channels into the output pose (the mesh may use a subset of the
+// skeleton's bones; bones without a track keep their reference pose)
+//
+void FAnimNode_SignPose::EvaluateCached(FPoseContext & Output) {
+    const int32 Stride = Tracks->GetPaddedBoneCount();
+    SampledChannels.SetNumUninitialized(FSignPoseTracks::CHANNEL_COUNT * Stride, false);
+    Tracks->Sample(Time, SampledChannels.GetData());
+    const float * Channels = SampledChannels.GetData();
+    const FBoneContainer & BoneContainer = Output.Pose.GetBoneContainer();
+    for (const FCompactPoseBoneIndex BoneIndex: Output.Pose.ForEachBoneIndex()) {
+        const int32 Bone = BoneContainer.GetSkeletonIndex(BoneIndex);
+        if ((INDEX_NONE == Bone) || (Bone >= Tracks->GetBoneCount())) {
+            Output.Pose[BoneIndex] = Output.Pose.GetRefPose(BoneIndex);
+            continue;
+        }
+        Output.Pose[BoneIndex] = GetChannelsTransform(Channels, Stride, Bone);
+    }
+}
+
+// Decodes all pack bones at once, then scatters them by bone name (bones missing from the pack keep their reference
+// pose)
+//
+void FAnimNode_SignPose::EvaluatePacked(FPoseContext & Output) {
+    const auto & Decoder = Clip->GetDecoder();
+    const int32 Stride = static_cast<int32>(Decoder.GetPaddedBoneCount());
+    SampledChannels.SetNumUninitialized(FSignPoseTracks::CHANNEL_COUNT * Stride, false);
+    Decoder.Decode(Time, SampledChannels.GetData());
+    const FBoneContainer & BoneContainer = Output.Pose.GetBoneContainer();
+    const USkeleton * Skeleton = BoneContainer.GetSkeletonAsset();
+    if ((PackBoneMapSkeleton != Skeleton) || (PackBoneMapPack != &Clip->GetPack())) {
+        PackBoneMap.Reset();
+        if (nullptr != Skeleton) {
+            PackBoneMap = Clip->GetPack().MapBones(Skeleton->GetReferenceSkeleton());
+        }
+        PackBoneMapSkeleton = Skeleton;
+        PackBoneMapPack = &Clip->GetPack();
+    }
+    const float * Channels = SampledChannels.GetData();
+    for (const FCompactPoseBoneIndex BoneIndex: Output.Pose.ForEachBoneIndex()) {
+        const int32 SkeletonBone = BoneContainer.GetSkeletonIndex(BoneIndex);
+        const int32 Bone = PackBoneMap.IsValidIndex(SkeletonBone) ? PackBoneMap[SkeletonBone] : INDEX_NONE;
+        if (INDEX_NONE == Bone) {
+            Output.Pose[BoneIndex] = Output.Pose.GetRefPose(BoneIndex);
+            continue;
+        }
+        Output.Pose[BoneIndex] = GetChannelsTransform(Channels, Stride, Bone);
+    }
+}
+
+void FSignPoseAnimInstanceProxy::PreUpdate(UAnimInstance * InAnimInstance, float DeltaSeconds) {
+    FAnimInstanceProxy::PreUpdate(InAnimInstance, DeltaSeconds);
+    const auto AnimInstance = CastChecked<USignPoseAnimInstance>(InAnimInstance);
+    if (AnimInstance->PlaySerial == PlaySerial) {
+        return;
+    }
+    PlaySerial = AnimInstance->PlaySerial;
+    if (AnimInstance->Stopped) {
+        Node.Stop();
+    } else if (AnimInstance->Clip.IsValid()) {
+        Node.Play(AnimInstance->Clip, AnimInstance->Rate, AnimInstance->StartPosition);
+    } else {
+        Node.Play(AnimInstance->Sequence, AnimInstance->Tracks, AnimInstance->Rate, AnimInstance->StartPosition);
+    }
+}
+
+void FSignPoseAnimInstanceProxy::UpdateAnimationNode(const FAnimationUpdateContext & InContext) {
+    Node.Update_AnyThread(InContext);
+}
+
+bool FSignPoseAnimInstanceProxy::Evaluate(FPoseContext & Output) {
+    Node.Evaluate_AnyThread(Output);
+    return true;
+}
+
+// Returns the installed anim instance of SkeletalMeshComponent, installing it if needed (nullptr if that failed)
+//
+USignPoseAnimInstance * USignPoseAnimInstance::Install(USkeletalMeshComponent & SkeletalMeshComponent) {
+    auto AnimInstance = Cast<USignPoseAnimInstance>(SkeletalMeshComponent.GetAnimInstance());
+    if (nullptr == AnimInstance) {
+        SkeletalMeshComponent.SetAnimationMode(EAnimationMode::AnimationBlueprint);
+        SkeletalMeshComponent.SetAnimInstanceClass(StaticClass());
+        AnimInstance = Cast<USignPoseAnimInstance>(SkeletalMeshComponent.GetAnimInstance());
+    }
+    return AnimInstance;
+}
+
+void USignPoseAnimInstance::PlaySign(USkeletalMeshComponent & SkeletalMeshComponent,
+        UAnimSequence & InSequence,
+        const TSharedPtr<const FSignPoseTracks> & InTracks,
+        const float InRate,
+        const float InStartPosition) {
+    FScopeLock ScopeLock(&UnrealAPI::MutexPlayAnimation);
+    const auto AnimInstance = Install(SkeletalMeshComponent);
+    if (nullptr == AnimInstance) {
+        return;
+    }
+    AnimInstance->Sequence = &InSequence;
+    AnimInstance->Tracks = InTracks;
+    AnimInstance->Clip.Reset();
+    AnimInstance->Rate = InRate;
+    AnimInstance->StartPosition = InStartPosition;
+    AnimInstance->Stopped = false;
+    AnimInstance->PlaySerial++;
+}
+
+void USignPoseAnimInstance::PlayClip(USkeletalMeshComponent & SkeletalMeshComponent,
+        const TSharedPtr<const FSignPackClip> & InClip,
+        const float InRate,
+        const float InStartPosition) {
+    FScopeLock ScopeLock(&UnrealAPI::MutexPlayAnimation);
+    const auto AnimInstance = Install(SkeletalMeshComponent);
+    if (nullptr == AnimInstance) {
+        return;
+    }
+    AnimInstance->Sequence = nullptr;
+    AnimInstance->Tracks.Reset();
+    AnimInstance->Clip = InClip;
+    AnimInstance->Rate = InRate;
+    AnimInstance->StartPosition = InStartPosition;
+    AnimInstance->Stopped = false;
+    AnimInstance->PlaySerial++;
+}
+
+void USignPoseAnimInstance::StopSign(USkeletalMeshComponent & SkeletalMeshComponent) {
+    FScopeLock ScopeLock(&UnrealAPI::MutexPlayAnimation);
+    const auto AnimInstance = Cast<USignPoseAnimInstance>(SkeletalMeshComponent.GetAnimInstance());
+    if (nullptr != AnimInstance) {
+        AnimInstance->Stopped = true;
+        AnimInstance->PlaySerial++;
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Plays one sign at a time on a skeletal mesh (replaces the single node instance that PlayAnimation() installs when
+// the pose cache is enabled or a sign pack is loaded): signs in the pose cache are sampled from their pre-decompressed
+// tracks, signs of the sign pack are decoded from their compressed tracks (procedural pose source - no animation
+// sequence), others are decompressed from their sequence as usual. The sequence paths report their evaluation cost
+// (see FSignPoseCache::LogStats).
+//
+// Note: UHT doesn't support namespaces, hence the global names
+//
+
+#include <Animation/AnimInstance.h>
+#include <Animation/AnimInstanceProxy.h>
+#include <Animation/AnimNodeBase.h>
+
+#include "SignPack.h"
+#include "SignPoseCache.h"
+
+#include "SignPoseAnimInstance.generated.h"
+
+// Anim node that evaluates the current sign (non-looping; holds the last pose once finished or stopped)
+//
+USTRUCT()
+struct FAnimNode_SignPose: public FAnimNode_Base {
+    GENERATED_BODY()
+
+    void Play(const UAnimSequence * InSequence,
+            const TSharedPtr<const ASLMetaHuman::Core::FSignPoseTracks> & InTracks,
+            const float InRate,
+            const float InStartPosition);
+    void Play(const TSharedPtr<const ASLMetaHuman::Core::FSignPackClip> & InClip,
+            const float InRate,
+            const float InStartPosition);
+    void Stop() {
+        Rate = 0.0f;
+    }
+
+    virtual void Update_AnyThread(const FAnimationUpdateContext & Context) override;
+    virtual void Evaluate_AnyThread(FPoseContext & Output) override;
+
+private:
+    void EvaluateCached(FPoseContext & Output);
+    void EvaluatePacked(FPoseContext & Output);
+
+    // Note: the sequence is kept alive by USignPoseAnimInstance
+    //
+    const UAnimSequence * Sequence {nullptr};
+    TSharedPtr<const ASLMetaHuman::Core::FSignPoseTracks> Tracks;
+    TSharedPtr<const ASLMetaHuman::Core::FSignPackClip> Clip;
+    float Rate {0.0f};
+    float Time {0.0f};
+    float PlayLength {0.0f};
+
+    // Sampled channels of the current pose (see FSignPoseTracks::Sample and FSignTrackDecoder::Decode)
+    //
+    TArray<float, TAlignedHeapAllocator<32>> SampledChannels;
+
+    // Skeleton bone -> sign pack bone, rebuilt when the skeleton or the pack changes
+    //
+    TArray<int32> PackBoneMap;
+    const USkeleton * PackBoneMapSkeleton {nullptr};
+    const ASLMetaHuman::Core::FSignPack * PackBoneMapPack {nullptr};
+};
+
+// Runs FAnimNode_SignPose as the whole anim graph; play requests are handed over from the game thread in PreUpdate
+//
+struct FSignPoseAnimInstanceProxy: public FAnimInstanceProxy {
+    explicit FSignPoseAnimInstanceProxy(UAnimInstance * InAnimInstance): FAnimInstanceProxy(InAnimInstance) {
+    }
+
+protected:
+    virtual void PreUpdate(UAnimInstance * InAnimInstance, float DeltaSeconds) override;
+    virtual void UpdateAnimationNode(const FAnimationUpdateContext & InContext) override;
+    virtual bool Evaluate(FPoseContext & Output) override;
+
+private:
+    FAnimNode_SignPose Node;
+    uint32 PlaySerial {0};
+};
+
+UCLASS(Transient, NotBlueprintable)
+class USignPoseAnimInstance: public UAnimInstance {
+    GENERATED_BODY()
+
+public:
+    // Plays Sequence on SkeletalMeshComponent (from Tracks if the sign is in the pose cache), installing this anim
+    // instance on first use. Game thread only
+    //
+    static void PlaySign(USkeletalMeshComponent & SkeletalMeshComponent,
+            UAnimSequence & InSequence,
+            const TSharedPtr<const ASLMetaHuman::Core::FSignPoseTracks> & InTracks,
+            const float InRate,
+            const float InStartPosition);
+
+    // Plays a sign of the sign pack on SkeletalMeshComponent, installing this anim instance on first use. Game thread
+    // only
+    //
+    static void PlayClip(USkeletalMeshComponent & SkeletalMeshComponent,
+            const TSharedPtr<const ASLMetaHuman::Core::FSignPackClip> & InClip,
+            const float InRate,
+            const float InStartPosition);
+
+    // Holds the current pose (no-op unless this anim instance is installed). Game thread only
+    //
+    static void StopSign(USkeletalMeshComponent & SkeletalMeshComponent);
+
+protected:
+    virtual FAnimInstanceProxy * CreateAnimInstanceProxy() override {
+        return new FSignPoseAnimInstanceProxy(this);
+    }
+
+    virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy * InProxy) override {
+        delete static_cast<FSignPoseAnimInstanceProxy *>(InProxy);
+    }
+
+private:
+    friend struct FSignPoseAnimInstanceProxy;
+
+    static USignPoseAnimInstance * Install(USkeletalMeshComponent & SkeletalMeshComponent);
+
+    // Latest play (or stop) request, picked up by the proxy when PlaySerial changes
+    //
+    UPROPERTY(Transient)
+    TObjectPtr<UAnimSequence> Sequence;
+    TSharedPtr<const ASLMetaHuman::Core::FSignPoseTracks> Tracks;
+    TSharedPtr<const ASLMetaHuman::Core::FSignPackClip> Clip;
+    float Rate {1.0f};
+    float StartPosition {0.0f};
+    bool Stopped {false};
+    uint32 PlaySerial {0};
+};
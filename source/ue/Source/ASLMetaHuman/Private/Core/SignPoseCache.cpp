@@ -0,0 +1,287 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Builds and samples pre-decompressed pose tracks of hot signs (see SignPoseCache.h)
+//
+
+#include "SignPoseCache.h"
+#include "Config/GlobalState.h"
+
+#include <Animation/AnimationPoseData.h>
+#include <Animation/AttributesRuntime.h>
+#include <BonePose.h>
+#include <UObject/GarbageCollection.h>
+
+#if PLATFORM_ALWAYS_HAS_AVX_2
+#include <immintrin.h>
+#endif
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Core::FSignPoseCache;
+using ASLMetaHuman::Core::FSignPoseTracks;
+
+namespace {
+constexpr int32 FloatsPerRegister {8};
+constexpr float MinQuatLengthSquared {1.e-8f};
+constexpr double BytesPerMB {1024.0 * 1024.0};
+constexpr auto & InfoPoseCacheStatsFormatted = TEXT("Pose cache: %d signs (%.2f MB); per pose %.1f us sampled (%llu) vs %.1f us decompressed (%llu%s): saves %.1f us per avatar frame, %.1f us per MB");
+constexpr auto & InfoDecompressedAtBuild = TEXT(" - measured while building");
+constexpr auto & WarningPoseCacheBuildFailedFormatted = TEXT("Pose cache: %s has no skeleton or key frames; played uncached");
+}
+
+TSharedPtr<const FSignPoseTracks> FSignPoseTracks::Build(const UAnimSequence & Sequence) {
+    const USkeleton * SequenceSkeleton = Sequence.GetSkeleton();
+    const int32 Frames = Sequence.GetNumberOfSampledKeys();
+    if ((nullptr == SequenceSkeleton) || (0 >= Frames)) {
+        return nullptr;
+    }
+    const int32 Bones = SequenceSkeleton->GetReferenceSkeleton().GetNum();
+    if (0 >= Bones) {
+        return nullptr;
+    }
+    // Every bone of the skeleton: compact pose indices are then skeleton indices
+    //
+    TArray<FBoneIndexType> RequiredBones;
+    RequiredBones.SetNumUninitialized(Bones);
+    for (int32 i = 0; i < Bones; i++) {
+        RequiredBones[i] = static_cast<FBoneIndexType>(i);
+    }
+    FBoneContainer BoneContainer(RequiredBones, UE::Anim::FCurveFilterSettings(),
+            const_cast<USkeleton &>(*SequenceSkeleton));
+    FCompactPose Pose;
+    Pose.SetBoneContainer(&BoneContainer);
+    FBlendedCurve Curve;
+    UE::Anim::FStackAttributeContainer Attributes;
+    FAnimationPoseData PoseData(Pose, Curve, Attributes);
+
+    const auto Tracks = MakeShared<FSignPoseTracks>();
+    Tracks->Skeleton = SequenceSkeleton;
+    Tracks->BoneCount = Bones;
+    Tracks->PaddedBoneCount = Align(Bones, FloatsPerRegister);
+    Tracks->FrameCount = Frames;
+    Tracks->FrameRate = static_cast<float>(Sequence.GetSamplingFrameRate().AsDecimal());
+    const int32 Stride = Tracks->PaddedBoneCount;
+    Tracks->Data.SetNumZeroed(static_cast<int64>(Frames) * CHANNEL_COUNT * Stride);
+    for (int32 Frame = 0; Frame < Frames; Frame++) {
+        Sequence.GetBonePose(PoseData, FAnimExtractContext(Sequence.GetSamplingFrameRate().AsSeconds(Frame)));
+        float * Out = Tracks->Data.GetData() + static_cast<int64>(Frame) * CHANNEL_COUNT * Stride;
+        const float * Previous = 0 < Frame ? Out - CHANNEL_COUNT * Stride : nullptr;
+        for (int32 Bone = 0; Bone < Stride; Bone++) {
+            if (Bone >= Bones) {
+                // Padding: identity, so that the sampler's normalization stays finite
+                //
+                Out[ROTATION_W * Stride + Bone] = 1.0f;
+                continue;
+            }
+            const FTransform & Transform = Pose[FCompactPoseBoneIndex(Bone)];
+            FQuat4f Rotation(Transform.GetRotation().GetNormalized());
+            if (nullptr != Previous) {
+                const float Dot = Rotation.X * Previous[ROTATION_X * Stride + Bone]
+                        + Rotation.Y * Previous[ROTATION_Y * Stride + Bone]
+                        + Rotation.Z * Previous[ROTATION_Z * Stride + Bone]
+                        + Rotation.W * Previous[ROTATION_W * Stride + Bone];
+                if (0.0f > Dot) {
+                    // Same rotation in the previous key's hemisphere: plain interpolation then takes the short path
+                    //
+                    Rotation = FQuat4f(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W);
+                }
+            }
+            const FVector3f Translation(Transform.GetTranslation());
+            const FVector3f Scale(Transform.GetScale3D());
+            Out[TRANSLATION_X * Stride + Bone] = Translation.X;
+            Out[TRANSLATION_Y * Stride + Bone] = Translation.Y;
+            Out[TRANSLATION_Z * Stride + Bone] = Translation.Z;
+            Out[ROTATION_X * Stride + Bone] = Rotation.X;
+            Out[ROTATION_Y * Stride + Bone] = Rotation.Y;
+            Out[ROTATION_Z * Stride + Bone] = Rotation.Z;
+            Out[ROTATION_W * Stride + Bone] = Rotation.W;
+            Out[SCALE_X * Stride + Bone] = Scale.X;
+            Out[SCALE_Y * Stride + Bone] = Scale.Y;
+            Out[SCALE_Z * Stride + Bone] = Scale.Z;
+        }
+    }
+    return Tracks;
+}
+
+// Linear interpolation of every channel between the two surrounding key frames, then renormalization of the rotations
+// (nlerp - the key frames are already in a continuous hemisphere). Both passes run over whole registers of bones.
+//
+void FSignPoseTracks::Sample(const float Time, float * Out) const {
+    const float Position = FMath::Clamp(Time * FrameRate, 0.0f, static_cast<float>(FrameCount - 1));
+    const int32 Frame0 = FMath::FloorToInt32(Position);
+    const int32 Frame1 = FMath::Min(Frame0 + 1, FrameCount - 1);
+    const float Alpha = Position - static_cast<float>(Frame0);
+    const float * A = GetFrame(Frame0);
+    const float * B = GetFrame(Frame1);
+    const int32 Count = CHANNEL_COUNT * PaddedBoneCount;
+    float * RotationX = Out + ROTATION_X * PaddedBoneCount;
+    float * RotationY = Out + ROTATION_Y * PaddedBoneCount;
+    float * RotationZ = Out + ROTATION_Z * PaddedBoneCount;
+    float * RotationW = Out + ROTATION_W * PaddedBoneCount;
+#if PLATFORM_ALWAYS_HAS_AVX_2
+    const __m256 AlphaV = _mm256_set1_ps(Alpha);
+    for (int32 i = 0; i < Count; i += FloatsPerRegister) {
+        const __m256 ValueA = _mm256_load_ps(A + i);
+        const __m256 ValueB = _mm256_load_ps(B + i);
+        _mm256_store_ps(Out + i, _mm256_add_ps(ValueA, _mm256_mul_ps(AlphaV, _mm256_sub_ps(ValueB, ValueA))));
+    }
+    const __m256 One = _mm256_set1_ps(1.0f);
+    const __m256 MinLengthSquared = _mm256_set1_ps(MinQuatLengthSquared);
+    for (int32 i = 0; i < PaddedBoneCount; i += FloatsPerRegister) {
+        const __m256 X = _mm256_load_ps(RotationX + i);
+        const __m256 Y = _mm256_load_ps(RotationY + i);
+        const __m256 Z = _mm256_load_ps(RotationZ + i);
+        const __m256 W = _mm256_load_ps(RotationW + i);
+        const __m256 LengthSquared = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X, X), _mm256_mul_ps(Y, Y)),
+                _mm256_add_ps(_mm256_mul_ps(Z, Z), _mm256_mul_ps(W, W)));
+        const __m256 InverseLength = _mm256_div_ps(One, _mm256_sqrt_ps(_mm256_max_ps(LengthSquared, MinLengthSquared)));
+        _mm256_store_ps(RotationX + i, _mm256_mul_ps(X, InverseLength));
+        _mm256_store_ps(RotationY + i, _mm256_mul_ps(Y, InverseLength));
+        _mm256_store_ps(RotationZ + i, _mm256_mul_ps(Z, InverseLength));
+        _mm256_store_ps(RotationW + i, _mm256_mul_ps(W, InverseLength));
+    }
+#else
+    for (int32 i = 0; i < Count; i++) {
+        Out[i] = A[i] + Alpha * (B[i] - A[i]);
+    }
+    for (int32 i = 0; i < PaddedBoneCount; i++) {
+        const float LengthSquared = RotationX[i] * RotationX[i] + RotationY[i] * RotationY[i]
+                + RotationZ[i] * RotationZ[i] + RotationW[i] * RotationW[i];
+        const float InverseLength = FMath::InvSqrt(FMath::Max(LengthSquared, MinQuatLengthSquared));
+        RotationX[i] *= InverseLength;
+        RotationY[i] *= InverseLength;
+        RotationZ[i] *= InverseLength;
+        RotationW[i] *= InverseLength;
+    }
+#endif
+}
+
+FSignPoseCache::FSignPoseCache(const int32 InMaxHotSigns, const int32 InHotPlays):
+    MaxHotSigns(FMath::Max(0, InMaxHotSigns)),
+    HotPlays(FMath::Max(1, InHotPlays)) {
+}
+
+TSharedPtr<const FSignPoseTracks> FSignPoseCache::Find(const FString & Token,
+        const TWeakObjectPtr<UAnimSequence> & Sequence,
+        const bool Pinned) {
+    {
+        FScopeLock ScopeLock(&MutexSigns);
+        auto & Sign = Signs.FindOrAdd(Token);
+        if (Sign.Tracks.IsValid() || Sign.Building || Sign.Failed) {
+            return Sign.Tracks;
+        }
+        Sign.Plays++;
+        if ((! Pinned) && (! Sign.Hot)) {
+            if ((Sign.Plays < HotPlays) || (HotSignCount >= MaxHotSigns)) {
+                return nullptr;
+            }
+            HotSignCount++;
+            Sign.Hot = true;
+        }
+        Sign.Building = true;
+    }
+    BuildInBackground(Token, Sequence);
+    return nullptr;
+}
+
+// Note: the garbage collector is held off while a sequence is being decompressed (the residency manager may release
+// it meanwhile: the sign is then built again on a later play)
+//
+void FSignPoseCache::BuildInBackground(const FString & Token, const TWeakObjectPtr<UAnimSequence> & Sequence) {
+    const TWeakPtr<FSignPoseCache, ESPMode::ThreadSafe> WeakCache = AsShared();
+    FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [WeakCache, Token, Sequence]() {
+                const auto Cache = WeakCache.Pin();
+                if (! Cache.IsValid()) {
+                    return;
+                }
+                TSharedPtr<const FSignPoseTracks> Tracks;
+                bool Failed = false;
+                uint64 Cycles = 0;
+                if (! FGlobalState::IsAborting()) {
+                    FGCScopeGuard GCScopeGuard;
+                    if (Sequence.IsValid()) {
+                        const uint64 StartCycles = FPlatformTime::Cycles64();
+                        Tracks = FSignPoseTracks::Build(*Sequence.Get());
+                        Cycles = FPlatformTime::Cycles64() - StartCycles;
+                        Failed = ! Tracks.IsValid();
+                    }
+                }
+                Cache->OnBuilt(Token, Tracks, Failed, Cycles);
+            },
+            TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+// A failed sign gives its hot slot back
+//
+void FSignPoseCache::OnBuilt(const FString & Token,
+        const TSharedPtr<const FSignPoseTracks> & Tracks,
+        const bool Failed,
+        const uint64 Cycles) {
+    if (Failed) {
+        UE_LOG(LogTemp, Warning, WarningPoseCacheBuildFailedFormatted, *Token);
+    }
+    FScopeLock ScopeLock(&MutexSigns);
+    auto & Sign = Signs[Token];
+    Sign.Building = false;
+    Sign.Tracks = Tracks;
+    Sign.Failed = Failed;
+    if (Failed && Sign.Hot) {
+        HotSignCount--;
+        Sign.Hot = false;
+    }
+    if (Tracks.IsValid()) {
+        CachedBytes += Tracks->GetSizeBytes();
+        BuildCycles += Cycles;
+        BuildPoses += Tracks->GetFrameCount();
+    }
+}
+
+void FSignPoseCache::RecordEvaluation(const bool Cached, const uint64 Cycles) {
+    if (Cached) {
+        CachedEvaluationCycles += Cycles;
+        CachedEvaluations++;
+    } else {
+        DecompressedEvaluationCycles += Cycles;
+        DecompressedEvaluations++;
+    }
+}
+
+// Note: the decompression cost comes from uncached playback if there was any, else from building the cache
+//
+void FSignPoseCache::LogStats() const {
+    FScopeLock ScopeLock(&MutexSigns);
+    const auto ToMicroseconds = [](const uint64 Cycles, const uint64 Count) {
+        return 0 == Count ? 0.0 : FPlatformTime::ToMilliseconds64(Cycles) * 1000.0 / static_cast<double>(Count);
+    };
+    const uint64 Sampled = CachedEvaluations;
+    const uint64 Decompressed = DecompressedEvaluations;
+    const double SampledUs = ToMicroseconds(CachedEvaluationCycles, Sampled);
+    const bool FromBuild = 0 == Decompressed;
+    const double DecompressedUs = FromBuild ? ToMicroseconds(BuildCycles, BuildPoses)
+                                            : ToMicroseconds(DecompressedEvaluationCycles, Decompressed);
+    const double SavedUs = 0 == Sampled ? 0.0 : DecompressedUs - SampledUs;
+    const double CachedMB = static_cast<double>(CachedBytes) / BytesPerMB;
+    int32 CachedSigns = 0;
+    for (const auto & [Token, Sign]: Signs) {
+        CachedSigns += Sign.Tracks.IsValid() ? 1 : 0;
+    }
+    UE_LOG(LogTemp, Log, InfoPoseCacheStatsFormatted, CachedSigns, CachedMB, SampledUs, Sampled, DecompressedUs,
+            FromBuild ? BuildPoses : Decompressed, FromBuild ? InfoDecompressedAtBuild : TEXT(""), SavedUs,
+            0.0 < CachedMB ? SavedUs / CachedMB : 0.0);
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Optional cache of pre-decompressed poses for hot signs (the alphabet and the most played signs). Each sequence is
+// decompressed once into struct-of-arrays bone tracks - per key frame, one float array per transform channel with the
+// bones contiguous - so that a pose is sampled for all bones in one pass (8 bones per AVX2 instruction) instead of
+// decompressing every track each frame. See FAnimNode_SignPose for playback.
+//
+
+#include <Animation/AnimSequence.h>
+
+#include <atomic>
+
+namespace ASLMetaHuman::Core {
+
+class FSignPoseTracks {
+public:
+    // Transform channels of a key frame (in memory order); rotations are normalized quaternions in a continuous
+    // hemisphere from one key frame to the next
+    //
+    enum EChannel : int32 {
+        TRANSLATION_X,
+        TRANSLATION_Y,
+        TRANSLATION_Z,
+        ROTATION_X,
+        ROTATION_Y,
+        ROTATION_Z,
+        ROTATION_W,
+        SCALE_X,
+        SCALE_Y,
+        SCALE_Z,
+        CHANNEL_COUNT
+    };
+
+    // Decompresses every key frame of Sequence (all bones of its skeleton). Returns nullptr if it has no skeleton or
+    // keys. Note: must not run concurrently with garbage collection
+    //
+    static TSharedPtr<const FSignPoseTracks> Build(const UAnimSequence & Sequence);
+
+    // Interpolates all bones at Time (seconds, clamped to the sequence) into Out: CHANNEL_COUNT arrays of
+    // GetPaddedBoneCount() floats, 32-byte aligned
+    //
+    void Sample(const float Time, float * Out) const;
+
+    const USkeleton * GetSkeleton() const {
+        return Skeleton.Get();
+    }
+
+    int32 GetBoneCount() const {
+        return BoneCount;
+    }
+
+    // Bone count rounded up to a full AVX2 register (8 floats); the stride between channels
+    //
+    int32 GetPaddedBoneCount() const {
+        return PaddedBoneCount;
+    }
+
+    int32 GetFrameCount() const {
+        return FrameCount;
+    }
+
+    float GetFrameRate() const {
+        return FrameRate;
+    }
+
+    int64 GetSizeBytes() const {
+        return Data.Num() * sizeof(float);
+    }
+
+private:
+    const float * GetFrame(const int32 Frame) const {
+        return Data.GetData() + static_cast<int64>(Frame) * CHANNEL_COUNT * PaddedBoneCount;
+    }
+
+    TArray<float, TAlignedHeapAllocator<32>> Data;
+    TWeakObjectPtr<const USkeleton> Skeleton;
+    int32 BoneCount {0};
+    int32 PaddedBoneCount {0};
+    int32 FrameCount {0};
+    float FrameRate {0.0f};
+};
+
+class FSignPoseCache: public TSharedFromThis<FSignPoseCache, ESPMode::ThreadSafe> {
+public:
+    FSignPoseCache(const int32 InMaxHotSigns, const int32 InHotPlays);
+
+    // Returns the cached tracks of a sign. Otherwise counts the play and, if the sign is pinned or just became hot,
+    // starts building its tracks in the background (later plays then use them). A sign whose tracks can't be built is
+    // played uncached from then on
+    //
+    TSharedPtr<const FSignPoseTracks> Find(const FString & Token,
+            const TWeakObjectPtr<UAnimSequence> & Sequence,
+            const bool Pinned);
+
+    // Pose evaluation cost, reported by FAnimNode_SignPose for cached (sampled) and uncached (decompressed) poses
+    //
+    static void RecordEvaluation(const bool Cached, const uint64 Cycles);
+
+    // Reports the CPU time per pose with and without the cache against the memory that the cache holds
+    //
+    void LogStats() const;
+
+private:
+    // Hot: counted in HotSignCount. Failed: the sequence has no skeleton or key frames (not built again)
+    //
+    struct FCachedSign {
+        TSharedPtr<const FSignPoseTracks> Tracks;
+        int32 Plays {0};
+        bool Building {false};
+        bool Hot {false};
+        bool Failed {false};
+    };
+
+    void BuildInBackground(const FString & Token, const TWeakObjectPtr<UAnimSequence> & Sequence);
+    void OnBuilt(const FString & Token,
+            const TSharedPtr<const FSignPoseTracks> & Tracks,
+            const bool Failed,
+            const uint64 Cycles);
+
+    TMap<FString, FCachedSign> Signs;
+    mutable FCriticalSection MutexSigns;
+    const int32 MaxHotSigns;
+    const int32 HotPlays;
+    int32 HotSignCount {0};
+    int64 CachedBytes {0};
+
+    // Statistics (reported on shutdown): decompression cost measured while building, evaluation costs during playback
+    //
+    uint64 BuildCycles {0};
+    uint64 BuildPoses {0};
+    static inline std::atomic<uint64> CachedEvaluationCycles {0};
+    static inline std::atomic<uint64> CachedEvaluations {0};
+    static inline std::atomic<uint64> DecompressedEvaluationCycles {0};
+    static inline std::atomic<uint64> DecompressedEvaluations {0};
+};
+}
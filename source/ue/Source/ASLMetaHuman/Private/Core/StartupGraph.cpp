@@ -0,0 +1,192 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Runs and traces the startup phases (see StartupGraph.h)
+//
+
+#include "StartupGraph.h"
+#include "Config/GlobalState.h"
+#include "Config/InternalSettings.h"
+
+#include <Algo/AllOf.h>
+#include <HAL/ThreadManager.h>
+
+using ASLMetaHuman::Config::FGlobalState;
+using ASLMetaHuman::Config::FInternalSettings;
+using ASLMetaHuman::Core::FStartupGraph;
+
+namespace {
+const TCHAR * PhaseStateNames[] = {TEXT("running"), TEXT("ok"), TEXT("FAILED"), TEXT("skipped")};
+constexpr auto & InfoTimelineHeaderFormatted = TEXT("Startup timeline (%d phases, %.1f ms):");
+constexpr auto & InfoTimelinePhaseFormatted = TEXT("  %-16s +%8.1f ms .. +%8.1f ms (%8.1f ms) %-7s on %s");
+constexpr auto & WarningPhaseFailedFormatted = TEXT("Startup phase %s failed: dependent phases are skipped");
+constexpr auto & WarningPhaseSkippedFormatted = TEXT("Startup phase %s skipped (a prerequisite didn't succeed or shutdown started)");
+}
+
+void FStartupGraph::Launch(const FString & PhaseName,
+        const TArray<FString> & Prerequisites,
+        const ENamedThreads::Type Thread,
+        TUniqueFunction<bool()> && Phase) {
+    // Note: the lock is held until the phase is registered, so that the phase can't record its start before that
+    //
+    FScopeLock ScopeLock(&MutexPhases);
+    if (PhaseOrder.IsEmpty()) {
+        OriginSeconds = FPlatformTime::Seconds();
+    }
+    FGraphEventArray PrerequisiteEvents;
+    for (const auto & Prerequisite: Prerequisites) {
+        const auto PrerequisitePtr = Phases.Find(Prerequisite);
+        if ((nullptr != PrerequisitePtr) && PrerequisitePtr->Event.IsValid()) {
+            PrerequisiteEvents.Add(PrerequisitePtr->Event);
+        }
+    }
+    auto & Entry = Phases.FindOrAdd(PhaseName);
+    PhaseOrder.AddUnique(PhaseName);
+    Entry.Event = FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [PhaseName, Prerequisites, Phase = MoveTemp(Phase)]() mutable {
+                Execute(PhaseName, Prerequisites, Phase);
+            },
+            TStatId(), &PrerequisiteEvents, Thread);
+}
+
+bool FStartupGraph::Run(const FString & PhaseName, const TFunctionRef<bool()> & Phase) {
+    {
+        FScopeLock ScopeLock(&MutexPhases);
+        if (PhaseOrder.IsEmpty()) {
+            OriginSeconds = FPlatformTime::Seconds();
+        }
+        Phases.FindOrAdd(PhaseName);
+        PhaseOrder.AddUnique(PhaseName);
+    }
+    Begin(PhaseName);
+    bool Result;
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*PhaseName);
+        Result = Phase();
+    }
+    End(PhaseName, Result ? EPhaseState::SUCCEEDED : EPhaseState::FAILED);
+    return Result;
+}
+
+// Note: on the game thread, game thread phases keep running while waiting
+//
+bool FStartupGraph::Wait(const FString & PhaseName, const float TimeoutSeconds) {
+    FGraphEventArray Events;
+    {
+        FScopeLock ScopeLock(&MutexPhases);
+        for (const auto & [Name, Entry]: Phases) {
+            if ((PhaseName.IsEmpty() || (PhaseName == Name)) && Entry.Event.IsValid()) {
+                Events.Add(Entry.Event);
+            }
+        }
+    }
+    const float SpinlockSeconds = FInternalSettings::GetAnimationSpinlockSeconds();
+    for (float i = 0.0f;; i += SpinlockSeconds) {
+        if (! Events.ContainsByPredicate([](const FGraphEventRef & Event) {
+                return ! Event->IsComplete();
+            })) {
+            return true;
+        }
+        if (i >= TimeoutSeconds) {
+            return false;
+        }
+        if (IsInGameThread()) {
+            FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        }
+        FPlatformProcess::Sleep(SpinlockSeconds);
+    }
+}
+
+bool FStartupGraph::Succeeded(const FString & PhaseName) {
+    FScopeLock ScopeLock(&MutexPhases);
+    const auto EntryPtr = Phases.Find(PhaseName);
+    return (nullptr != EntryPtr) && (EPhaseState::SUCCEEDED == EntryPtr->State);
+}
+
+void FStartupGraph::LogTimelineWhenComplete() {
+    FGraphEventArray Events;
+    {
+        FScopeLock ScopeLock(&MutexPhases);
+        for (const auto & [Name, Entry]: Phases) {
+            if (Entry.Event.IsValid()) {
+                Events.Add(Entry.Event);
+            }
+        }
+    }
+    FFunctionGraphTask::CreateAndDispatchWhenReady(&FStartupGraph::LogTimeline, TStatId(), &Events,
+            ENamedThreads::AnyThread);
+}
+
+void FStartupGraph::Execute(const FString & PhaseName,
+        const TArray<FString> & Prerequisites,
+        TUniqueFunction<bool()> & Phase) {
+    const bool Runnable = (! FGlobalState::IsAborting()) && Algo::AllOf(Prerequisites, &FStartupGraph::Succeeded);
+    Begin(PhaseName);
+    if (! Runnable) {
+        End(PhaseName, EPhaseState::SKIPPED);
+        return;
+    }
+    bool Result;
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*PhaseName);
+        Result = Phase();
+    }
+    End(PhaseName, Result ? EPhaseState::SUCCEEDED : EPhaseState::FAILED);
+}
+
+void FStartupGraph::Begin(const FString & PhaseName) {
+    FScopeLock ScopeLock(&MutexPhases);
+    auto & Entry = Phases[PhaseName];
+    Entry.StartSeconds = FPlatformTime::Seconds();
+    Entry.ThreadId = FPlatformTLS::GetCurrentThreadId();
+}
+
+void FStartupGraph::End(const FString & PhaseName, const EPhaseState State) {
+    {
+        FScopeLock ScopeLock(&MutexPhases);
+        auto & Entry = Phases[PhaseName];
+        Entry.EndSeconds = FPlatformTime::Seconds();
+        Entry.State = State;
+    }
+    if (EPhaseState::FAILED == State) {
+        UE_LOG(LogTemp, Warning, WarningPhaseFailedFormatted, *PhaseName);
+    } else if (EPhaseState::SKIPPED == State) {
+        UE_LOG(LogTemp, Warning, WarningPhaseSkippedFormatted, *PhaseName);
+    }
+}
+
+// Logs one line per phase (in start order) with its offsets from the first phase, its duration, outcome and thread
+//
+void FStartupGraph::LogTimeline() {
+    FScopeLock ScopeLock(&MutexPhases);
+    TArray<FString> Names = PhaseOrder;
+    Names.StableSort([](const FString & A, const FString & B) {
+        return Phases[A].StartSeconds < Phases[B].StartSeconds;
+    });
+    double EndSeconds = OriginSeconds;
+    for (const auto & [Name, Entry]: Phases) {
+        EndSeconds = FMath::Max(EndSeconds, Entry.EndSeconds);
+    }
+    UE_LOG(LogTemp, Log, InfoTimelineHeaderFormatted, Names.Num(), (EndSeconds - OriginSeconds) * 1000.0);
+    for (const auto & Name: Names) {
+        const auto & Entry = Phases[Name];
+        UE_LOG(LogTemp, Log, InfoTimelinePhaseFormatted, *Name, (Entry.StartSeconds - OriginSeconds) * 1000.0,
+                (Entry.EndSeconds - OriginSeconds) * 1000.0, (Entry.EndSeconds - Entry.StartSeconds) * 1000.0,
+                PhaseStateNames[static_cast<uint8>(Entry.State)], *FThreadManager::GetThreadName(Entry.ThreadId));
+    }
+}
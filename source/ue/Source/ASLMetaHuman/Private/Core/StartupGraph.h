@@ -0,0 +1,85 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Process startup as a dependency graph of named phases (task graph tasks): independent phases run concurrently and a
+// phase starts once all of its prerequisites finished. A phase whose prerequisite failed - or that would start while
+// shutting down - is skipped. Start/end times and threads are recorded per phase for the startup timeline trace.
+//
+
+#include <Engine.h>
+
+namespace ASLMetaHuman::Core {
+
+// Phases that the module starts before the demo
+//
+constexpr auto & ConfigStartupPhase = TEXT("Config");
+constexpr auto & AwsSdkStartupPhase = TEXT("AWS SDK");
+
+class FStartupGraph {
+public:
+    // Runs Phase on Thread once the named prerequisite phases finished; Phase returns false on failure.
+    // Note: prerequisites must have been launched (or run) before
+    //
+    static void Launch(const FString & PhaseName,
+            const TArray<FString> & Prerequisites,
+            const ENamedThreads::Type Thread,
+            TUniqueFunction<bool()> && Phase);
+
+    // Runs Phase right away on the calling thread (recorded like any other phase)
+    //
+    static bool Run(const FString & PhaseName, const TFunctionRef<bool()> & Phase);
+
+    // Waits up to TimeoutSeconds for a phase (for every launched phase if PhaseName is empty). Returns true if it
+    // finished (or was never launched); false on timeout
+    //
+    static bool Wait(const FString & PhaseName, const float TimeoutSeconds);
+
+    static bool Succeeded(const FString & PhaseName);
+
+    // Logs the timeline once every phase launched so far has finished
+    //
+    static void LogTimelineWhenComplete();
+
+private:
+    enum class EPhaseState : uint8 { RUNNING, SUCCEEDED, FAILED, SKIPPED };
+
+    struct FPhase {
+        FGraphEventRef Event;
+        double StartSeconds {0.0};
+        double EndSeconds {0.0};
+        uint32 ThreadId {0};
+        EPhaseState State {EPhaseState::RUNNING};
+    };
+
+    static void Execute(const FString & PhaseName,
+            const TArray<FString> & Prerequisites,
+            TUniqueFunction<bool()> & Phase);
+    static void Begin(const FString & PhaseName);
+    static void End(const FString & PhaseName, const EPhaseState State);
+    static void LogTimeline();
+
+    static inline TMap<FString, FPhase> Phases;
+    static inline TArray<FString> PhaseOrder;
+    static inline FCriticalSection MutexPhases;
+
+    // The timeline starts with the first phase (module startup)
+    //
+    static inline double OriginSeconds {0.0};
+};
+}
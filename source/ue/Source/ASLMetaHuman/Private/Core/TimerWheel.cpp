@@ -0,0 +1,194 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Process-wide hierarchical timer wheel (see TimerWheel.h)
+//
+
+#include "TimerWheel.h"
+
+using ASLMetaHuman::Core::FTimerWheel;
+
+namespace {
+constexpr auto & InfoTimerWheelStatsFormatted = TEXT("Timer wheel: %llu scheduled, %llu fired, %llu cancelled, %llu cascaded (peak %d pending)");
+}
+
+void FTimerWheel::Start() {
+    FScopeLock ScopeLock(&MutexTimers);
+    if (Started) {
+        return;
+    }
+    Initialize();
+    OriginSeconds = FPlatformTime::Seconds() - CurrentTick * TickSeconds;
+    Started = true;
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FTimerWheel::Tick));
+}
+
+void FTimerWheel::Stop() {
+    TArray<FTimer> Dropped;
+    {
+        FScopeLock ScopeLock(&MutexTimers);
+        if (! Started) {
+            return;
+        }
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        Started = false;
+        Dropped = MoveTemp(Timers);
+        FreeTimers.Empty();
+        Buckets.Init(INDEX_NONE, NumLevels * NumBuckets);
+        UE_LOG(LogTemp, Log, InfoTimerWheelStatsFormatted, Scheduled, Fired, Cancelled, Cascaded, PeakPending);
+    }
+    // Note: the callbacks are destroyed outside the lock (their captures may schedule or cancel timers)
+    //
+    Dropped.Empty();
+}
+
+FTimerWheel::FHandle FTimerWheel::Schedule(const float DelaySeconds, TUniqueFunction<void()> && Callback) {
+    FScopeLock ScopeLock(&MutexTimers);
+    Initialize();
+    // Counted from now rather than from the last tick (up to a frame ago)
+    //
+    const uint64 DelayTicks = static_cast<uint64>(FMath::Max(0.0, FMath::CeilToDouble(DelaySeconds / TickSeconds)));
+    const uint64 NowTick = Started ? FMath::Max(CurrentTick, GetTick(FPlatformTime::Seconds())) : CurrentTick;
+    const int32 Index = FreeTimers.IsEmpty() ? Timers.AddDefaulted() : FreeTimers.Pop(false);
+    auto & Timer = Timers[Index];
+    Timer.Callback = MoveTemp(Callback);
+    Timer.ExpiryTick = FMath::Max(CurrentTick + 1, NowTick + FMath::Min(DelayTicks, MaxDelayTicks));
+    Insert(Index);
+    Scheduled++;
+    PeakPending = FMath::Max(PeakPending, Timers.Num() - FreeTimers.Num());
+    return {Index, Timer.Generation};
+}
+
+bool FTimerWheel::Cancel(FHandle & Handle) {
+    FScopeLock ScopeLock(&MutexTimers);
+    const FHandle Timer = Handle;
+    Handle = FHandle();
+    const int32 Index = Timer.Index;
+    if ((! Timers.IsValidIndex(Index)) || (Timers[Index].Generation != Timer.Generation)
+            || (INDEX_NONE == Timers[Index].Bucket)) {
+        return false;
+    }
+    Unlink(Index);
+    Release(Index);
+    Cancelled++;
+    return true;
+}
+
+// Game thread, every frame: fires the timers that are due (outside the lock, so that they can schedule more)
+//
+bool FTimerWheel::Tick(float DeltaTime) {
+    TArray<TUniqueFunction<void()>> Expired;
+    {
+        FScopeLock ScopeLock(&MutexTimers);
+        Advance(GetTick(FPlatformTime::Seconds()), Expired);
+    }
+    for (auto & Callback: Expired) {
+        Callback();
+    }
+    return true;
+}
+
+// Processes every tick up to TargetTick: a tick whose lower bits are all 0 first brings the timers of the matching
+// higher level buckets down (the highest level first), then the tick's first level bucket holds exactly the timers
+// due at that tick
+//
+void FTimerWheel::Advance(const uint64 TargetTick, TArray<TUniqueFunction<void()>> & Expired) {
+    while (CurrentTick < TargetTick) {
+        CurrentTick++;
+        int32 Level = 1;
+        while ((Level < NumLevels) && (0 == (CurrentTick & ((1ull << (Level * LevelBits)) - 1)))) {
+            Level++;
+        }
+        for (Level--; Level > 0; Level--) {
+            Cascade(Level);
+        }
+        const int32 Bucket = static_cast<int32>(CurrentTick & BucketMask);
+        while (INDEX_NONE != Buckets[Bucket]) {
+            const int32 Index = Buckets[Bucket];
+            Unlink(Index);
+            Expired.Add(MoveTemp(Timers[Index].Callback));
+            Release(Index);
+            Fired++;
+        }
+    }
+}
+
+void FTimerWheel::Cascade(const int32 Level) {
+    const int32 Bucket = Level * NumBuckets + static_cast<int32>((CurrentTick >> (Level * LevelBits)) & BucketMask);
+    int32 Index = Buckets[Bucket];
+    Buckets[Bucket] = INDEX_NONE;
+    while (INDEX_NONE != Index) {
+        const int32 Next = Timers[Index].Next;
+        Insert(Index);
+        Cascaded++;
+        Index = Next;
+    }
+}
+
+// Level L holds the timers due in less than 64^(L+1) ticks (but not less than 64^L), by bits L*6 to L*6+5 of their
+// expiry tick
+//
+void FTimerWheel::Insert(const int32 Index) {
+    auto & Timer = Timers[Index];
+    const uint64 Delta = Timer.ExpiryTick - CurrentTick;
+    int32 Level = 0;
+    while ((Level < NumLevels - 1) && (Delta >= (1ull << ((Level + 1) * LevelBits)))) {
+        Level++;
+    }
+    Timer.Bucket = Level * NumBuckets + static_cast<int32>((Timer.ExpiryTick >> (Level * LevelBits)) & BucketMask);
+    Timer.Previous = INDEX_NONE;
+    Timer.Next = Buckets[Timer.Bucket];
+    if (INDEX_NONE != Timer.Next) {
+        Timers[Timer.Next].Previous = Index;
+    }
+    Buckets[Timer.Bucket] = Index;
+}
+
+void FTimerWheel::Unlink(const int32 Index) {
+    auto & Timer = Timers[Index];
+    if (INDEX_NONE != Timer.Previous) {
+        Timers[Timer.Previous].Next = Timer.Next;
+    } else {
+        Buckets[Timer.Bucket] = Timer.Next;
+    }
+    if (INDEX_NONE != Timer.Next) {
+        Timers[Timer.Next].Previous = Timer.Previous;
+    }
+    Timer.Bucket = INDEX_NONE;
+    Timer.Previous = INDEX_NONE;
+    Timer.Next = INDEX_NONE;
+}
+
+// Outdates the timer's handles
+//
+void FTimerWheel::Release(const int32 Index) {
+    auto & Timer = Timers[Index];
+    Timer.Callback.Reset();
+    Timer.Generation++;
+    FreeTimers.Add(Index);
+}
+
+void FTimerWheel::Initialize() {
+    if (Buckets.IsEmpty()) {
+        Buckets.Init(INDEX_NONE, NumLevels * NumBuckets);
+    }
+}
+
+uint64 FTimerWheel::GetTick(const double Seconds) {
+    return static_cast<uint64>(FMath::Max(0.0, (Seconds - OriginSeconds) / TickSeconds));
+}
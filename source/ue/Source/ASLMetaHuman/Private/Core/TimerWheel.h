@@ -0,0 +1,106 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+// Process-wide hierarchical timer wheel for delayed callbacks (HUD message expiry, word transition delays): four levels
+// of 64 buckets each, the first one TickSeconds wide and every next one 64 times wider. Scheduling and cancelling are
+// O(1); a timer that's due beyond the first level moves down a level each time the level below wraps around. The
+// wheel is advanced by a core ticker on the game thread, so callbacks run on the game thread and nothing sleeps while
+// waiting for a timer. Callbacks should be short (e.g. queue work elsewhere).
+//
+
+#include <Containers/Ticker.h>
+#include <CoreMinimal.h>
+
+namespace ASLMetaHuman::Core {
+
+class FTimerWheel {
+public:
+    struct FHandle {
+        int32 Index {INDEX_NONE};
+        uint32 Generation {0};
+
+        bool IsValid() const {
+            return INDEX_NONE != Index;
+        }
+    };
+
+    // Game thread: starts advancing the wheel every frame (timers scheduled before only start counting from here)
+    //
+    static void Start();
+
+    // Game thread: stops advancing the wheel, drops the pending timers (without calling them) and logs the stats
+    //
+    static void Stop();
+
+    // Any thread: calls Callback on the game thread once DelaySeconds elapsed (at the first tick after that; a delay of
+    // 0 or less waits for the next tick). Delays beyond the wheel's range are clamped to it
+    //
+    static FHandle Schedule(const float DelaySeconds, TUniqueFunction<void()> && Callback);
+
+    // Any thread: drops the timer if it didn't fire yet and returns whether it did. Once cancelled from the game
+    // thread, a timer never fires
+    //
+    static bool Cancel(FHandle & Handle);
+
+private:
+    static constexpr int32 NumLevels = 4;
+    static constexpr int32 LevelBits = 6;
+    static constexpr int32 NumBuckets = 1 << LevelBits;
+    static constexpr uint64 BucketMask = NumBuckets - 1;
+    static constexpr uint64 MaxDelayTicks = (1ull << (NumLevels * LevelBits)) - 1;
+    static constexpr double TickSeconds = 0.01;
+
+    // Timers are kept in per-bucket doubly linked lists of indices into Timers (free entries are reused)
+    //
+    struct FTimer {
+        TUniqueFunction<void()> Callback;
+        uint64 ExpiryTick {0};
+        uint32 Generation {0};
+        int32 Bucket {INDEX_NONE};
+        int32 Previous {INDEX_NONE};
+        int32 Next {INDEX_NONE};
+    };
+
+    static bool Tick(float DeltaTime);
+    static void Advance(const uint64 TargetTick, TArray<TUniqueFunction<void()>> & Expired);
+    static void Cascade(const int32 Level);
+    static void Insert(const int32 Index);
+    static void Unlink(const int32 Index);
+    static void Release(const int32 Index);
+    static void Initialize();
+    static uint64 GetTick(const double Seconds);
+
+    static inline TArray<FTimer> Timers;
+    static inline TArray<int32> FreeTimers;
+    static inline TArray<int32> Buckets;
+    static inline uint64 CurrentTick {0};
+    static inline double OriginSeconds {0.0};
+    static inline bool Started {false};
+    static inline FTSTicker::FDelegateHandle TickerHandle;
+    static inline FCriticalSection MutexTimers;
+
+    // Stats
+    //
+    static inline uint64 Scheduled {0};
+    static inline uint64 Fired {0};
+    static inline uint64 Cancelled {0};
+    static inline uint64 Cascaded {0};
+    static inline int32 PeakPending {0};
+};
+}
@@ -18,8 +18,10 @@
 #include "ASLMetaHumanGameModeBase.h"
 #include "ASLMetaHumanDefaultPawn.h"
 #include "ASLMetaHumanPlayerController.h"
+#include "Config/InternalSettings.h"
 #include "Utilities/UnrealAPI.h"
 
+using ASLMetaHuman::Config::FInternalSettings;
 using ASLMetaHuman::Utilities::UnrealAPI;
 
 namespace {
@@ -27,15 +29,22 @@ const FText MultipleInstancesWarning = FText::FromString("Multiple Instances Det
 }
 
 AASLMetaHumanGameModeBase::AASLMetaHumanGameModeBase() {
-    // Perform a check for multiple instances - shutdown/deny these.
-    // Note: this is a timing-sensitive check
+    PlayerControllerClass = AASLMetaHumanPlayerController::StaticClass();
+    DefaultPawnClass = AASLMetaHumanDefaultPawn::StaticClass();
+}
+
+void AASLMetaHumanGameModeBase::InitGame(const FString & MapName, const FString & Options, FString & ErrorMessage) {
+    Super::InitGame(MapName, Options, ErrorMessage);
+    // Perform a check for multiple instances - shutdown/deny these (opt-in: multi-instance hosts run several copies,
+    // each claiming its own session). Note: this is a timing-sensitive check
     //
+    if (! FInternalSettings::GetEnforceSingleInstance()) {
+        return;
+    }
     FString ModuleName;
     UnrealAPI::GetModuleName(ModuleName);
     if (UnrealAPI::IsProcessRunningMultipleTimes(ModuleName)) {
         FMessageDialog::Open(EAppMsgType::Ok, EAppReturnType::Yes, MultipleInstancesWarning);
         FPlatformMisc::RequestExitWithStatus(true, -1);
     }
-    PlayerControllerClass = AASLMetaHumanPlayerController::StaticClass();
-    DefaultPawnClass = AASLMetaHumanDefaultPawn::StaticClass();
 }
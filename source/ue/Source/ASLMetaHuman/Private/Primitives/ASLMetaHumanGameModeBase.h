@@ -28,4 +28,5 @@ class AASLMetaHumanGameModeBase: public AGameModeBase {
 
 public:
     AASLMetaHumanGameModeBase();
+    virtual void InitGame(const FString & MapName, const FString & Options, FString & ErrorMessage) override;
 };
@@ -20,8 +20,6 @@
 //
 
 #include "UnrealAPI.h"
-#include "Config/GlobalState.h"
-#include "Config/InternalSettings.h"
 
 // Note: Windows API-specific and ordering sensitive
 //
@@ -37,14 +35,10 @@
 #include <Engine/UserInterfaceSettings.h>
 #include <SlateBasics.h>
 
-using ASLMetaHuman::Config::FGlobalState;
-using ASLMetaHuman::Config::FInternalSettings;
 using ASLMetaHuman::Utilities::UnrealAPI;
 
 namespace {
-constexpr int32 HighZOrder = 9999;
 constexpr float RenderThreadSpinlockSeconds = 0.05;
-constexpr bool WantNoMessages = false;
 }
 
 /* The following methods are Windows-specific
@@ -261,105 +255,4 @@ bool UnrealAPI::SetFirstPlayerCameraView(const float FieldOfView,
     const FVector & CurrentLocation = FirstPlayerController->K2_GetActorLocation();
     FirstPlayerController->ClientSetLocation(CurrentLocation + LocationOffset, FRotator::MakeFromEuler(RotationOffset));
     return true;
-}
-
-/* The following methods provide support for on screen messages in release mode (similar to GEngine->AddOnScreenDebugMessage())
-*/
-
-// Helper method to support a mechanism (TriggerHideMessage) that will hide a text block when the provided
-// time period expires (or prior if TriggerHideMessage changes its reference/signal value to true).
-//
-void UnrealAPI::PerformTimedMessageDisappearance(const float DurationSeconds,
-        FThreadSafeBool & TriggerHideMessage,
-        TSharedRef<STextBlock> & TextBlock) {
-    FFunctionGraphTask::CreateAndDispatchWhenReady(
-            [&TriggerHideMessage, DurationSeconds, TextBlock]() {
-                for (float i = 0.0f; i < DurationSeconds; i += FInternalSettings::GetAnimationSpinlockSeconds()) {
-                    if (FGlobalState::IsAborting()) {
-                        return;
-                    }
-                    // Note: this addresses cases where messages are hidden when TriggerHideMessage is out of scope
-                    //
-                    if (DurationSeconds == FLT_MAX && TriggerHideMessage) {
-                        break;
-                    }
-                    FPlatformProcess::Sleep(FInternalSettings::GetAnimationSpinlockSeconds());
-                }
-                HideWidget<STextBlock>(TextBlock);
-            },
-            TStatId(), nullptr, ENamedThreads::AnyThread);
-}
-
-// Helper method to produce a STextBlock Widget using the provided parameters, which include
-// font object support, font size, location to display to widget, font color (text and highlighting).
-//
-void UnrealAPI::MakeTextBlock(const FString & Message,
-        const UFont * FontPtr,
-        const unsigned int FontSize,
-        const FVector2D & Location,
-        const FColor & TextColor,
-        const FColor & TextHighlightColor,
-        TSharedPtr<STextBlock> & TextBlock) {
-    const auto SlateFontPtr = new FSlateFontInfo(FontPtr, FontSize);
-    const auto TextStyle = new FTextBlockStyle();
-    TextStyle->SetColorAndOpacity(FLinearColor(TextColor));
-    TextStyle->SetHighlightColor(FLinearColor(TextHighlightColor));
-    TextStyle->SetFont(*SlateFontPtr);
-    SAssignNew(TextBlock, STextBlock);
-    FSlateRenderTransform RenderTransform;
-    RenderTransform.SetTranslation(UE::Math::TVector2<float>(Location.X, Location.Y));
-    TextBlock->SetRenderTransform(RenderTransform);
-    TextBlock->SetText(FText::FromString(Message));
-    TextBlock->SetTextStyle(TextStyle);
-}
-
-// Wrapper Method
-//
-void UnrealAPI::ShowMessage(const FString & Message,
-        const float DurationSeconds,
-        const UFont * FontPtr,
-        const unsigned int FontSize,
-        const FVector2D & Location,
-        const FColor & TextColor,
-        const FColor & TextHighlightColor) {        
-    FThreadSafeBool TriggerHide = false;
-    ShowMessage(Message, DurationSeconds, FontPtr, FontSize, Location, TriggerHide, TextColor, TextHighlightColor);
-}
-
-// Displays a visual message on screen for a duration of time (no limit for FLT_MAX) using a provided
-// font and related parameters (including: font size, XY 2D canvas location, text color and highlight color).
-// Includes a mechanism (TriggerHideMessage) to hide its corresponding message no matter how long that message
-// was specified to be shown. This is useful when the time to display a message is not known in advance.
-// Accepts calls from any thread. Similar in function to: GEngine->AddOnScreenDebugMessage().
-//
-void UnrealAPI::ShowMessage(const FString & Message,
-        const float DurationSeconds,
-        const UFont * FontPtr,
-        const unsigned int FontSize,
-        const FVector2D & Location,
-        FThreadSafeBool & TriggerHideMessage,
-        const FColor & TextColor,
-        const FColor & TextHighlightColor) {
-    if (WantNoMessages || Message.IsEmpty() || (nullptr == FontPtr)) {
-        return;
-    }
-    FFunctionGraphTask::CreateAndDispatchWhenReady(
-            [&TriggerHideMessage, Message, DurationSeconds, FontPtr, FontSize, TextColor, TextHighlightColor,
-                    Location]() {
-                TWeakObjectPtr<UWorld> WorldPtr;
-                if (FGlobalState::IsAborting() || (! GetWorld(WorldPtr))) {
-                    return;
-                }
-                TSharedPtr<STextBlock> TextBlockShared;
-                MakeTextBlock(Message, FontPtr, FontSize, Location, TextColor, TextHighlightColor, TextBlockShared);
-                auto TextBlock = TextBlockShared.ToSharedRef();
-                const auto ViewportClient = WorldPtr->GetGameViewport();
-                if (nullptr == ViewportClient) {
-                    return;
-                }
-                ViewportClient->AddViewportWidgetForPlayer(
-                        WorldPtr->GetFirstLocalPlayerFromController(), TextBlock, HighZOrder);
-                PerformTimedMessageDisappearance(DurationSeconds, TriggerHideMessage, TextBlock);
-            },
-            TStatId(), nullptr, ENamedThreads::GameThread);
 }
\ No newline at end of file
@@ -23,18 +23,6 @@ namespace ASLMetaHuman::Utilities {
 class UnrealAPI {
 private:
     UnrealAPI() = default;
-    template <class TypeOfWidget>
-    static void HideWidget(const TSharedRef<TypeOfWidget> & Widget);
-    static void MakeTextBlock(const FString & Message,
-            const UFont * FontPtr,
-            unsigned FontSize,
-            const FVector2D & Location,
-            const FColor & TextColor,
-            const FColor & TextHighlightColor,
-            TSharedPtr<STextBlock> & TextBlock);
-    static void PerformTimedMessageDisappearance(const float DurationSeconds,
-            FThreadSafeBool & TriggerHideMessage,
-            TSharedRef<STextBlock> & TextBlock);
     // Assist with UClass-specific utility method access
     //
     static inline TWeakObjectPtr<UUnrealAPI> UUnrealAPIInstance = nullptr;
@@ -46,6 +34,8 @@ public:
     static bool GetAsset(const FString & PathToAsset, TWeakObjectPtr<TypeOfAsset> & AssetPtr);
     template <class TypeOfAsset>
     static bool GetAssets(const FString & PathToAsset, TArray<TWeakObjectPtr<TypeOfAsset>> & AssetsPtr);
+    template <class TypeOfAsset>
+    static bool GetAssetData(const FString & PathToAsset, TArray<FAssetData> & AssetDataList);
     template <class TypeOfActor = AActor>
     static bool GetActorByPath(const FString & ObjectPathToActor,
             const UWorld * World,
@@ -78,21 +68,6 @@ public:
     static bool SetFirstPlayerCameraView(const float FieldOfView,
             const FVector & LocationOffset,
             const FVector & RotationOffset);
-    static void ShowMessage(const FString & Message,
-            const float DurationSeconds,
-            const UFont * FontPtr,
-            const unsigned int FontSize,
-            const FVector2D & Location,
-            const FColor & TextColor = FColor::White,
-            const FColor & TextHighlightColor = FColor::Black);
-    static void ShowMessage(const FString & Message,
-            const float DurationSeconds,
-            const UFont * FontPtr,
-            const unsigned int FontSize,
-            const FVector2D & Location,
-            FThreadSafeBool & TriggerHideMessage,
-            const FColor & TextColor = FColor::White,
-            const FColor & TextHighlightColor = FColor::Black);
     static inline FCriticalSection MutexPlayAnimation;
 };
 }
@@ -89,6 +89,24 @@ bool UnrealAPI::GetAssets(const FString & PathToAsset, TArray<TWeakObjectPtr<Typ
     return true;
 }
 
+// Provides the asset registry entries (metadata only - nothing is loaded) of assets of type matching TypeOfAsset within
+// an asset path (recursively). Returns true if assets were found; false otherwise.
+//
+template <class TypeOfAsset>
+bool UnrealAPI::GetAssetData(const FString & PathToAsset, TArray<FAssetData> & AssetDataList) {
+    AssetDataList.Reset();
+    auto & AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryName).Get();
+    if (AssetRegistry.IsLoadingAssets()) {
+        AssetRegistry.ScanPathsSynchronous({PathToAsset});
+    }
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*PathToAsset));
+    Filter.ClassPaths.Add(TypeOfAsset::StaticClass()->GetClassPathName());
+    Filter.bRecursivePaths = true;
+    AssetRegistry.GetAssets(Filter, AssetDataList);
+    return ! AssetDataList.IsEmpty();
+}
+
 // Attempts to hide all actors of type TypeOfActor, offering to hide Blueprint-specific actors
 //
 template <class TypeOfActor>
@@ -179,27 +197,4 @@ bool UnrealAPI::GetActorByPath(const FString & ObjectPathToActor,
         }
     }
     return false;
-}
-
-// Helper method to hide a specific type (TypeOfWidget) of Slate Widget.
-//
-template <class TypeOfWidget>
-void UnrealAPI::HideWidget(const TSharedRef<TypeOfWidget> & Widget) {
-    const auto& Task = FFunctionGraphTask::CreateAndDispatchWhenReady(
-            [Widget]() {
-                TWeakObjectPtr<UWorld> WorldPtrInternal;
-                if (! GetWorld(WorldPtrInternal)) {
-                    return;
-                }
-                const auto ViewportClientInternal = WorldPtrInternal->GetGameViewport();
-                if (nullptr == ViewportClientInternal) {
-                    return;
-                }
-                // Note: likely to lead to GC processing
-                //
-                ViewportClientInternal->RemoveViewportWidgetForPlayer(
-                        WorldPtrInternal->GetFirstLocalPlayerFromController(), Widget);
-            },
-            TStatId(), nullptr, ENamedThreads::GameThread);
-    Task->Wait();
 }
\ No newline at end of file
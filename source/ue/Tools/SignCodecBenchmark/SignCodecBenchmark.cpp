@@ -0,0 +1,303 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT-0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Round-trip error and decode throughput of the sign track codec, headless (no engine). Reads the raw tracks exported
+// by the SignTracks commandlet (*.signtracks), or generates synthetic signs, and reports per sign and in total:
+// - Size: raw key frames against the encoded clip
+// - Error: decoded against raw poses at every key frame and half way between key frames (translation in cm, rotation
+//   in degrees, scale)
+// - Throughput: full poses decoded per second at random times, against interpolating the raw key frames
+//
+
+#include "SignTrackCodec.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+using ASLMetaHuman::Codec::CHANNEL_COUNT;
+using ASLMetaHuman::Codec::FRawSignTracks;
+using ASLMetaHuman::Codec::FSignTrackCodecSettings;
+using ASLMetaHuman::Codec::FSignTrackDecoder;
+using ASLMetaHuman::Codec::ROTATION_W;
+using ASLMetaHuman::Codec::ROTATION_X;
+using ASLMetaHuman::Codec::SCALE_X;
+using ASLMetaHuman::Codec::TRANSLATION_X;
+
+namespace {
+constexpr auto & Usage = "Usage: SignCodecBenchmark <directory of .signtracks files> | --synthetic <sign count>\n";
+constexpr auto & SignTracksExtension = ".signtracks";
+constexpr uint32_t DecodeIterations {20000};
+constexpr uint32_t SyntheticBoneCount {256};
+constexpr uint32_t SyntheticHandBoneCount {64};
+constexpr float SyntheticFrameRate {30.0f};
+constexpr double RadiansToDegrees {57.29577951308232};
+
+struct FSign {
+    std::string Name;
+    FRawSignTracks Tracks;
+};
+
+struct FErrors {
+    double MaxTranslation {0.0};
+    double MaxRotation {0.0};
+    double MaxScale {0.0};
+    double SumSquaresTranslation {0.0};
+    double SumSquaresRotation {0.0};
+    double SumSquaresScale {0.0};
+    uint64_t Count {0};
+
+    void Add(const FErrors & Other) {
+        MaxTranslation = std::max(MaxTranslation, Other.MaxTranslation);
+        MaxRotation = std::max(MaxRotation, Other.MaxRotation);
+        MaxScale = std::max(MaxScale, Other.MaxScale);
+        SumSquaresTranslation += Other.SumSquaresTranslation;
+        SumSquaresRotation += Other.SumSquaresRotation;
+        SumSquaresScale += Other.SumSquaresScale;
+        Count += Other.Count;
+    }
+
+    double Rms(const double SumSquares) const {
+        return 0 == Count ? 0.0 : std::sqrt(SumSquares / static_cast<double>(Count));
+    }
+};
+
+struct FResult {
+    size_t RawBytes {0};
+    size_t EncodedBytes {0};
+    double EncodeSeconds {0.0};
+    double DecodeSeconds {0.0};
+    double RawSampleSeconds {0.0};
+    uint64_t Poses {0};
+    FErrors Errors;
+};
+
+double GetSeconds(const std::chrono::steady_clock::time_point Start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+}
+
+// Synthetic sign: a near-static body (identity or constant bones), slowly moving arms and fast hand and finger bones
+//
+FRawSignTracks MakeSyntheticSign(const uint32_t Seed) {
+    std::mt19937 Random(Seed);
+    std::uniform_real_distribution<float> Uniform(-1.0f, 1.0f);
+    FRawSignTracks Tracks;
+    Tracks.BoneCount = SyntheticBoneCount;
+    Tracks.FrameCount = 45 + Seed % 60;
+    Tracks.FrameRate = SyntheticFrameRate;
+    Tracks.Values.resize(static_cast<size_t>(Tracks.FrameCount) * CHANNEL_COUNT * Tracks.BoneCount);
+    for (uint32_t Bone = 0; Bone < Tracks.BoneCount; Bone++) {
+        const bool Hand = Bone >= Tracks.BoneCount - SyntheticHandBoneCount;
+        const bool Arm = (! Hand) && (Bone % 16 == 0);
+        const float Offset[3] = {10.0f * Uniform(Random), 10.0f * Uniform(Random), 10.0f * Uniform(Random)};
+        float Axis[3] = {Uniform(Random), Uniform(Random), Uniform(Random)};
+        const float AxisLength = std::sqrt(Axis[0] * Axis[0] + Axis[1] * Axis[1] + Axis[2] * Axis[2]) + 1.e-6f;
+        const float Amplitude = Hand ? 0.8f : (Arm ? 0.3f : 0.0f);
+        const float Speed = Hand ? 6.0f + 4.0f * Uniform(Random) : 1.5f;
+        const float Phase = 3.14159265f * Uniform(Random);
+        const float BaseAngle = Bone % 3 == 0 ? 0.0f : Uniform(Random);
+        for (uint32_t Frame = 0; Frame < Tracks.FrameCount; Frame++) {
+            const float Time = static_cast<float>(Frame) / Tracks.FrameRate;
+            const float HalfAngle = 0.5f * (BaseAngle + Amplitude * std::sin(Speed * Time + Phase));
+            const float Sin = std::sin(HalfAngle) / AxisLength;
+            const float Values[CHANNEL_COUNT] = {
+                    Offset[0] + (Hand ? 0.5f * std::sin(Speed * Time) : 0.0f), Offset[1], Offset[2],
+                    Axis[0] * Sin, Axis[1] * Sin, Axis[2] * Sin, std::cos(HalfAngle),
+                    1.0f, 1.0f, 1.0f};
+            for (uint32_t Channel = 0; Channel < CHANNEL_COUNT; Channel++) {
+                Tracks.Values[(static_cast<size_t>(Frame) * CHANNEL_COUNT + Channel) * Tracks.BoneCount + Bone] =
+                        Values[Channel];
+            }
+        }
+    }
+    return Tracks;
+}
+
+bool LoadSign(const std::filesystem::path & Path, FSign & Sign) {
+    std::ifstream File(Path, std::ios::binary);
+    const std::vector<uint8_t> Data((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+    Sign.Name = Path.stem().string();
+    return ASLMetaHuman::Codec::DeserializeRawSignTracks(Data.data(), Data.size(), Sign.Tracks);
+}
+
+// Reference pose at a (fractional) frame: linear interpolation of the raw key frames (rotations: nlerp)
+//
+void SampleRaw(const FRawSignTracks & Tracks, const float FramePosition, const uint32_t Stride, float * Out) {
+    const uint32_t Frame0 = std::min(static_cast<uint32_t>(FramePosition), Tracks.FrameCount - 1);
+    const uint32_t Frame1 = std::min(Frame0 + 1, Tracks.FrameCount - 1);
+    const float Alpha = FramePosition - static_cast<float>(Frame0);
+    for (uint32_t Bone = 0; Bone < Tracks.BoneCount; Bone++) {
+        float Dot = 0.0f;
+        for (uint32_t Channel = ROTATION_X; Channel <= ROTATION_W; Channel++) {
+            Dot += Tracks.Get(Frame0, Channel, Bone) * Tracks.Get(Frame1, Channel, Bone);
+        }
+        float LengthSquared = 0.0f;
+        for (uint32_t Channel = 0; Channel < CHANNEL_COUNT; Channel++) {
+            const bool Rotation = (Channel >= ROTATION_X) && (Channel <= ROTATION_W);
+            const float Value0 = Tracks.Get(Frame0, Channel, Bone);
+            const float Value1 = (Rotation && (0.0f > Dot) ? -1.0f : 1.0f) * Tracks.Get(Frame1, Channel, Bone);
+            Out[Channel * Stride + Bone] = Value0 + Alpha * (Value1 - Value0);
+            LengthSquared += Rotation ? Out[Channel * Stride + Bone] * Out[Channel * Stride + Bone] : 0.0f;
+        }
+        const float Length = std::sqrt(std::max(LengthSquared, 1.e-8f));
+        for (uint32_t Channel = ROTATION_X; Channel <= ROTATION_W; Channel++) {
+            Out[Channel * Stride + Bone] /= Length;
+        }
+    }
+}
+
+FErrors Compare(const float * Expected, const float * Decoded, const uint32_t BoneCount, const uint32_t Stride) {
+    FErrors Errors;
+    for (uint32_t Bone = 0; Bone < BoneCount; Bone++) {
+        double Translation = 0.0;
+        double Scale = 0.0;
+        double Dot = 0.0;
+        for (uint32_t c = 0; c < 3; c++) {
+            const double TranslationDelta = Expected[(TRANSLATION_X + c) * Stride + Bone]
+                    - Decoded[(TRANSLATION_X + c) * Stride + Bone];
+            Translation += TranslationDelta * TranslationDelta;
+            const float ScaleDelta = Expected[(SCALE_X + c) * Stride + Bone] - Decoded[(SCALE_X + c) * Stride + Bone];
+            Scale = std::max(Scale, static_cast<double>(std::abs(ScaleDelta)));
+        }
+        for (uint32_t c = 0; c < 4; c++) {
+            Dot += static_cast<double>(Expected[(ROTATION_X + c) * Stride + Bone])
+                    * Decoded[(ROTATION_X + c) * Stride + Bone];
+        }
+        Translation = std::sqrt(Translation);
+        const double Rotation = 2.0 * std::acos(std::min(1.0, std::abs(Dot))) * RadiansToDegrees;
+        Errors.MaxTranslation = std::max(Errors.MaxTranslation, Translation);
+        Errors.MaxRotation = std::max(Errors.MaxRotation, Rotation);
+        Errors.MaxScale = std::max(Errors.MaxScale, Scale);
+        Errors.SumSquaresTranslation += Translation * Translation;
+        Errors.SumSquaresRotation += Rotation * Rotation;
+        Errors.SumSquaresScale += Scale * Scale;
+        Errors.Count++;
+    }
+    return Errors;
+}
+
+FResult Benchmark(const FRawSignTracks & Tracks, const FSignTrackCodecSettings & Settings) {
+    FResult Result;
+    Result.RawBytes = Tracks.Values.size() * sizeof(float);
+    auto Start = std::chrono::steady_clock::now();
+    const std::vector<uint8_t> Encoded = ASLMetaHuman::Codec::EncodeSignTracks(Tracks, Settings);
+    Result.EncodeSeconds = GetSeconds(Start);
+    Result.EncodedBytes = Encoded.size();
+    FSignTrackDecoder Decoder;
+    if (! Decoder.Open(Encoded.data(), Encoded.size())) {
+        return Result;
+    }
+    const uint32_t Stride = Decoder.GetPaddedBoneCount();
+    std::vector<float> Expected(static_cast<size_t>(CHANNEL_COUNT) * Stride, 0.0f);
+    std::vector<float> Decoded(Expected.size(), 0.0f);
+    for (uint32_t Frame = 0; Frame < Tracks.FrameCount; Frame++) {
+        for (const float Fraction: {0.0f, 0.5f}) {
+            const float FramePosition =
+                    std::min(static_cast<float>(Frame) + Fraction, static_cast<float>(Tracks.FrameCount - 1));
+            SampleRaw(Tracks, FramePosition, Stride, Expected.data());
+            Decoder.Decode(FramePosition / Tracks.FrameRate, Decoded.data());
+            Result.Errors.Add(Compare(Expected.data(), Decoded.data(), Tracks.BoneCount, Stride));
+        }
+    }
+    std::mt19937 Random(Tracks.FrameCount);
+    std::uniform_real_distribution<float> Times(0.0f, Decoder.GetPlayLength());
+    std::vector<float> SampleTimes(DecodeIterations);
+    for (auto & Time: SampleTimes) {
+        Time = Times(Random);
+    }
+    Start = std::chrono::steady_clock::now();
+    for (const float Time: SampleTimes) {
+        Decoder.Decode(Time, Decoded.data());
+    }
+    Result.DecodeSeconds = GetSeconds(Start);
+    Start = std::chrono::steady_clock::now();
+    for (const float Time: SampleTimes) {
+        SampleRaw(Tracks, Time * Tracks.FrameRate, Stride, Expected.data());
+    }
+    Result.RawSampleSeconds = GetSeconds(Start);
+    Result.Poses = DecodeIterations;
+    return Result;
+}
+
+void PrintResult(const char * Name, const FResult & Result) {
+    std::printf("%-24s %9.1f KB %8.1f KB %6.1fx %8.2f ms %8.2f %8.2f us %8.4f %8.4f %8.4f %8.4f %8.5f\n", Name,
+            Result.RawBytes / 1024.0, Result.EncodedBytes / 1024.0,
+            0 == Result.EncodedBytes ? 0.0 : static_cast<double>(Result.RawBytes) / Result.EncodedBytes,
+            Result.EncodeSeconds * 1000.0, 1.e6 * Result.DecodeSeconds / std::max<uint64_t>(1, Result.Poses),
+            1.e6 * Result.RawSampleSeconds / std::max<uint64_t>(1, Result.Poses), Result.Errors.MaxTranslation,
+            Result.Errors.Rms(Result.Errors.SumSquaresTranslation), Result.Errors.MaxRotation,
+            Result.Errors.Rms(Result.Errors.SumSquaresRotation), Result.Errors.MaxScale);
+}
+}
+
+int main(int Argc, char ** Argv) {
+    std::vector<FSign> Signs;
+    if ((3 == Argc) && (0 == std::strcmp(Argv[1], "--synthetic"))) {
+        const int SignCount = std::max(1, std::atoi(Argv[2]));
+        for (int i = 0; i < SignCount; i++) {
+            Signs.push_back({"SYNTHETIC_" + std::to_string(i), MakeSyntheticSign(static_cast<uint32_t>(i))});
+        }
+    } else if ((2 == Argc) && std::filesystem::is_directory(Argv[1])) {
+        for (const auto & Entry: std::filesystem::directory_iterator(Argv[1])) {
+            FSign Sign;
+            if ((SignTracksExtension == Entry.path().extension()) && LoadSign(Entry.path(), Sign)) {
+                Signs.push_back(std::move(Sign));
+            }
+        }
+        std::sort(Signs.begin(), Signs.end(), [](const FSign & A, const FSign & B) {
+            return A.Name < B.Name;
+        });
+    } else {
+        std::fputs(Usage, stderr);
+        return 1;
+    }
+    if (Signs.empty()) {
+        std::fputs("No signs found\n", stderr);
+        return 1;
+    }
+#if defined(__AVX2__)
+    std::printf("Decoder: AVX2\n");
+#else
+    std::printf("Decoder: scalar\n");
+#endif
+    std::printf("%-24s %12s %11s %7s %11s %8s %11s %8s %8s %8s %8s %8s\n", "Sign", "Raw", "Encoded", "Ratio", "Encode",
+            "Decode", "Raw lerp", "T max", "T rms", "R max", "R rms", "S max");
+    std::printf("%-24s %12s %11s %7s %11s %8s %11s %8s %8s %8s %8s %8s\n", "", "", "", "", "", "us/pose", "us/pose",
+            "cm", "cm", "deg", "deg", "");
+    const FSignTrackCodecSettings Settings;
+    FResult Total;
+    for (const auto & Sign: Signs) {
+        const FResult Result = Benchmark(Sign.Tracks, Settings);
+        PrintResult(Sign.Name.c_str(), Result);
+        Total.RawBytes += Result.RawBytes;
+        Total.EncodedBytes += Result.EncodedBytes;
+        Total.EncodeSeconds += Result.EncodeSeconds;
+        Total.DecodeSeconds += Result.DecodeSeconds;
+        Total.RawSampleSeconds += Result.RawSampleSeconds;
+        Total.Poses += Result.Poses;
+        Total.Errors.Add(Result.Errors);
+    }
+    PrintResult("TOTAL", Total);
+    return 0;
+}
@@ -0,0 +1,8 @@
+rem Decode background images headless through the worker-thread path and report their timings
+rem Usage: backgrounddecode.bat <image files or http(s) URLs, comma-separated> [-S3] [-Size=<w>x<h>] [-Format=BC7|BC1|BGRA8]
+rem -S3 downloads with the CRT S3 client (parallel ranged GETs) instead of HTTP
+rem -Size resizes to the background plane's on-screen size, -Format overrides BackgroundIngestFormat
+
+call variables.bat
+
+"%UE5DIR%\Engine\Binaries\Win64\UnrealEditor-Cmd.exe" "%PROJECT_FULL_FILENAME%" -run=BackgroundDecode -Image="%~1" %2 %3 %4 -nullrhi
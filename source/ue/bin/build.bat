@@ -1,4 +1,5 @@
 call variables.bat
+call manifest.bat
 
 del "%PROJECT_ROOT%\Saved\StagedBuilds\Windows\%PROJECT_NAME%\Config\ASLMetaHuman.ini"
 
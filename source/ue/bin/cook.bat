@@ -1,3 +1,4 @@
 call variables.bat
+call manifest.bat
 
 "%UE5DIR%\Engine\Binaries\Win64\UnrealEditor-Cmd.exe" "%PROJECT_FULL_FILENAME%" -run=Cook -TargetPlatform=Windows
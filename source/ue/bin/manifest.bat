@@ -0,0 +1,5 @@
+rem Rebuild the sign manifest (Content/SignManifest/SignManifest.bin) from the ASL animation sequences
+
+call variables.bat
+
+"%UE5DIR%\Engine\Binaries\Win64\UnrealEditor-Cmd.exe" "%PROJECT_FULL_FILENAME%" -run=SignManifest
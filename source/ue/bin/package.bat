@@ -1,6 +1,7 @@
 rem Generate UE shipping package (in %ARCHIVE_DIR%)
 
 call variables.bat
+call manifest.bat
 
 set ARCHIVE_DIR=%PROJECT_ROOT%\PKG
 rem set BUILD_TYPE=DebugGame
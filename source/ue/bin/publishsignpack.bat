@@ -0,0 +1,14 @@
+rem Rebuild the sign pack and publish it for the sign pack sync (SignPackSyncBucket, SignPackSyncPrefix "signpacks/")
+rem Usage: publishsignpack.bat <bucket> [<endpoint URL of a local stand-in, e.g. http://localhost:9000>]
+
+call variables.bat
+
+set PUBLISH_DIR=%PROJECT_ROOT%\Saved\SignPackPublish
+set ENDPOINT_OPTION=
+if not "%~2"=="" set ENDPOINT_OPTION=--endpoint-url %~2
+
+"%UE5DIR%\Engine\Binaries\Win64\UnrealEditor-Cmd.exe" "%PROJECT_FULL_FILENAME%" -run=SignPack -Publish="%PUBLISH_DIR%"
+
+rem Chunks first: the manifest must never reference a chunk that isn't uploaded yet
+aws s3 sync "%PUBLISH_DIR%\chunks" s3://%~1/signpacks/chunks/ %ENDPOINT_OPTION%
+aws s3 cp "%PUBLISH_DIR%\SignPack.json" s3://%~1/signpacks/SignPack.json %ENDPOINT_OPTION%
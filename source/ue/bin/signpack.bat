@@ -0,0 +1,5 @@
+rem Rebuild the sign pack (SignPackPath, default Content/SignPacks/SignPack.bin) from the ASL animation sequences
+
+call variables.bat
+
+"%UE5DIR%\Engine\Binaries\Win64\UnrealEditor-Cmd.exe" "%PROJECT_FULL_FILENAME%" -run=SignPack
@@ -0,0 +1,5 @@
+rem Export the raw pose tracks of the ASL animation sequences (Saved/SignTracks) for Tools/SignCodecBenchmark
+
+call variables.bat
+
+"%UE5DIR%\Engine\Binaries\Win64\UnrealEditor-Cmd.exe" "%PROJECT_FULL_FILENAME%" -run=SignTracks